@@ -0,0 +1,499 @@
+// ======================================================================
+// \title  BmpEmulator.cpp
+// \author aborjigin & Generated
+// \brief  cpp file for BmpEmulator component implementation class
+// ======================================================================
+
+#include "fprime-sensors/Bmp280/Components/BmpEmulator/BmpEmulator.hpp"
+#include <cmath>
+#include <cstring>
+
+namespace Bmp280 {
+
+// Example trimming parameters and ADC outputs from section 8.1 of the BMP280 datasheet
+static const BmpEmulator::Trim DATASHEET_TRIM = {27504, 26435, -1000, 36477, -10685, 3024,
+                                                 2855,  140,   -7,    15500, -14600, 6000};
+static constexpr U32 DATASHEET_ADC_P = 415148;
+static constexpr U32 DATASHEET_ADC_T = 519888;
+
+// Largest 20-bit raw value
+static constexpr U32 RAW_MAX = 0xFFFFF;
+
+// Normal mode conversions run when the time jumps forward, older conversions no longer affect the IIR output
+static constexpr U64 MAX_CATCH_UP_CONVERSIONS = 32;
+
+// Standby time for each t_sb setting (µs)
+static const U32 STANDBY_TIMES_US[] = {500, 62500, 125000, 250000, 500000, 1000000, 2000000, 4000000};
+
+//! Number of samples averaged for an osrs_t or osrs_p setting, 0 when skipped
+static U32 oversampling_samples(U8 setting) {
+    if (setting == 0) {
+        return 0;
+    }
+    return (setting >= 5) ? 16 : (1U << (setting - 1));
+}
+
+//! Coefficient of the IIR filter setting of a CONFIG value, 1 when off
+static U32 filter_coefficient(U8 config) {
+    const U8 setting = (config >> 2) & 0x07;
+    if (setting == 0) {
+        return 1;
+    }
+    return (setting >= 4) ? 16 : (1U << setting);
+}
+
+//! Raw value resolution in bits for a number of samples, 16 bits at 1x and one more per doubling
+static U32 resolution_bits(U32 samples) {
+    U32 bits = 16;
+    while ((samples > 1) && (bits < 20)) {
+        samples >>= 1;
+        bits++;
+    }
+    return bits;
+}
+
+//! Store a 20-bit raw value into three data registers, MSB first
+static void store_raw(U8* registers, U32 raw) {
+    registers[0] = static_cast<U8>(raw >> 12);
+    registers[1] = static_cast<U8>(raw >> 4);
+    registers[2] = static_cast<U8>((raw << 4) & 0xF0);
+}
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+BmpEmulator ::BmpEmulator(const char* const compName)
+    : BmpEmulatorComponentBase(compName),
+      m_rawPressure(DATASHEET_ADC_P),
+      m_rawTemperature(DATASHEET_ADC_T),
+      m_pressureNoise(0.0f),
+      m_temperatureNoise(0.0f),
+      m_noiseState(0x2545F491),
+      m_transactionCount(0),
+      m_timed(false) {
+    for (FwSizeType i = 0; i < MAX_DEVICES; i++) {
+        this->m_devices[i].fault = EmulatorFault::NONE;
+        this->m_devices[i].conversionCount = 0;
+        this->reset_device(this->m_devices[i], 0);
+    }
+}
+
+BmpEmulator ::~BmpEmulator() {}
+
+bool BmpEmulator ::set_environment(F32 pressure, F32 temperature) {
+    // Written to also reject NaN
+    if (!((pressure >= MIN_PRESSURE) && (pressure <= MAX_PRESSURE)) ||
+        !((temperature >= MIN_TEMPERATURE) && (temperature <= MAX_TEMPERATURE))) {
+        return false;
+    }
+    const Trim& trim = get_trim();
+    I32 tFine = 0;
+
+    // Compensated temperature rises with its raw value, find the first raw value reaching the target
+    const I32 targetTemperature = static_cast<I32>(std::lround(static_cast<F64>(temperature) * 100.0));
+    U32 low = 0;
+    U32 high = RAW_MAX;
+    while (low < high) {
+        const U32 middle = low + (high - low) / 2;
+        if (compensate_temperature(static_cast<I32>(middle), trim, tFine) < targetTemperature) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if ((low > 0) && ((compensate_temperature(static_cast<I32>(low), trim, tFine) - targetTemperature) >
+                      (targetTemperature - compensate_temperature(static_cast<I32>(low - 1), trim, tFine)))) {
+        low--;
+    }
+    this->m_rawTemperature = low;
+    (void)compensate_temperature(static_cast<I32>(low), trim, tFine);
+
+    // Compensated pressure falls as its raw value rises, find the first raw value at or below the target
+    const I64 targetPressure = static_cast<I64>(std::llround(static_cast<F64>(pressure) * 256.0));
+    low = 0;
+    high = RAW_MAX;
+    while (low < high) {
+        const U32 middle = low + (high - low) / 2;
+        if (static_cast<I64>(compensate_pressure(static_cast<I32>(middle), tFine, trim)) > targetPressure) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if ((low > 0) && ((targetPressure - static_cast<I64>(compensate_pressure(static_cast<I32>(low), tFine, trim))) >
+                      (static_cast<I64>(compensate_pressure(static_cast<I32>(low - 1), tFine, trim)) -
+                       targetPressure))) {
+        low--;
+    }
+    this->m_rawPressure = low;
+    return true;
+}
+
+bool BmpEmulator ::set_noise(F32 pressureNoise, F32 temperatureNoise) {
+    if (!(pressureNoise >= 0.0f) || !(temperatureNoise >= 0.0f)) {
+        return false;
+    }
+    this->m_pressureNoise = pressureNoise;
+    this->m_temperatureNoise = temperatureNoise;
+    return true;
+}
+
+bool BmpEmulator ::inject_fault(FwSizeType device, EmulatorFault fault) {
+    if (device >= MAX_DEVICES) {
+        return false;
+    }
+    this->m_devices[device].fault = fault;
+    return true;
+}
+
+U32 BmpEmulator ::get_raw_pressure() const {
+    return this->m_rawPressure;
+}
+
+U32 BmpEmulator ::get_raw_temperature() const {
+    return this->m_rawTemperature;
+}
+
+U32 BmpEmulator ::get_conversion_count(FwSizeType device) const {
+    FW_ASSERT(device < MAX_DEVICES, static_cast<FwAssertArgType>(device));
+    return this->m_devices[device].conversionCount;
+}
+
+U32 BmpEmulator ::get_transaction_count() const {
+    return this->m_transactionCount;
+}
+
+const BmpEmulator::Trim& BmpEmulator ::get_trim() {
+    return DATASHEET_TRIM;
+}
+
+I32 BmpEmulator ::compensate_temperature(I32 adcT, const Trim& trim, I32& tFine) {
+    const I32 var1 = ((((adcT >> 3) - (static_cast<I32>(trim.dig_T1) << 1))) * static_cast<I32>(trim.dig_T2)) >> 11;
+    const I32 var2 = (((((adcT >> 4) - static_cast<I32>(trim.dig_T1)) * ((adcT >> 4) - static_cast<I32>(trim.dig_T1))) >>
+                       12) *
+                      static_cast<I32>(trim.dig_T3)) >>
+                     14;
+    tFine = var1 + var2;
+    return (tFine * 5 + 128) >> 8;
+}
+
+U32 BmpEmulator ::compensate_pressure(I32 adcP, I32 tFine, const Trim& trim) {
+    I64 var1 = static_cast<I64>(tFine) - 128000;
+    I64 var2 = var1 * var1 * static_cast<I64>(trim.dig_P6);
+    var2 = var2 + ((var1 * static_cast<I64>(trim.dig_P5)) << 17);
+    var2 = var2 + (static_cast<I64>(trim.dig_P4) << 35);
+    var1 = ((var1 * var1 * static_cast<I64>(trim.dig_P3)) >> 8) + ((var1 * static_cast<I64>(trim.dig_P2)) << 12);
+    var1 = (((static_cast<I64>(1) << 47) + var1)) * static_cast<I64>(trim.dig_P1) >> 33;
+    if (var1 == 0) {
+        return 0;  // Avoid division by zero
+    }
+    I64 p = 1048576 - adcP;
+    p = (((p << 31) - var2) * 3125) / var1;
+    var1 = (static_cast<I64>(trim.dig_P9) * (p >> 13) * (p >> 13)) >> 25;
+    var2 = (static_cast<I64>(trim.dig_P8) * p) >> 19;
+    p = ((p + var1 + var2) >> 8) + (static_cast<I64>(trim.dig_P7) << 4);
+    return static_cast<U32>(p);
+}
+
+U32 BmpEmulator ::measurement_time_us(U8 ctrlMeas) {
+    const U32 temperatureSamples = oversampling_samples(static_cast<U8>((ctrlMeas >> 5) & 0x07));
+    const U32 pressureSamples = oversampling_samples(static_cast<U8>((ctrlMeas >> 2) & 0x07));
+    // t_measure,typ = 1 + 2 * T + (2 * P + 0.5) ms
+    U32 time = 1000 + 2000 * temperatureSamples;
+    if (pressureSamples > 0) {
+        time += 2000 * pressureSamples + 500;
+    }
+    return time;
+}
+
+U32 BmpEmulator ::standby_time_us(U8 config) {
+    return STANDBY_TIMES_US[(config >> 5) & 0x07];
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for typed input ports
+// ----------------------------------------------------------------------
+
+void BmpEmulator ::spiReadWrite_handler(FwIndexType portNum, Fw::Buffer& writeBuffer, Fw::Buffer& readBuffer) {
+    FW_ASSERT((portNum >= 0) && (portNum < MAX_DEVICES), static_cast<FwAssertArgType>(portNum));
+    FW_ASSERT(writeBuffer.getSize() != 0);
+    FW_ASSERT(writeBuffer.getSize() == readBuffer.getSize(), static_cast<FwAssertArgType>(writeBuffer.getSize()),
+              static_cast<FwAssertArgType>(readBuffer.getSize()));
+    this->m_transactionCount++;
+
+    this->m_timed = this->isConnected_timeCaller_OutputPort(0);
+    const U64 now = this->now_us();
+    DeviceState& device = this->m_devices[portNum];
+    if (device.fault == EmulatorFault::BROWNOUT) {
+        this->reset_device(device, now);
+        device.fault = EmulatorFault::NONE;
+    }
+    this->advance(device, now);
+
+    // Callers may pass the same memory for both buffers, so each byte is consumed before its slot is overwritten.
+    // SPI addresses replace the register MSB with the read/write bit.
+    const U8* const write = writeBuffer.getData();
+    U8* const read = readBuffer.getData();
+    const FwSizeType size = writeBuffer.getSize();
+    if (write[0] & 0x80) {
+        const U8 address = write[0];
+        read[0] = 0xFF;
+        for (FwSizeType i = 1; i < size; i++) {
+            read[i] = this->read_register(device, static_cast<U8>((address + i - 1) | 0x80), now);
+        }
+    } else {
+        // Multi-byte writes are address/data pairs
+        for (FwSizeType i = 0; i + 1 < size; i += 2) {
+            this->write_register(device, static_cast<U8>(write[i] | 0x80), write[i + 1], now);
+        }
+    }
+
+    // A stuck MISO line only corrupts what is read back, writes still reach the device
+    if (device.fault == EmulatorFault::MISO_LOW) {
+        ::memset(read, 0x00, size);
+    } else if (device.fault == EmulatorFault::MISO_HIGH) {
+        ::memset(read, 0xFF, size);
+    }
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for commands
+// ----------------------------------------------------------------------
+
+void BmpEmulator ::SET_ENVIRONMENT_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, F32 pressure, F32 temperature) {
+    if (!this->set_environment(pressure, temperature)) {
+        this->log_WARNING_LO_EnvironmentInvalid(pressure, temperature);
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+        return;
+    }
+    this->log_ACTIVITY_HI_EnvironmentUpdated(pressure, temperature);
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+void BmpEmulator ::SET_NOISE_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, F32 pressureNoise, F32 temperatureNoise) {
+    if (!this->set_noise(pressureNoise, temperatureNoise)) {
+        this->log_WARNING_LO_NoiseInvalid(pressureNoise, temperatureNoise);
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+        return;
+    }
+    this->log_ACTIVITY_HI_NoiseUpdated(pressureNoise, temperatureNoise);
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+void BmpEmulator ::INJECT_FAULT_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, U8 device, EmulatorFault fault) {
+    if (!this->inject_fault(device, fault)) {
+        this->log_WARNING_LO_InvalidDevice(device);
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+        return;
+    }
+    this->log_ACTIVITY_HI_FaultInjected(device, fault);
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void BmpEmulator ::reset_device(DeviceState& device, U64 now) {
+    ::memset(device.registers, 0, sizeof(device.registers));
+    device.registers[CHIP_ID_REGISTER] = CHIP_ID_VALUE;
+
+    // Trimming parameters are stored little-endian
+    const Trim& trim = get_trim();
+    const U16 words[] = {trim.dig_T1,
+                         static_cast<U16>(trim.dig_T2),
+                         static_cast<U16>(trim.dig_T3),
+                         trim.dig_P1,
+                         static_cast<U16>(trim.dig_P2),
+                         static_cast<U16>(trim.dig_P3),
+                         static_cast<U16>(trim.dig_P4),
+                         static_cast<U16>(trim.dig_P5),
+                         static_cast<U16>(trim.dig_P6),
+                         static_cast<U16>(trim.dig_P7),
+                         static_cast<U16>(trim.dig_P8),
+                         static_cast<U16>(trim.dig_P9)};
+    static_assert(sizeof(words) == CALIB_DATA_LENGTH, "Trim must fill the calibration registers");
+    for (U32 i = 0; i < sizeof(words) / sizeof(words[0]); i++) {
+        device.registers[CALIB_DATA_REGISTER + 2 * i] = static_cast<U8>(words[i] & 0xFF);
+        device.registers[CALIB_DATA_REGISTER + 2 * i + 1] = static_cast<U8>(words[i] >> 8);
+    }
+    store_raw(&device.registers[PRESSURE_MSB_REGISTER], SKIPPED_VALUE);
+    store_raw(&device.registers[TEMPERATURE_MSB_REGISTER], SKIPPED_VALUE);
+
+    device.resetTime = now;
+    device.converting = false;
+    device.conversionEnd = 0;
+    device.normalStart = 0;
+    device.normalCycles = 0;
+    device.pressureIir = 0.0;
+    device.temperatureIir = 0.0;
+    device.iirPrimed = false;
+}
+
+void BmpEmulator ::advance(DeviceState& device, U64 now) {
+    if (device.fault == EmulatorFault::STUCK_BUSY) {
+        return;
+    }
+
+    // Forced conversions return the device to sleep once the data is latched
+    if (device.converting && (!this->m_timed || (now >= device.conversionEnd))) {
+        this->convert(device);
+        device.converting = false;
+        device.registers[CTRL_MEAS_REGISTER] &= static_cast<U8>(~MODE_MASK);
+    }
+
+    if ((device.registers[CTRL_MEAS_REGISTER] & MODE_MASK) != NORMAL_MODE) {
+        return;
+    }
+    if (!this->m_timed) {
+        this->convert(device);
+        return;
+    }
+    // Normal mode cycles through a measurement followed by the standby time
+    const U64 measurement = measurement_time_us(device.registers[CTRL_MEAS_REGISTER]);
+    const U64 period = measurement + standby_time_us(device.registers[CONFIG_REGISTER]);
+    if ((now < device.normalStart) || ((now - device.normalStart) < measurement)) {
+        return;
+    }
+    const U64 completed = (now - device.normalStart - measurement) / period + 1;
+    U64 pending = completed - device.normalCycles;
+    if (pending > MAX_CATCH_UP_CONVERSIONS) {
+        pending = MAX_CATCH_UP_CONVERSIONS;
+    }
+    for (U64 i = 0; i < pending; i++) {
+        this->convert(device);
+    }
+    device.normalCycles = completed;
+}
+
+void BmpEmulator ::convert(DeviceState& device) {
+    const U8 ctrlMeas = device.registers[CTRL_MEAS_REGISTER];
+    const U32 temperatureSamples = oversampling_samples(static_cast<U8>((ctrlMeas >> 5) & 0x07));
+    const U32 pressureSamples = oversampling_samples(static_cast<U8>((ctrlMeas >> 2) & 0x07));
+    const U32 filter = filter_coefficient(device.registers[CONFIG_REGISTER]);
+
+    U32 temperature = SKIPPED_VALUE;
+    if (temperatureSamples > 0) {
+        temperature = this->sample(static_cast<F64>(this->m_rawTemperature), this->m_temperatureNoise,
+                                   temperatureSamples, resolution_bits(temperatureSamples), filter,
+                                   device.temperatureIir, device.iirPrimed);
+    }
+    // Pressure is reported at full resolution whenever the IIR filter is enabled
+    U32 pressure = SKIPPED_VALUE;
+    if (pressureSamples > 0) {
+        pressure = this->sample(static_cast<F64>(this->m_rawPressure), this->m_pressureNoise, pressureSamples,
+                                (filter > 1) ? 20 : resolution_bits(pressureSamples), filter, device.pressureIir,
+                                device.iirPrimed);
+    }
+    device.iirPrimed = (filter > 1);
+
+    store_raw(&device.registers[PRESSURE_MSB_REGISTER], pressure);
+    store_raw(&device.registers[TEMPERATURE_MSB_REGISTER], temperature);
+    device.conversionCount++;
+}
+
+U8 BmpEmulator ::read_register(const DeviceState& device, U8 address, U64 now) const {
+    if (address == CHIP_ID_REGISTER) {
+        return (device.fault == EmulatorFault::WRONG_CHIP_ID) ? WRONG_CHIP_ID_VALUE : CHIP_ID_VALUE;
+    }
+    if (address != STATUS_REGISTER) {
+        return device.registers[address];
+    }
+
+    U8 status = 0;
+    if (device.fault == EmulatorFault::STUCK_BUSY) {
+        status |= STATUS_MEASURING;
+    } else if (this->m_timed) {
+        // Conversions that were due have been latched by advance(), so a pending one is still measuring
+        if (device.converting) {
+            status |= STATUS_MEASURING;
+        }
+        if (((device.registers[CTRL_MEAS_REGISTER] & MODE_MASK) == NORMAL_MODE) && (now >= device.normalStart)) {
+            const U64 measurement = measurement_time_us(device.registers[CTRL_MEAS_REGISTER]);
+            const U64 period = measurement + standby_time_us(device.registers[CONFIG_REGISTER]);
+            if (((now - device.normalStart) % period) < measurement) {
+                status |= STATUS_MEASURING;
+            }
+        }
+    }
+    if (this->m_timed && (now < device.resetTime + STARTUP_TIME_US)) {
+        status |= STATUS_IM_UPDATE;
+    }
+    return status;
+}
+
+void BmpEmulator ::write_register(DeviceState& device, U8 address, U8 value, U64 now) {
+    switch (address) {
+        case RESET_REGISTER:
+            if (value == RESET_VALUE) {
+                this->reset_device(device, now);
+            }
+            break;
+        case CTRL_MEAS_REGISTER: {
+            const U8 previousMode = device.registers[CTRL_MEAS_REGISTER] & MODE_MASK;
+            const U8 mode = value & MODE_MASK;
+            device.registers[CTRL_MEAS_REGISTER] = value;
+            if (mode == NORMAL_MODE) {
+                if (previousMode != NORMAL_MODE) {
+                    device.normalStart = now;
+                    device.normalCycles = 0;
+                }
+            } else if ((mode != SLEEP_MODE) && !device.converting) {
+                // Both forced mode encodings (0b01 and 0b10) start a single conversion
+                device.converting = true;
+                device.conversionEnd = now + measurement_time_us(value);
+            }
+            break;
+        }
+        case CONFIG_REGISTER:
+            // Writes to CONFIG are ignored in normal mode
+            if ((device.registers[CTRL_MEAS_REGISTER] & MODE_MASK) != NORMAL_MODE) {
+                device.registers[CONFIG_REGISTER] = value;
+            }
+            break;
+        default:
+            break;  // Read-only register
+    }
+}
+
+U32 BmpEmulator ::sample(F64 raw, F32 noise, U32 samples, U32 resolution, U32 filter, F64& iirState, bool primed) {
+    F64 value = raw;
+    if (noise > 0.0f) {
+        // Averaging reduces the noise by the square root of the number of samples
+        value += static_cast<F64>(noise) / std::sqrt(static_cast<F64>(samples)) * this->gaussian();
+    }
+    if (filter > 1) {
+        // data_filtered = (data_filtered_old * (c - 1) + data_ADC) / c
+        iirState = primed ? iirState + (value - iirState) / static_cast<F64>(filter) : value;
+        value = iirState;
+    }
+    I64 counts = static_cast<I64>(std::llround(value));
+    counts = (counts < 0) ? 0 : ((counts > RAW_MAX) ? RAW_MAX : counts);
+
+    // Bits below the resolution read as zero
+    const U32 dropped = 20 - resolution;
+    return static_cast<U32>(counts) & ~((1U << dropped) - 1);
+}
+
+F64 BmpEmulator ::gaussian() {
+    // Sum of 12 uniform samples has unit variance (Irwin-Hall), xorshift32 keeps the generator allocation free
+    F64 sum = 0.0;
+    for (U32 i = 0; i < 12; i++) {
+        this->m_noiseState ^= this->m_noiseState << 13;
+        this->m_noiseState ^= this->m_noiseState >> 17;
+        this->m_noiseState ^= this->m_noiseState << 5;
+        sum += static_cast<F64>(this->m_noiseState) / 4294967296.0;
+    }
+    return sum - 6.0;
+}
+
+U64 BmpEmulator ::now_us() {
+    if (!this->m_timed) {
+        return 0;
+    }
+    const Fw::Time time = this->getTime();
+    return static_cast<U64>(time.getSeconds()) * 1000000 + static_cast<U64>(time.getUSeconds());
+}
+
+}  // namespace Bmp280
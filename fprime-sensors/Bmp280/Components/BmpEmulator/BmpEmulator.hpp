@@ -0,0 +1,230 @@
+// ======================================================================
+// \title  BmpEmulator.hpp
+// \author aborjigin & Generated
+// \brief  hpp file for BmpEmulator component implementation class
+// ======================================================================
+
+#ifndef Bmp280_BmpEmulator_HPP
+#define Bmp280_BmpEmulator_HPP
+
+#include "fprime-sensors/Bmp280/Components/BmpEmulator/BmpEmulatorComponentAc.hpp"
+#include "fprime-sensors/Bmp280/Types/FppConstantsAc.hpp"
+
+namespace Bmp280 {
+
+//! Emulates the register file of BMP280 sensors behind the SPI port a BmpManager drives
+//!
+//! Each spiReadWrite port index is one device. Conversions take the datasheet's typical measurement time, read from
+//! the time port, so status polling and pipelining behave as on hardware. When the time port is not connected, forced
+//! conversions complete immediately and normal mode completes one conversion per transaction.
+class BmpEmulator final : public BmpEmulatorComponentBase {
+  public:
+    static constexpr U8 CHIP_ID_REGISTER = 0xD0;
+    static constexpr U8 CHIP_ID_VALUE = 0x58;
+    static constexpr U8 WRONG_CHIP_ID_VALUE = 0x60;  // BME280
+    static constexpr U8 RESET_REGISTER = 0xE0;
+    static constexpr U8 RESET_VALUE = 0xB6;
+    static constexpr U8 STATUS_REGISTER = 0xF3;
+    static constexpr U8 CTRL_MEAS_REGISTER = 0xF4;
+    static constexpr U8 CONFIG_REGISTER = 0xF5;
+    static constexpr U8 PRESSURE_MSB_REGISTER = 0xF7;
+    static constexpr U8 TEMPERATURE_MSB_REGISTER = 0xFA;
+    static constexpr U8 CALIB_DATA_REGISTER = 0x88;
+    static constexpr U8 CALIB_DATA_LENGTH = 24;
+    static constexpr U8 STATUS_MEASURING = 0x08;
+    static constexpr U8 STATUS_IM_UPDATE = 0x01;
+    static constexpr U8 MODE_MASK = 0x03;
+    static constexpr U8 SLEEP_MODE = 0x00;
+    static constexpr U8 NORMAL_MODE = 0x03;
+    static constexpr U32 SKIPPED_VALUE = 0x80000;     // Data register value after reset or a skipped measurement
+    static constexpr U32 STARTUP_TIME_US = 2000;      // NVM copy after power-on or soft reset
+    static constexpr U32 REGISTER_COUNT = 256;
+
+    //! Operating range of the BMP280
+    static constexpr F32 MIN_PRESSURE = 30000.0f;
+    static constexpr F32 MAX_PRESSURE = 110000.0f;
+    static constexpr F32 MIN_TEMPERATURE = -40.0f;
+    static constexpr F32 MAX_TEMPERATURE = 85.0f;
+
+    //! Factory trimming parameters, laid out as in the calibration registers
+    struct Trim {
+        U16 dig_T1;
+        I16 dig_T2;
+        I16 dig_T3;
+        U16 dig_P1;
+        I16 dig_P2;
+        I16 dig_P3;
+        I16 dig_P4;
+        I16 dig_P5;
+        I16 dig_P6;
+        I16 dig_P7;
+        I16 dig_P8;
+        I16 dig_P9;
+    };
+
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct BmpEmulator object, every device at power-on with the datasheet example trim at 25 °C and 100653 Pa
+    BmpEmulator(const char* const compName  //!< The component name
+    );
+
+    //! Destroy BmpEmulator object
+    ~BmpEmulator();
+
+    //! Set the pressure (Pa) and temperature (°C) every device measures, false when outside the operating range
+    bool set_environment(F32 pressure, F32 temperature);
+
+    //! Set the RMS noise in raw counts at 1x oversampling, false when negative or not a number
+    bool set_noise(F32 pressureNoise, F32 temperatureNoise);
+
+    //! Inject a fault into a device, false when the device does not exist
+    bool inject_fault(FwSizeType device, EmulatorFault fault);
+
+    //! Raw pressure that compensates to the environment pressure, before noise
+    U32 get_raw_pressure() const;
+
+    //! Raw temperature that compensates to the environment temperature, before noise
+    U32 get_raw_temperature() const;
+
+    //! Number of conversions the device has completed since construction
+    U32 get_conversion_count(FwSizeType device) const;
+
+    //! Number of SPI transactions serviced since construction
+    U32 get_transaction_count() const;
+
+    //! Trim every device reports
+    static const Trim& get_trim();
+
+    //! Datasheet temperature compensation, returns temperature in 0.01 °C and sets t_fine
+    static I32 compensate_temperature(I32 adcT, const Trim& trim, I32& tFine);
+
+    //! Datasheet 64-bit pressure compensation, returns pressure in Q24.8 Pa
+    static U32 compensate_pressure(I32 adcP, I32 tFine, const Trim& trim);
+
+    //! Typical measurement time (µs) for the oversampling bits of a CTRL_MEAS value (datasheet section 3.8.1)
+    static U32 measurement_time_us(U8 ctrlMeas);
+
+    //! Standby time (µs) for the t_sb bits of a CONFIG value
+    static U32 standby_time_us(U8 config);
+
+  private:
+    // ----------------------------------------------------------------------
+    // Handler implementations for typed input ports
+    // ----------------------------------------------------------------------
+
+    //! Handler implementation for spiReadWrite
+    //!
+    //! SPI transactions from the BmpManager, one port per emulated device chip select
+    void spiReadWrite_handler(FwIndexType portNum,      //!< The port number
+                              Fw::Buffer& writeBuffer,  //!< Buffer written to the device
+                              Fw::Buffer& readBuffer    //!< Buffer read back from the device
+                              ) override;
+
+    // ----------------------------------------------------------------------
+    // Handler implementations for commands
+    // ----------------------------------------------------------------------
+
+    //! Handler implementation for command SET_ENVIRONMENT
+    //!
+    //! Set the pressure and temperature every emulated device measures
+    void SET_ENVIRONMENT_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                    U32 cmdSeq,           //!< The command sequence number
+                                    F32 pressure,         //!< Pressure (Pa), 30000 to 110000
+                                    F32 temperature       //!< Temperature (°C), -40 to 85
+                                    ) override;
+
+    //! Handler implementation for command SET_NOISE
+    //!
+    //! Set the RMS noise added to each conversion at 1x oversampling, reduced by the oversampling ratio
+    void SET_NOISE_cmdHandler(FwOpcodeType opCode,   //!< The opcode
+                              U32 cmdSeq,            //!< The command sequence number
+                              F32 pressureNoise,     //!< RMS noise in raw pressure counts
+                              F32 temperatureNoise   //!< RMS noise in raw temperature counts
+                              ) override;
+
+    //! Handler implementation for command INJECT_FAULT
+    //!
+    //! Inject a fault into an emulated device
+    void INJECT_FAULT_cmdHandler(FwOpcodeType opCode,    //!< The opcode
+                                 U32 cmdSeq,             //!< The command sequence number
+                                 U8 device,              //!< Index of the device
+                                 EmulatorFault fault     //!< Fault to inject, NONE clears the device's fault
+                                 ) override;
+
+    // ----------------------------------------------------------------------
+    // Helper types
+    // ----------------------------------------------------------------------
+
+    //! State of an emulated device
+    struct DeviceState {
+        U8 registers[REGISTER_COUNT];  //!< Register file, indexed by register address
+        EmulatorFault fault;           //!< Injected fault
+        U64 resetTime;                 //!< Time of the last reset (µs)
+        bool converting;               //!< Whether a forced conversion is in progress
+        U64 conversionEnd;             //!< Time the forced conversion completes (µs)
+        U64 normalStart;               //!< Time normal mode was entered (µs)
+        U64 normalCycles;              //!< Normal mode conversions latched since normalStart
+        F64 pressureIir;               //!< IIR filter state of the raw pressure
+        F64 temperatureIir;            //!< IIR filter state of the raw temperature
+        bool iirPrimed;                //!< Whether the IIR filter holds a sample
+        U32 conversionCount;           //!< Completed conversions
+    };
+
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Return the device to its power-on state
+    void reset_device(DeviceState& device, U64 now);
+
+    //! Complete any conversions due by now
+    void advance(DeviceState& device, U64 now);
+
+    //! Run a conversion and latch it into the data registers
+    void convert(DeviceState& device);
+
+    //! Value of a register as read over the bus at the given time
+    U8 read_register(const DeviceState& device, U8 address, U64 now) const;
+
+    //! Apply a write to a register
+    void write_register(DeviceState& device, U8 address, U8 value, U64 now);
+
+    //! Sample one noisy and filtered raw value of the given resolution
+    U32 sample(F64 raw, F32 noise, U32 samples, U32 resolution, U32 filter, F64& iirState, bool primed);
+
+    //! Standard normal sample from the noise generator
+    F64 gaussian();
+
+    //! Current time (µs)
+    U64 now_us();
+
+    //! Per-device state
+    DeviceState m_devices[MAX_DEVICES];
+
+    //! Raw pressure that compensates to the environment pressure
+    U32 m_rawPressure;
+
+    //! Raw temperature that compensates to the environment temperature
+    U32 m_rawTemperature;
+
+    //! RMS pressure noise in raw counts at 1x oversampling
+    F32 m_pressureNoise;
+
+    //! RMS temperature noise in raw counts at 1x oversampling
+    F32 m_temperatureNoise;
+
+    //! State of the xorshift noise generator, fixed seed such that runs are reproducible
+    U32 m_noiseState;
+
+    //! Number of SPI transactions serviced
+    U32 m_transactionCount;
+
+    //! Whether the current transaction is timed by the time port
+    bool m_timed;
+};
+
+}  // namespace Bmp280
+
+#endif
@@ -0,0 +1,47 @@
+// ======================================================================
+// \title  BmpEmulatorTestMain.cpp
+// \author aborjigin & Generated
+// \brief  test main for BmpEmulator component
+// ======================================================================
+
+#include "BmpEmulatorTester.hpp"
+
+TEST(Nominal, Registers) {
+    Bmp280::BmpEmulatorTester tester;
+    tester.test_registers();
+}
+
+TEST(Nominal, Environment) {
+    Bmp280::BmpEmulatorTester tester;
+    tester.test_environment();
+}
+
+TEST(Nominal, ForcedConversion) {
+    Bmp280::BmpEmulatorTester tester;
+    tester.test_forced_conversion();
+}
+
+TEST(Nominal, NormalMode) {
+    Bmp280::BmpEmulatorTester tester;
+    tester.test_normal_mode();
+}
+
+TEST(Nominal, Noise) {
+    Bmp280::BmpEmulatorTester tester;
+    tester.test_noise();
+}
+
+TEST(Nominal, Commands) {
+    Bmp280::BmpEmulatorTester tester;
+    tester.test_commands();
+}
+
+TEST(Error, Faults) {
+    Bmp280::BmpEmulatorTester tester;
+    tester.test_faults();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
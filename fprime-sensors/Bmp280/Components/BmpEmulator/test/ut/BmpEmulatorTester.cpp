@@ -0,0 +1,322 @@
+// ======================================================================
+// \title  BmpEmulatorTester.cpp
+// \author aborjigin & Generated
+// \brief  cpp file for BmpEmulator component test harness implementation class
+// ======================================================================
+
+#include "BmpEmulatorTester.hpp"
+#include <cmath>
+#include <limits>
+
+namespace Bmp280 {
+
+// Register addresses with the MSB cleared, as sent for SPI writes
+static const U8 WRITE_RESET = 0x60;
+static const U8 WRITE_CTRL_MEAS = 0x74;
+static const U8 WRITE_CONFIG = 0x75;
+static const U8 WRITE_CHIP_ID = 0x50;
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+BmpEmulatorTester ::BmpEmulatorTester()
+    : BmpEmulatorGTestBase("BmpEmulatorTester", BmpEmulatorTester::MAX_HISTORY_SIZE), component("BmpEmulator") {
+    this->initComponents();
+    this->connectPorts();
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 10, 0));
+}
+
+BmpEmulatorTester ::~BmpEmulatorTester() {}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void BmpEmulatorTester ::test_registers() {
+    ASSERT_EQ(this->read_register(0, BmpEmulator::CHIP_ID_REGISTER), BmpEmulator::CHIP_ID_VALUE);
+    ASSERT_EQ(this->read_register(0, BmpEmulator::STATUS_REGISTER), 0);
+    ASSERT_EQ(this->read_register(0, BmpEmulator::CTRL_MEAS_REGISTER), 0);
+
+    // Trim is read little-endian in a single burst
+    U8 trim[BmpEmulator::CALIB_DATA_LENGTH + 1] = {BmpEmulator::CALIB_DATA_REGISTER};
+    Fw::Buffer buffer(trim, sizeof(trim));
+    this->invoke_to_spiReadWrite(0, buffer, buffer);
+    const BmpEmulator::Trim& expected = BmpEmulator::get_trim();
+    ASSERT_EQ((static_cast<U16>(trim[2]) << 8) | trim[1], expected.dig_T1);
+    ASSERT_EQ(static_cast<I16>((static_cast<U16>(trim[4]) << 8) | trim[3]), expected.dig_T2);
+    ASSERT_EQ((static_cast<U16>(trim[8]) << 8) | trim[7], expected.dig_P1);
+    ASSERT_EQ(static_cast<I16>((static_cast<U16>(trim[24]) << 8) | trim[23]), expected.dig_P9);
+
+    // Data registers hold the skipped value until the first conversion
+    U32 pressure = 0;
+    U32 temperature = 0;
+    this->read_data(0, pressure, temperature);
+    ASSERT_EQ(pressure, BmpEmulator::SKIPPED_VALUE);
+    ASSERT_EQ(temperature, BmpEmulator::SKIPPED_VALUE);
+
+    // Read-only registers ignore writes
+    this->write_register(0, WRITE_CHIP_ID, 0x00);
+    ASSERT_EQ(this->read_register(0, BmpEmulator::CHIP_ID_REGISTER), BmpEmulator::CHIP_ID_VALUE);
+
+    // Only the reset value triggers a soft reset, which reloads the NVM for STARTUP_TIME_US
+    this->write_register(0, WRITE_CTRL_MEAS, 0x24);
+    this->write_register(0, WRITE_RESET, 0x00);
+    ASSERT_EQ(this->read_register(0, BmpEmulator::CTRL_MEAS_REGISTER), 0x24);
+    this->write_register(0, WRITE_RESET, BmpEmulator::RESET_VALUE);
+    ASSERT_EQ(this->read_register(0, BmpEmulator::CTRL_MEAS_REGISTER), 0);
+    ASSERT_EQ(this->read_register(0, BmpEmulator::STATUS_REGISTER), BmpEmulator::STATUS_IM_UPDATE);
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 10, BmpEmulator::STARTUP_TIME_US));
+    ASSERT_EQ(this->read_register(0, BmpEmulator::STATUS_REGISTER), 0);
+
+    // Devices are independent
+    ASSERT_EQ(this->read_register(1, BmpEmulator::CTRL_MEAS_REGISTER), 0);
+    ASSERT_EQ(this->component.get_transaction_count(), 15);
+}
+
+void BmpEmulatorTester ::test_environment() {
+    const F32 pressures[] = {30000.0f, 68000.0f, 101325.0f, 110000.0f};
+    const F32 temperatures[] = {-40.0f, 0.0f, 25.0f, 85.0f};
+    const BmpEmulator::Trim& trim = BmpEmulator::get_trim();
+    for (F32 pressure : pressures) {
+        for (F32 temperature : temperatures) {
+            ASSERT_TRUE(this->component.set_environment(pressure, temperature));
+            I32 tFine = 0;
+            const I32 compensated =
+                BmpEmulator::compensate_temperature(static_cast<I32>(this->component.get_raw_temperature()), trim, tFine);
+            ASSERT_NEAR(static_cast<F32>(compensated) / 100.0f, temperature, 0.01f);
+            const U32 compensatedPressure =
+                BmpEmulator::compensate_pressure(static_cast<I32>(this->component.get_raw_pressure()), tFine, trim);
+            // One raw count is about 0.2 Pa
+            ASSERT_NEAR(static_cast<F32>(compensatedPressure) / 256.0f, pressure, 0.2f);
+        }
+    }
+
+    // Outside of the operating range
+    ASSERT_FALSE(this->component.set_environment(20000.0f, 25.0f));
+    ASSERT_FALSE(this->component.set_environment(101325.0f, 90.0f));
+    ASSERT_FALSE(this->component.set_environment(std::numeric_limits<F32>::quiet_NaN(), 25.0f));
+}
+
+void BmpEmulatorTester ::test_forced_conversion() {
+    ASSERT_EQ(BmpEmulator::measurement_time_us(0x24), 5500);
+    ASSERT_EQ(BmpEmulator::measurement_time_us(0xB4), 65500);
+    ASSERT_EQ(BmpEmulator::measurement_time_us(0x20), 3000);
+
+    // 1x oversampling, forced mode
+    this->write_register(0, WRITE_CTRL_MEAS, 0x25);
+    ASSERT_EQ(this->read_register(0, BmpEmulator::STATUS_REGISTER), BmpEmulator::STATUS_MEASURING);
+
+    // A second trigger during the conversion does not restart it
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 10, 3000));
+    this->write_register(0, WRITE_CTRL_MEAS, 0x25);
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 10, 5499));
+    ASSERT_EQ(this->read_register(0, BmpEmulator::STATUS_REGISTER), BmpEmulator::STATUS_MEASURING);
+    ASSERT_EQ(this->component.get_conversion_count(0), 0);
+
+    // Completion latches the data and returns the device to sleep
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 10, 5500));
+    ASSERT_EQ(this->read_register(0, BmpEmulator::STATUS_REGISTER), 0);
+    ASSERT_EQ(this->read_register(0, BmpEmulator::CTRL_MEAS_REGISTER), 0x24);
+    ASSERT_EQ(this->component.get_conversion_count(0), 1);
+
+    // 16-bit resolution at 1x oversampling
+    U32 pressure = 0;
+    U32 temperature = 0;
+    this->read_data(0, pressure, temperature);
+    ASSERT_EQ(pressure, this->component.get_raw_pressure() & ~0xFU);
+    ASSERT_EQ(temperature, this->component.get_raw_temperature() & ~0xFU);
+
+    // Skipped pressure reads back as the skipped value, 20-bit temperature at 16x
+    this->write_register(0, WRITE_CTRL_MEAS, 0xA1);
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 11, 0));
+    this->read_data(0, pressure, temperature);
+    ASSERT_EQ(pressure, BmpEmulator::SKIPPED_VALUE);
+    ASSERT_EQ(temperature, this->component.get_raw_temperature());
+}
+
+void BmpEmulatorTester ::test_normal_mode() {
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 20, 0));
+    this->write_register(0, WRITE_CONFIG, 0x20);
+    this->write_register(0, WRITE_CTRL_MEAS, 0x27);
+    const U32 measurement = BmpEmulator::measurement_time_us(0x27);
+    const U32 period = measurement + BmpEmulator::standby_time_us(0x20);
+    ASSERT_EQ(period, 68000);
+
+    // Each cycle measures and then stands by
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 20, measurement - 1));
+    ASSERT_EQ(this->read_register(0, BmpEmulator::STATUS_REGISTER), BmpEmulator::STATUS_MEASURING);
+    ASSERT_EQ(this->component.get_conversion_count(0), 0);
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 20, measurement));
+    ASSERT_EQ(this->read_register(0, BmpEmulator::STATUS_REGISTER), 0);
+    ASSERT_EQ(this->component.get_conversion_count(0), 1);
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 20, period));
+    ASSERT_EQ(this->read_register(0, BmpEmulator::STATUS_REGISTER), BmpEmulator::STATUS_MEASURING);
+    ASSERT_EQ(this->component.get_conversion_count(0), 1);
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 20, period + measurement));
+    ASSERT_EQ(this->read_register(0, BmpEmulator::STATUS_REGISTER), 0);
+    ASSERT_EQ(this->component.get_conversion_count(0), 2);
+
+    // Normal mode keeps running, only CONFIG writes are ignored
+    ASSERT_EQ(this->read_register(0, BmpEmulator::CTRL_MEAS_REGISTER), 0x27);
+    this->write_register(0, WRITE_CONFIG, 0x40);
+    ASSERT_EQ(this->read_register(0, BmpEmulator::CONFIG_REGISTER), 0x20);
+
+    // A long gap catches up on a bounded number of conversions
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 30, 0));
+    ASSERT_EQ(this->read_register(0, BmpEmulator::CTRL_MEAS_REGISTER), 0x27);
+    ASSERT_GT(this->component.get_conversion_count(0), 2);
+    ASSERT_LT(this->component.get_conversion_count(0), 10000000 / period);
+
+    // Sleep stops the cycle and allows CONFIG writes
+    this->write_register(0, WRITE_CTRL_MEAS, 0x24);
+    this->write_register(0, WRITE_CONFIG, 0x40);
+    ASSERT_EQ(this->read_register(0, BmpEmulator::CONFIG_REGISTER), 0x40);
+    const U32 conversions = this->component.get_conversion_count(0);
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 40, 0));
+    ASSERT_EQ(this->read_register(0, BmpEmulator::STATUS_REGISTER), 0);
+    ASSERT_EQ(this->component.get_conversion_count(0), conversions);
+}
+
+void BmpEmulatorTester ::test_noise() {
+    ASSERT_TRUE(this->component.set_noise(64.0f, 0.0f));
+
+    // 1x oversampling keeps the full noise, 16x oversampling averages it down by 4
+    const F64 noise1x = this->pressure_noise(0, 0x27, 0x00);
+    ASSERT_NEAR(noise1x, 64.0, 6.4);
+    const F64 noise16x = this->pressure_noise(1, 0xB7, 0x00);
+    ASSERT_NEAR(noise16x, 16.0, 1.6);
+
+    // IIR coefficient 16 leaves sqrt(1 / 31) of the noise
+    const F64 filtered = this->pressure_noise(2, 0xB7, 0x10);
+    ASSERT_GT(filtered, 2.0);
+    ASSERT_LT(filtered, 4.0);
+
+    ASSERT_FALSE(this->component.set_noise(-1.0f, 0.0f));
+    ASSERT_FALSE(this->component.set_noise(0.0f, std::numeric_limits<F32>::quiet_NaN()));
+}
+
+void BmpEmulatorTester ::test_faults() {
+    U32 pressure = 0;
+    U32 temperature = 0;
+
+    // Stuck MISO corrupts reads, writes still reach the device
+    ASSERT_TRUE(this->component.inject_fault(0, EmulatorFault::MISO_LOW));
+    ASSERT_EQ(this->read_register(0, BmpEmulator::CHIP_ID_REGISTER), 0x00);
+    this->read_data(0, pressure, temperature);
+    ASSERT_EQ(pressure, 0);
+    ASSERT_TRUE(this->component.inject_fault(0, EmulatorFault::MISO_HIGH));
+    ASSERT_EQ(this->read_register(0, BmpEmulator::STATUS_REGISTER), 0xFF);
+    this->write_register(0, WRITE_CTRL_MEAS, 0x24);
+    ASSERT_TRUE(this->component.inject_fault(0, EmulatorFault::NONE));
+    ASSERT_EQ(this->read_register(0, BmpEmulator::CTRL_MEAS_REGISTER), 0x24);
+
+    ASSERT_TRUE(this->component.inject_fault(0, EmulatorFault::WRONG_CHIP_ID));
+    ASSERT_EQ(this->read_register(0, BmpEmulator::CHIP_ID_REGISTER), BmpEmulator::WRONG_CHIP_ID_VALUE);
+    ASSERT_EQ(this->read_register(1, BmpEmulator::CHIP_ID_REGISTER), BmpEmulator::CHIP_ID_VALUE);
+    ASSERT_TRUE(this->component.inject_fault(0, EmulatorFault::NONE));
+
+    // Stuck busy holds the conversion until the fault clears
+    ASSERT_TRUE(this->component.inject_fault(0, EmulatorFault::STUCK_BUSY));
+    this->write_register(0, WRITE_CTRL_MEAS, 0x25);
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 12, 0));
+    ASSERT_EQ(this->read_register(0, BmpEmulator::STATUS_REGISTER), BmpEmulator::STATUS_MEASURING);
+    ASSERT_EQ(this->component.get_conversion_count(0), 0);
+    ASSERT_TRUE(this->component.inject_fault(0, EmulatorFault::NONE));
+    ASSERT_EQ(this->read_register(0, BmpEmulator::STATUS_REGISTER), 0);
+    ASSERT_EQ(this->component.get_conversion_count(0), 1);
+
+    // Brownout returns the device to power-on once, then clears itself
+    this->write_register(0, WRITE_CTRL_MEAS, 0x27);
+    ASSERT_TRUE(this->component.inject_fault(0, EmulatorFault::BROWNOUT));
+    ASSERT_EQ(this->read_register(0, BmpEmulator::CTRL_MEAS_REGISTER), 0);
+    ASSERT_EQ(this->read_register(0, BmpEmulator::STATUS_REGISTER), BmpEmulator::STATUS_IM_UPDATE);
+    this->read_data(0, pressure, temperature);
+    ASSERT_EQ(pressure, BmpEmulator::SKIPPED_VALUE);
+    ASSERT_EQ(temperature, BmpEmulator::SKIPPED_VALUE);
+    ASSERT_EQ(this->read_register(0, BmpEmulator::CHIP_ID_REGISTER), BmpEmulator::CHIP_ID_VALUE);
+
+    ASSERT_FALSE(this->component.inject_fault(MAX_DEVICES, EmulatorFault::MISO_LOW));
+}
+
+void BmpEmulatorTester ::test_commands() {
+    this->sendCmd_SET_ENVIRONMENT(0, 0, 90000.0f, 10.0f);
+    this->sendCmd_SET_ENVIRONMENT(0, 1, 20000.0f, 10.0f);
+    ASSERT_CMD_RESPONSE_SIZE(2);
+    ASSERT_CMD_RESPONSE(0, BmpEmulator::OPCODE_SET_ENVIRONMENT, 0, Fw::CmdResponse::OK);
+    ASSERT_CMD_RESPONSE(1, BmpEmulator::OPCODE_SET_ENVIRONMENT, 1, Fw::CmdResponse::VALIDATION_ERROR);
+    ASSERT_EVENTS_EnvironmentUpdated(0, 90000.0f, 10.0f);
+    ASSERT_EVENTS_EnvironmentInvalid(0, 20000.0f, 10.0f);
+
+    this->clearHistory();
+    this->sendCmd_SET_NOISE(0, 0, 8.0f, 2.0f);
+    this->sendCmd_SET_NOISE(0, 1, -8.0f, 2.0f);
+    ASSERT_CMD_RESPONSE(0, BmpEmulator::OPCODE_SET_NOISE, 0, Fw::CmdResponse::OK);
+    ASSERT_CMD_RESPONSE(1, BmpEmulator::OPCODE_SET_NOISE, 1, Fw::CmdResponse::VALIDATION_ERROR);
+    ASSERT_EVENTS_NoiseUpdated(0, 8.0f, 2.0f);
+    ASSERT_EVENTS_NoiseInvalid(0, -8.0f, 2.0f);
+
+    this->clearHistory();
+    this->sendCmd_INJECT_FAULT(0, 0, 1, EmulatorFault::WRONG_CHIP_ID);
+    this->sendCmd_INJECT_FAULT(0, 1, MAX_DEVICES, EmulatorFault::WRONG_CHIP_ID);
+    ASSERT_CMD_RESPONSE(0, BmpEmulator::OPCODE_INJECT_FAULT, 0, Fw::CmdResponse::OK);
+    ASSERT_CMD_RESPONSE(1, BmpEmulator::OPCODE_INJECT_FAULT, 1, Fw::CmdResponse::VALIDATION_ERROR);
+    ASSERT_EVENTS_FaultInjected(0, 1, EmulatorFault::WRONG_CHIP_ID);
+    ASSERT_EVENTS_InvalidDevice(0, MAX_DEVICES);
+    ASSERT_EQ(this->read_register(1, BmpEmulator::CHIP_ID_REGISTER), BmpEmulator::WRONG_CHIP_ID_VALUE);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+U8 BmpEmulatorTester ::read_register(FwIndexType device, U8 address) {
+    U8 data[2] = {static_cast<U8>(address | 0x80), 0x00};
+    Fw::Buffer buffer(data, sizeof(data));
+    this->invoke_to_spiReadWrite(device, buffer, buffer);
+    return data[1];
+}
+
+void BmpEmulatorTester ::write_register(FwIndexType device, U8 address, U8 value) {
+    U8 data[2] = {static_cast<U8>(address & 0x7F), value};
+    Fw::Buffer buffer(data, sizeof(data));
+    this->invoke_to_spiReadWrite(device, buffer, buffer);
+}
+
+void BmpEmulatorTester ::read_data(FwIndexType device, U32& pressure, U32& temperature) {
+    U8 data[7] = {static_cast<U8>(BmpEmulator::PRESSURE_MSB_REGISTER | 0x80)};
+    Fw::Buffer buffer(data, sizeof(data));
+    this->invoke_to_spiReadWrite(device, buffer, buffer);
+    pressure = (static_cast<U32>(data[1]) << 12) | (static_cast<U32>(data[2]) << 4) | (static_cast<U32>(data[3]) >> 4);
+    temperature =
+        (static_cast<U32>(data[4]) << 12) | (static_cast<U32>(data[5]) << 4) | (static_cast<U32>(data[6]) >> 4);
+}
+
+F64 BmpEmulatorTester ::pressure_noise(FwIndexType device, U8 ctrlMeas, U8 config) {
+    // CONFIG is only writable while asleep
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 100, 0));
+    this->write_register(device, WRITE_CTRL_MEAS, static_cast<U8>(ctrlMeas & ~BmpEmulator::MODE_MASK));
+    this->write_register(device, WRITE_CONFIG, config);
+    this->write_register(device, WRITE_CTRL_MEAS, ctrlMeas);
+
+    // Step one cycle at a time, such that every conversion is read once, and skip the IIR settling time
+    const U64 period = BmpEmulator::measurement_time_us(ctrlMeas) + BmpEmulator::standby_time_us(config);
+    const F64 raw = static_cast<F64>(this->component.get_raw_pressure());
+    const FwSizeType settle = 100;
+    F64 sumSquares = 0.0;
+    for (FwSizeType i = 1; i <= NOISE_SAMPLES + settle; i++) {
+        const U64 time = 100 * 1000000ULL + i * period;
+        this->setTestTime(
+            Fw::Time(TimeBase::TB_NONE, static_cast<U32>(time / 1000000), static_cast<U32>(time % 1000000)));
+        U32 pressure = 0;
+        U32 temperature = 0;
+        this->read_data(device, pressure, temperature);
+        if (i > settle) {
+            const F64 error = static_cast<F64>(pressure) - raw;
+            sumSquares += error * error;
+        }
+    }
+    return std::sqrt(sumSquares / static_cast<F64>(NOISE_SAMPLES));
+}
+
+}  // namespace Bmp280
@@ -0,0 +1,100 @@
+// ======================================================================
+// \title  BmpEmulatorTester.hpp
+// \author aborjigin & Generated
+// \brief  hpp file for BmpEmulator component test harness implementation class
+// ======================================================================
+
+#ifndef Bmp280_BmpEmulatorTester_HPP
+#define Bmp280_BmpEmulatorTester_HPP
+
+#include "fprime-sensors/Bmp280/Components/BmpEmulator/BmpEmulator.hpp"
+#include "fprime-sensors/Bmp280/Components/BmpEmulator/BmpEmulatorGTestBase.hpp"
+
+namespace Bmp280 {
+
+class BmpEmulatorTester : public BmpEmulatorGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const FwSizeType MAX_HISTORY_SIZE = 10;
+
+    // Instance ID supplied to the component instance under test
+    static const FwEnumStoreType TEST_INSTANCE_ID = 0;
+
+    // Number of conversions used to estimate noise
+    static const FwSizeType NOISE_SAMPLES = 2000;
+
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object BmpEmulatorTester
+    BmpEmulatorTester();
+
+    //! Destroy object BmpEmulatorTester
+    ~BmpEmulatorTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! Test the power-on register file, read-only registers, and soft reset
+    void test_registers();
+
+    //! Test the environment compensates back to the requested pressure and temperature
+    void test_environment();
+
+    //! Test forced conversion timing and status bits
+    void test_forced_conversion();
+
+    //! Test normal mode cycle timing and CONFIG write protection
+    void test_normal_mode();
+
+    //! Test noise is reduced by oversampling and the IIR filter
+    void test_noise();
+
+    //! Test each injected fault
+    void test_faults();
+
+    //! Test command validation
+    void test_commands();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Read a single register
+    U8 read_register(FwIndexType device, U8 address);
+
+    //! Write a single register
+    void write_register(FwIndexType device, U8 address, U8 value);
+
+    //! Burst read the pressure and temperature data registers
+    void read_data(FwIndexType device, U32& pressure, U32& temperature);
+
+    //! RMS deviation of the raw pressure from its noise-free value over NOISE_SAMPLES normal mode conversions
+    F64 pressure_noise(FwIndexType device, U8 ctrlMeas, U8 config);
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    BmpEmulator component;
+};
+
+}  // namespace Bmp280
+
+#endif
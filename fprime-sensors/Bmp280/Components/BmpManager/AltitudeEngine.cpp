@@ -0,0 +1,133 @@
+// ======================================================================
+// \title  AltitudeEngine.cpp
+// \author aborjigin
+// \brief  cpp file for the BMP280 pressure to altitude conversion methods
+// ======================================================================
+
+#include "fprime-sensors/Bmp280/Components/BmpManager/AltitudeEngine.hpp"
+#include <cmath>
+#include <cstring>
+#include "Fw/Types/Assert.hpp"
+
+namespace Bmp280 {
+
+// Degree 6 Chebyshev fit of m^(1/5.255) for m in [1, 2), in terms of x = 2m - 3 in [-1, 1). Maximum error 2.1e-7.
+static const F32 MANTISSA_POWER_COEFFICIENTS[] = {1.0802126991f,  0.0685207144f, -0.0092470840f, 0.0018511111f,
+                                                  -0.0004330041f, 0.0001264964f, -0.0000340811f};
+static constexpr U32 MANTISSA_POWER_DEGREE =
+    sizeof(MANTISSA_POWER_COEFFICIENTS) / sizeof(MANTISSA_POWER_COEFFICIENTS[0]) - 1;
+
+// IEEE 754 single precision layout
+static constexpr U32 F32_MANTISSA_BITS = 23;
+static constexpr U32 F32_MANTISSA_MASK = (1U << F32_MANTISSA_BITS) - 1;
+static constexpr I32 F32_EXPONENT_BIAS = 127;
+static constexpr U32 F32_ONE_BITS = 0x3F800000;
+
+AltitudeEngine ::AltitudeEngine() : m_seaLevelPressure(0.0f), m_seaLevelScale(0.0f) {
+    static_assert(sizeof(F32) == sizeof(U32), "Pressure splitting requires 32-bit IEEE 754 floats");
+    for (U32 i = 0; i < TABLE_SIZE; i++) {
+        this->m_table[i] = 0.0f;
+    }
+    // Independent of sea level pressure, computed once
+    for (U32 e = 0; e < POLYNOMIAL_EXPONENTS; e++) {
+        this->m_exponentPowers[e] = static_cast<F32>(std::pow(2.0, static_cast<F64>(e) / 5.255));
+    }
+}
+
+F32 AltitudeEngine ::barometric(F32 pressure, F32 seaLevelPressure) {
+    if (seaLevelPressure <= 0.0f || pressure <= 0.0f) {
+        return 0.0f;  // Return 0 for invalid inputs
+    }
+
+    F32 ratio = pressure / seaLevelPressure;
+    if (ratio <= 0.0f) {
+        return 0.0f;
+    }
+
+    // altitude = 44330 * (1 - (pressure / seaLevelPressure)^(1/5.255))
+    return ALTITUDE_CONSTANT * (1.0f - pow(ratio, PRESSURE_EXPONENT));
+}
+
+void AltitudeEngine ::set_sea_level_pressure(F32 seaLevelPressure) {
+    if (seaLevelPressure == this->m_seaLevelPressure) {
+        return;
+    }
+    this->m_seaLevelPressure = seaLevelPressure;
+    this->m_seaLevelScale =
+        (seaLevelPressure > 0.0f) ? static_cast<F32>(std::pow(static_cast<F64>(seaLevelPressure), -1.0 / 5.255)) : 0.0f;
+
+    // Entries are spaced evenly in mantissa within each octave so that the pressure's bits index the table directly
+    const U32 entriesPerOctave = 1U << TABLE_MANTISSA_BITS;
+    for (U32 i = 0; i < TABLE_SIZE; i++) {
+        const F32 octave = std::ldexp(1.0f, TABLE_MIN_EXPONENT + static_cast<I32>(i >> TABLE_MANTISSA_BITS));
+        const F32 mantissa =
+            1.0f + static_cast<F32>(i & (entriesPerOctave - 1)) / static_cast<F32>(entriesPerOctave);
+        this->m_table[i] = barometric(octave * mantissa, seaLevelPressure);
+    }
+}
+
+F32 AltitudeEngine ::get_sea_level_pressure() const {
+    return this->m_seaLevelPressure;
+}
+
+F32 AltitudeEngine ::exact(F32 pressure) const {
+    return barometric(pressure, this->m_seaLevelPressure);
+}
+
+F32 AltitudeEngine ::lookup(F32 pressure) const {
+    // Also rejects NaN, which fails both comparisons
+    if (!((pressure >= TABLE_MIN_PRESSURE) && (pressure < TABLE_MAX_PRESSURE))) {
+        return this->exact(pressure);
+    }
+    I32 exponent = 0;
+    U32 mantissa = 0;
+    split(pressure, exponent, mantissa);
+
+    // Top mantissa bits select the segment, the remaining bits are the interpolation fraction
+    const U32 fractionBits = F32_MANTISSA_BITS - TABLE_MANTISSA_BITS;
+    const U32 index = (static_cast<U32>(exponent - TABLE_MIN_EXPONENT) << TABLE_MANTISSA_BITS) |
+                      (mantissa >> fractionBits);
+    FW_ASSERT(index + 1 < TABLE_SIZE, static_cast<FwAssertArgType>(index));
+    const F32 fraction =
+        static_cast<F32>(mantissa & ((1U << fractionBits) - 1)) * (1.0f / static_cast<F32>(1U << fractionBits));
+
+    const F32 low = this->m_table[index];
+    const F32 high = this->m_table[index + 1];
+    return low + fraction * (high - low);
+}
+
+F32 AltitudeEngine ::polynomial(F32 pressure) const {
+    if (!((pressure >= 1.0f) && (pressure < POLYNOMIAL_MAX_PRESSURE)) ||
+        (this->m_seaLevelPressure <= 0.0f)) {
+        return this->exact(pressure);
+    }
+    I32 exponent = 0;
+    U32 mantissa = 0;
+    split(pressure, exponent, mantissa);
+    FW_ASSERT((exponent >= 0) && (static_cast<U32>(exponent) < POLYNOMIAL_EXPONENTS),
+              static_cast<FwAssertArgType>(exponent));
+
+    // Mantissa as a value in [1, 2), mapped onto [-1, 1) for the fit
+    const U32 oneBits = F32_ONE_BITS | mantissa;
+    F32 m = 0.0f;
+    ::memcpy(&m, &oneBits, sizeof(m));
+    const F32 x = 2.0f * m - 3.0f;
+
+    F32 mantissaPower = MANTISSA_POWER_COEFFICIENTS[MANTISSA_POWER_DEGREE];
+    for (U32 i = MANTISSA_POWER_DEGREE; i > 0; i--) {
+        mantissaPower = mantissaPower * x + MANTISSA_POWER_COEFFICIENTS[i - 1];
+    }
+
+    // (p / p0)^a = m^a * 2^(e * a) * p0^(-a)
+    const F32 ratioPower = mantissaPower * this->m_exponentPowers[exponent] * this->m_seaLevelScale;
+    return ALTITUDE_CONSTANT * (1.0f - ratioPower);
+}
+
+void AltitudeEngine ::split(F32 pressure, I32& exponent, U32& mantissa) {
+    U32 bits = 0;
+    ::memcpy(&bits, &pressure, sizeof(bits));
+    exponent = static_cast<I32>(bits >> F32_MANTISSA_BITS) - F32_EXPONENT_BIAS;
+    mantissa = bits & F32_MANTISSA_MASK;
+}
+
+}  // namespace Bmp280
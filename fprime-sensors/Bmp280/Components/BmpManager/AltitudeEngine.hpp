@@ -0,0 +1,91 @@
+// ======================================================================
+// \title  AltitudeEngine.hpp
+// \author aborjigin
+// \brief  hpp file for the BMP280 pressure to altitude conversion methods
+// ======================================================================
+
+#ifndef Bmp280_AltitudeEngine_HPP
+#define Bmp280_AltitudeEngine_HPP
+
+#include "Fw/FPrimeBasicTypes.hpp"
+
+namespace Bmp280 {
+
+//! Converts pressure to altitude using the standard atmosphere barometric formula
+//!
+//! altitude = 44330 * (1 - (pressure / seaLevelPressure)^(1/5.255))
+//!
+//! Three methods are offered. exact() evaluates pow() for every sample. lookup() linearly interpolates a table of
+//! altitude by pressure, indexed directly by the exponent and top mantissa bits of the pressure, and is rebuilt when
+//! the sea level pressure changes. polynomial() splits the pressure into mantissa and exponent, evaluates a degree 6
+//! Chebyshev fit of the mantissa power, and scales it by a table of exponent powers.
+class AltitudeEngine {
+  public:
+    //! Standard atmosphere constants of the barometric formula
+    static constexpr F32 ALTITUDE_CONSTANT = 44330.0f;
+    static constexpr F32 PRESSURE_EXPONENT = 1.0f / 5.255f;
+
+    //! Lowest pressure covered by the lookup table (Pa), 2^8
+    static constexpr F32 TABLE_MIN_PRESSURE = 256.0f;
+    //! Pressure above the lookup table (Pa), 2^17
+    static constexpr F32 TABLE_MAX_PRESSURE = 131072.0f;
+    //! Exponent of TABLE_MIN_PRESSURE
+    static constexpr I32 TABLE_MIN_EXPONENT = 8;
+    //! Number of pressure octaves covered by the lookup table
+    static constexpr U32 TABLE_OCTAVES = 9;
+    //! Number of mantissa bits used to index within an octave
+    static constexpr U32 TABLE_MANTISSA_BITS = 7;
+    //! Number of table entries, including the upper edge of the last octave
+    static constexpr U32 TABLE_SIZE = (TABLE_OCTAVES << TABLE_MANTISSA_BITS) + 1;
+
+    //! Number of binary exponents covered by the polynomial method, pressures in [1, 2^32) Pa
+    static constexpr U32 POLYNOMIAL_EXPONENTS = 32;
+    //! Pressure above the range of the polynomial method (Pa), 2^32
+    static constexpr F32 POLYNOMIAL_MAX_PRESSURE = 4294967296.0f;
+
+    //! Maximum error (m) of lookup() against the barometric formula for 300 to 110000 Pa at 101325 Pa sea level
+    static constexpr F32 LOOKUP_TABLE_MAX_ERROR = 0.06f;
+    //! Maximum error (m) of polynomial() against the barometric formula for 300 to 110000 Pa at 101325 Pa sea level
+    static constexpr F32 POLYNOMIAL_MAX_ERROR = 0.025f;
+
+    //! Altitude (m) from the barometric formula, 0 for non-positive inputs
+    static F32 barometric(F32 pressure, F32 seaLevelPressure);
+
+    //! Construct an engine without a sea level pressure, all methods return 0 until one is set
+    AltitudeEngine();
+
+    //! Set the sea level pressure (Pa), the lookup table is only rebuilt when the value changes
+    void set_sea_level_pressure(F32 seaLevelPressure);
+
+    //! Sea level pressure (Pa) currently in use
+    F32 get_sea_level_pressure() const;
+
+    //! Altitude (m) using pow() on every call
+    F32 exact(F32 pressure) const;
+
+    //! Altitude (m) interpolated from the lookup table, falling back to exact() outside of the table
+    F32 lookup(F32 pressure) const;
+
+    //! Altitude (m) from the polynomial approximation, falling back to exact() outside of its range
+    F32 polynomial(F32 pressure) const;
+
+  private:
+    //! Split a positive normal pressure into its unbiased binary exponent and raw mantissa bits
+    static void split(F32 pressure, I32& exponent, U32& mantissa);
+
+    //! Sea level pressure (Pa), zero when unset
+    F32 m_seaLevelPressure;
+
+    //! seaLevelPressure^(-1/5.255)
+    F32 m_seaLevelScale;
+
+    //! Altitude at TABLE_MIN_PRESSURE * 2^(i >> TABLE_MANTISSA_BITS) * (1 + (i & mask) / 2^TABLE_MANTISSA_BITS)
+    F32 m_table[TABLE_SIZE];
+
+    //! 2^(e / 5.255) for each exponent e covered by the polynomial method
+    F32 m_exponentPowers[POLYNOMIAL_EXPONENTS];
+};
+
+}  // namespace Bmp280
+
+#endif
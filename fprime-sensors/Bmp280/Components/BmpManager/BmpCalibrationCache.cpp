@@ -0,0 +1,128 @@
+// ======================================================================
+// \title  BmpCalibrationCache.cpp
+// \author aborjigin
+// \brief  cpp file for BmpManager calibration cache helper implementations
+// ======================================================================
+
+#include "fprime-sensors/Bmp280/Components/BmpManager/BmpManager.hpp"
+#include <cstring>
+#include "Os/File.hpp"
+#include "Utils/Hash/Hash.hpp"
+
+namespace Bmp280 {
+
+// Cache record layout: chip id, trim block as read from the device, big-endian CRC-32 of the preceding bytes.
+// A chip id of zero marks an empty record.
+static constexpr U32 RECORD_CHIP_ID_OFFSET = 0;
+static constexpr U32 RECORD_TRIM_OFFSET = 1;
+static constexpr U32 RECORD_CRC_OFFSET = RECORD_TRIM_OFFSET + BmpManager::CALIB_DATA_LENGTH;
+
+// CRC-32 of the bytes of a cache record ahead of its CRC, with the framework hash (IEEE 802.3 CRC-32)
+static U32 record_crc(const U8* record) {
+    Utils::Hash hash;
+    hash.init();
+    hash.update(record, RECORD_CRC_OFFSET);
+    U32 crc = 0;
+    hash.final(crc);
+    return crc;
+}
+
+bool BmpManager ::read_calibration_cache(U8 contents[MAX_DEVICES * CACHE_RECORD_SIZE]) {
+    Os::File file;
+    Os::File::Status status = file.open(this->m_cachePath.toChar(), Os::File::OPEN_READ);
+    if (status == Os::File::DOESNT_EXIST) {
+        return false;  // First boot, the cache is written once calibration has been read
+    }
+    FwSizeType size = MAX_DEVICES * CACHE_RECORD_SIZE;
+    if (status == Os::File::OP_OK) {
+        status = file.read(contents, size);
+        file.close();
+    }
+    if ((status != Os::File::OP_OK) || (size != MAX_DEVICES * CACHE_RECORD_SIZE)) {
+        this->log_WARNING_LO_CalibrationCacheReadFailure(static_cast<I32>(status));
+        return false;
+    }
+    return true;
+}
+
+void BmpManager ::load_calibration_cache(const U8 contents[MAX_DEVICES * CACHE_RECORD_SIZE]) {
+    U8 loaded = 0;
+    for (FwSizeType i = 0; i < this->m_deviceCount; i++) {
+        const U8* record = &contents[i * CACHE_RECORD_SIZE];
+        if (record[RECORD_CHIP_ID_OFFSET] == 0) {
+            continue;  // Device was never calibrated
+        }
+        const U32 crc = (static_cast<U32>(record[RECORD_CRC_OFFSET]) << 24) |
+                        (static_cast<U32>(record[RECORD_CRC_OFFSET + 1]) << 16) |
+                        (static_cast<U32>(record[RECORD_CRC_OFFSET + 2]) << 8) |
+                        static_cast<U32>(record[RECORD_CRC_OFFSET + 3]);
+        if ((record[RECORD_CHIP_ID_OFFSET] != CHIP_ID_VALUE) || (crc != record_crc(record))) {
+            this->log_WARNING_LO_CalibrationCacheInvalid(static_cast<U8>(i));
+            continue;
+        }
+
+        DeviceContext& device = this->m_devices[i];
+        ::memcpy(this->m_cacheRecords[i], record, CACHE_RECORD_SIZE);
+        ::memcpy(device.calibrationBytes, &record[RECORD_TRIM_OFFSET], CALIB_DATA_LENGTH);
+        device.calibration = parse_calibration(device.calibrationBytes);
+        device.calibrationValid = true;
+        // Only devices that have not started the reset sequence may skip it
+        if (device.state == RESET) {
+            device.state = RECOVER;
+        }
+        loaded++;
+    }
+    this->log_ACTIVITY_LO_CalibrationCacheLoaded(loaded);
+}
+
+void BmpManager ::store_calibration_cache(const DeviceContext& device) {
+    if (!this->m_cacheEnabled) {
+        return;
+    }
+    const FwSizeType index = static_cast<FwSizeType>(device.port);
+    FW_ASSERT(index < MAX_DEVICES, static_cast<FwAssertArgType>(index));
+    U8* record = this->m_cacheRecords[index];
+
+    // Trim is factory programmed, rewrite only when a full calibration read returns trim the record does not hold
+    if ((record[RECORD_CHIP_ID_OFFSET] == CHIP_ID_VALUE) &&
+        (::memcmp(&record[RECORD_TRIM_OFFSET], device.calibrationBytes, CALIB_DATA_LENGTH) == 0)) {
+        return;
+    }
+    record[RECORD_CHIP_ID_OFFSET] = CHIP_ID_VALUE;
+    ::memcpy(&record[RECORD_TRIM_OFFSET], device.calibrationBytes, CALIB_DATA_LENGTH);
+    const U32 crc = record_crc(record);
+    record[RECORD_CRC_OFFSET] = static_cast<U8>(crc >> 24);
+    record[RECORD_CRC_OFFSET + 1] = static_cast<U8>(crc >> 16);
+    record[RECORD_CRC_OFFSET + 2] = static_cast<U8>(crc >> 8);
+    record[RECORD_CRC_OFFSET + 3] = static_cast<U8>(crc);
+    this->m_cacheDirty.store(true, std::memory_order_release);
+}
+
+void BmpManager ::write_calibration_cache() {
+    // Checked without the guard on every tick, a write is only needed after a calibration read changed a record
+    if (!this->m_cacheDirty.load(std::memory_order_acquire)) {
+        return;
+    }
+    // Records are copied under the guard, the file is written without holding up commands or the next acquisition
+    U8 contents[MAX_DEVICES * CACHE_RECORD_SIZE];
+    this->lock();
+    this->m_cacheDirty.store(false, std::memory_order_relaxed);
+    ::memcpy(contents, this->m_cacheRecords, sizeof(contents));
+    this->unLock();
+
+    Os::File file;
+    Os::File::Status status = file.open(this->m_cachePath.toChar(), Os::File::OPEN_CREATE, Os::File::OVERWRITE);
+    if (status == Os::File::OP_OK) {
+        FwSizeType size = sizeof(contents);
+        status = file.write(contents, size);
+        file.close();
+        if ((status == Os::File::OP_OK) && (size != sizeof(contents))) {
+            status = Os::File::BAD_SIZE;
+        }
+    }
+    if (status != Os::File::OP_OK) {
+        this->log_WARNING_LO_CalibrationCacheWriteFailure(static_cast<I32>(status));
+    }
+}
+
+}  // namespace Bmp280
@@ -5,179 +5,654 @@
 // ======================================================================
 
 #include "fprime-sensors/Bmp280/Components/BmpManager/BmpManager.hpp"
-#include <cmath>
+#include <limits>
 
 namespace Bmp280 {
 
+// ----------------------------------------------------------------------
+// Compensation formulas shared by the scalar and batch conversions
+// ----------------------------------------------------------------------
+
+//! BMP280 temperature compensation (from datasheet), returns t_fine
+static inline I32 compensate_t_fine(I32 adc_T, const BmpManager::CalibrationData& calib) {
+    const I32 var1 = ((((adc_T >> 3) - (static_cast<I32>(calib.dig_T1) << 1))) * static_cast<I32>(calib.dig_T2)) >> 11;
+    const I32 var2 =
+        (((((adc_T >> 4) - static_cast<I32>(calib.dig_T1)) * ((adc_T >> 4) - static_cast<I32>(calib.dig_T1))) >> 12) *
+         static_cast<I32>(calib.dig_T3)) >>
+        14;
+    return var1 + var2;
+}
+
+//! Temperature in DegC from t_fine, resolution is 0.01 DegC
+static inline F32 t_fine_to_temperature(I32 t_fine) {
+    return static_cast<F32>((t_fine * 5 + 128) >> 8) / 100.0f;
+}
+
+//! BMP280 pressure compensation (from datasheet), returns pressure in Pa
+static inline F32 compensate_pressure(I32 adc_P, I32 t_fine, const BmpManager::CalibrationData& calib) {
+    I64 var1_64, var2_64, p_64;
+    var1_64 = static_cast<I64>(t_fine) - 128000;
+    var2_64 = var1_64 * var1_64 * static_cast<I64>(calib.dig_P6);
+    var2_64 = var2_64 + ((var1_64 * static_cast<I64>(calib.dig_P5)) << 17);
+    var2_64 = var2_64 + (static_cast<I64>(calib.dig_P4) << 35);
+    var1_64 = ((var1_64 * var1_64 * static_cast<I64>(calib.dig_P3)) >> 8) +
+              ((var1_64 * static_cast<I64>(calib.dig_P2)) << 12);
+    var1_64 = (((static_cast<I64>(1) << 47) + var1_64)) * static_cast<I64>(calib.dig_P1) >> 33;
+
+    F32 pressure = 0.0f;
+    if (var1_64 != 0) {
+        p_64 = 1048576 - adc_P;
+        p_64 = (((p_64 << 31) - var2_64) * 3125) / var1_64;
+        var1_64 = (static_cast<I64>(calib.dig_P9) * (p_64 >> 13) * (p_64 >> 13)) >> 25;
+        var2_64 = (static_cast<I64>(calib.dig_P8) * p_64) >> 19;
+        p_64 = ((p_64 + var1_64 + var2_64) >> 8) + (static_cast<I64>(calib.dig_P7) << 4);
+        pressure = static_cast<F32>(p_64) / 256.0f;
+    }
+    return pressure;
+}
+
 // ----------------------------------------------------------------------
 // Component construction and destruction
 // ----------------------------------------------------------------------
 
-BmpManager ::BmpManager(const char* const compName) : BmpManagerComponentBase(compName), m_state(RESET) {}
+BmpManager ::BmpManager(const char* const compName)
+    : BmpManagerComponentBase(compName),
+      m_parametersStale(true),
+      m_cacheEnabled(false),
+      m_cacheLoaded(false),
+      m_cacheDirty(false),
+      m_burstActive(false),
+      m_burstCaptureTick(false),
+      m_burstCount(0),
+      m_burstFill(0),
+      m_burstDivisor(1),
+      m_burstTick(0),
+      m_deviceCount(1),
+      m_nextDevice(0),
+      m_runningMask(0),
+      m_slotShared(1),
+      m_slotBack(0),
+      m_slotFront(2),
+      m_acquireDriven(false),
+      m_healthSeconds(0) {
+    for (FwSizeType i = 0; i < MAX_DEVICES; i++) {
+        DeviceContext& device = this->m_devices[i];
+        device.port = static_cast<FwIndexType>(i);
+        device.state = RESET;
+        device.startupCounter = 0;
+        device.backoffCounter = 0;
+        device.resumeState = RESET;
+        device.health.state = RESET;
+        device.health.consecutiveFailures = 0;
+        device.health.totalResets = 0;
+        device.triggerPending = false;
+        device.decimationCount = 0;
+        device.readingCount = 0;
+        device.calibrationValid = false;
+        for (U32 j = 0; j < CACHE_RECORD_SIZE; j++) {
+            this->m_cacheRecords[i][j] = 0;
+        }
+        this->m_publishedCounts[i] = 0;
+        for (U32 j = 0; j < SLOT_COUNT; j++) {
+            this->m_slots[j].readingCounts[i] = 0;
+            this->m_slots[j].health[i] = device.health;
+        }
+    }
+    for (U32 j = 0; j < SLOT_COUNT; j++) {
+        this->m_slots[j].runningMask = 0;
+    }
+}
 
 BmpManager ::~BmpManager() {}
 
+void BmpManager ::configure(FwSizeType deviceCount, const char* calibrationCachePath) {
+    FW_ASSERT((deviceCount > 0) && (deviceCount <= MAX_DEVICES), static_cast<FwAssertArgType>(deviceCount));
+    this->m_deviceCount = deviceCount;
+    this->m_nextDevice = 0;
+
+    // Cache is read on the first run such that load failures can be reported
+    this->m_cacheEnabled = (calibrationCachePath != nullptr);
+    this->m_cacheLoaded.store(false, std::memory_order_release);
+    if (this->m_cacheEnabled) {
+        this->m_cachePath = calibrationCachePath;
+    }
+}
+
 // ----------------------------------------------------------------------
 // Handler implementations for typed input ports
 // ----------------------------------------------------------------------
 
 void BmpManager ::parameterUpdated(FwPrmIdType id) {
+    // The acquisition picks every parameter up at once on its next step
+    this->m_parametersStale.store(true, std::memory_order_release);
+
     Fw::ParamValid isValid = Fw::ParamValid::INVALID;
     switch (id) {
         case PARAMID_PRESSURE_OVERSAMPLING: {
             const PressureOversampling oversampling = this->paramGet_PRESSURE_OVERSAMPLING(isValid);
             FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
             this->log_ACTIVITY_HI_PressureOversamplingUpdated(oversampling);
-            this->m_state = CONFIGURE;
+            this->reconfigure_devices();
             break;
         }
         case PARAMID_TEMPERATURE_OVERSAMPLING: {
             const TemperatureOversampling oversampling = this->paramGet_TEMPERATURE_OVERSAMPLING(isValid);
             FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
             this->log_ACTIVITY_HI_TemperatureOversamplingUpdated(oversampling);
-            this->m_state = CONFIGURE;
+            this->reconfigure_devices();
+            break;
+        }
+        case PARAMID_ACQUISITION_MODE: {
+            const AcquisitionMode mode = this->paramGet_ACQUISITION_MODE(isValid);
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_AcquisitionModeUpdated(mode);
+            this->reconfigure_devices();
+            break;
+        }
+        case PARAMID_STANDBY_TIME: {
+            const StandbyTime standby = this->paramGet_STANDBY_TIME(isValid);
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_StandbyTimeUpdated(standby);
+            this->reconfigure_devices();
+            break;
+        }
+        case PARAMID_IIR_FILTER: {
+            const IirFilter filter = this->paramGet_IIR_FILTER(isValid);
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_IirFilterUpdated(filter);
+            this->reconfigure_devices();
             break;
         }
         case PARAMID_SEA_LEVEL_PRESSURE:
             // Passive parameter, used in altitude calculation only
             break;
+        case PARAMID_ALTITUDE_METHOD: {
+            const AltitudeMethod method = this->paramGet_ALTITUDE_METHOD(isValid);
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_AltitudeMethodUpdated(method);
+            break;
+        }
+        case PARAMID_FILTER_MEDIAN_LENGTH:
+        case PARAMID_FILTER_BOXCAR_LENGTH:
+        case PARAMID_FILTER_IIR_ALPHA: {
+            const U8 medianLength = this->paramGet_FILTER_MEDIAN_LENGTH(isValid);
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            const U8 boxcarLength = this->paramGet_FILTER_BOXCAR_LENGTH(isValid);
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            const F32 iirAlpha = this->paramGet_FILTER_IIR_ALPHA(isValid);
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_FilterUpdated(medianLength, boxcarLength, iirAlpha);
+            break;
+        }
+        case PARAMID_OUTPUT_DECIMATION: {
+            const U32 decimation = this->paramGet_OUTPUT_DECIMATION(isValid);
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_OutputDecimationUpdated(decimation);
+            break;
+        }
+        case PARAMID_VERTICAL_PROCESS_NOISE:
+        case PARAMID_VERTICAL_MEASUREMENT_NOISE: {
+            const F32 processNoise = this->paramGet_VERTICAL_PROCESS_NOISE(isValid);
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            const F32 measurementNoise = this->paramGet_VERTICAL_MEASUREMENT_NOISE(isValid);
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_VerticalFilterUpdated(processNoise, measurementNoise);
+            break;
+        }
+        case PARAMID_ARRAY_SCHEDULING:
+            // Passive parameter, used in run scheduling only
+            break;
         default:
             FW_ASSERT(0, static_cast<FwAssertArgType>(id));
             break;
     }
 }
 
+void BmpManager ::parametersLoaded() {
+    this->m_parametersStale.store(true, std::memory_order_release);
+}
+
 void BmpManager ::run_handler(FwIndexType portNum, U32 context) {
-    switch (this->m_state) {
+    // The acquisition is queued to the component thread, the readings published are those it has taken so far
+    if (this->isConnected_acquireOut_OutputPort(0)) {
+        this->acquireOut_out(0, context);
+    } else if (!this->m_acquireDriven.load(std::memory_order_acquire)) {
+        // Until acquire is driven the bus is read inline, as when the rate group owned the whole acquisition
+        this->acquire_devices();
+        this->write_calibration_cache();
+    }
+    this->publish_readings();
+}
+
+void BmpManager ::acquire_handler(FwIndexType portNum, U32 context) {
+    this->m_acquireDriven.store(true, std::memory_order_release);
+    this->acquire_devices();
+    this->write_calibration_cache();
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for commands
+// ----------------------------------------------------------------------
+
+void BmpManager ::BURST_CAPTURE_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, U32 count, U32 rateDivisor) {
+    if ((count == 0) || (count > BURST_CAPACITY) || (rateDivisor == 0)) {
+        this->log_WARNING_LO_BurstCaptureInvalid(count, rateDivisor);
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+        return;
+    }
+    if (this->m_burstActive) {
+        this->log_WARNING_LO_BurstCaptureBusy();
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::BUSY);
+        return;
+    }
+    this->m_burstCount = count;
+    this->m_burstDivisor = rateDivisor;
+    this->m_burstFill = 0;
+    this->m_burstTick = 0;
+    this->m_burstActive = true;
+    this->log_ACTIVITY_HI_BurstCaptureStarted(count, rateDivisor);
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+void BmpManager ::BURST_ABORT_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
+    if (this->m_burstActive) {
+        this->m_burstActive = false;
+        this->log_ACTIVITY_HI_BurstCaptureAborted(this->m_burstFill);
+    }
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void BmpManager ::acquire_devices() {
+    // The calibration cache file is read ahead of the guard, only its records are loaded under it
+    U8 cache[MAX_DEVICES * CACHE_RECORD_SIZE];
+    const bool cachePending = this->m_cacheEnabled && !this->m_cacheLoaded.load(std::memory_order_acquire);
+    const bool cacheRead = cachePending && this->read_calibration_cache(cache);
+
+    // Commands and parameter updates share the device state, so the acquisition holds the guard for its whole step
+    this->lock();
+
+    // Parameters are read once after each update instead of taking the parameter lock several times per tick
+    if (this->m_parametersStale.exchange(false, std::memory_order_acq_rel)) {
+        this->refresh_parameters();
+    }
+
+    // Devices with cached calibration skip the reset, startup delay, and calibration read after a restart
+    if (cachePending && !this->m_cacheLoaded.exchange(true, std::memory_order_acq_rel) && cacheRead) {
+        this->load_calibration_cache(cache);
+    }
+
+    // Burst capture samples every conversion stored on ticks selected by the rate divisor
+    this->m_burstCaptureTick = this->m_burstActive && ((this->m_burstTick % this->m_burstDivisor) == 0);
+    this->m_burstTick++;
+
+    // Round-robin services a single device per tick, bursting services every device each tick
+    if (this->m_parameters.scheduling == ArrayScheduling::ROUND_ROBIN) {
+        FW_ASSERT(this->m_nextDevice < this->m_deviceCount, static_cast<FwAssertArgType>(this->m_nextDevice));
+        this->run_device(this->m_devices[this->m_nextDevice]);
+        this->m_nextDevice = (this->m_nextDevice + 1) % this->m_deviceCount;
+    } else {
+        for (FwSizeType i = 0; i < this->m_deviceCount; i++) {
+            this->run_device(this->m_devices[i]);
+        }
+    }
+    this->write_slot();
+
+    if (this->m_burstActive && (this->m_burstFill >= this->m_burstCount)) {
+        this->emit_burst();
+    }
+
+    this->unLock();
+}
+
+void BmpManager ::refresh_parameters() {
+    ParameterSnapshot& parameters = this->m_parameters;
+    Fw::ParamValid paramValid;
+    parameters.scheduling = this->paramGet_ARRAY_SCHEDULING(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    parameters.mode = this->paramGet_ACQUISITION_MODE(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    const PressureOversampling pressureOversampling = this->paramGet_PRESSURE_OVERSAMPLING(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    const TemperatureOversampling temperatureOversampling = this->paramGet_TEMPERATURE_OVERSAMPLING(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    const StandbyTime standby = this->paramGet_STANDBY_TIME(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    const IirFilter filter = this->paramGet_IIR_FILTER(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    const F32 seaLevelPressure = this->paramGet_SEA_LEVEL_PRESSURE(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    parameters.altitudeMethod = this->paramGet_ALTITUDE_METHOD(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    U8 medianLength = this->paramGet_FILTER_MEDIAN_LENGTH(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    U8 boxcarLength = this->paramGet_FILTER_BOXCAR_LENGTH(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    const F32 iirAlpha = this->paramGet_FILTER_IIR_ALPHA(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    const U32 decimation = this->paramGet_OUTPUT_DECIMATION(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    const F32 processNoise = this->paramGet_VERTICAL_PROCESS_NOISE(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    const F32 measurementNoise = this->paramGet_VERTICAL_MEASUREMENT_NOISE(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+
+    // CTRL_MEAS register (0xF4) format:
+    // bits 7:5 = osrs_t (temperature oversampling)
+    // bits 4:2 = osrs_p (pressure oversampling)
+    // bits 1:0 = mode (00=sleep, 01=forced, 11=normal)
+    parameters.oversampling = static_cast<U8>(temperature_oversampling_to_register(temperatureOversampling) |
+                                              pressure_oversampling_to_register(pressureOversampling));
+    parameters.config = config_to_register(standby, filter);
+    parameters.triggerFrame[0] = CTRL_MEAS_REGISTER & 0x7F;  // Clear MSB for write
+    parameters.triggerFrame[1] = static_cast<U8>(parameters.oversampling | FORCED_MODE);
+    parameters.conversionTimeUs = max_conversion_time_us(pressureOversampling, temperatureOversampling);
+
+    // Out of range values are clamped rather than rejected since parameters cannot carry bounds
+    const U8 maxLength = static_cast<U8>(FilterChain::MAX_LENGTH);
+    parameters.medianLength = (medianLength < 1) ? 1 : ((medianLength > maxLength) ? maxLength : medianLength);
+    parameters.boxcarLength = (boxcarLength < 1) ? 1 : ((boxcarLength > maxLength) ? maxLength : boxcarLength);
+    parameters.iirAlpha = ((iirAlpha > 0.0f) && (iirAlpha < 1.0f)) ? iirAlpha : 1.0f;
+    parameters.decimation = (decimation < 1) ? 1 : decimation;
+    const F32 minNoise = VerticalSpeedFilter::MIN_NOISE;
+    const F32 maxNoise = VerticalSpeedFilter::MAX_NOISE;
+    parameters.processNoise =
+        (processNoise > maxNoise) ? maxNoise : ((processNoise >= minNoise) ? processNoise : minNoise);
+    parameters.measurementNoise =
+        (measurementNoise > maxNoise) ? maxNoise : ((measurementNoise >= minNoise) ? measurementNoise : minNoise);
+
+    // Lookup table is only rebuilt when the sea level pressure differs from the one it was built with
+    this->m_altitudeEngine.set_sea_level_pressure(seaLevelPressure);
+}
+
+void BmpManager ::run_device(DeviceContext& device) {
+    switch (device.state) {
         case RESET:
             // If reset is successful, move to STARTUP_DELAY state
-            if (this->reset()) {
-                this->m_state = STARTUP_DELAY;
-                this->m_startupCounter = STARTUP_DELAY_CYCLES;
+            device.health.totalResets++;
+            if (this->reset(device)) {
+                device.state = STARTUP_DELAY;
+                device.startupCounter = STARTUP_DELAY_CYCLES;
             } else {
-                this->log_WARNING_HI_DeviceFailure();
+                this->fail_device(device, RESET);
+                this->log_WARNING_HI_DeviceFailure(static_cast<U8>(device.port));
+            }
+            break;
+
+        case BACKOFF:
+            // A device that keeps failing is left off the bus until its backoff expires
+            device.backoffCounter--;
+            if (device.backoffCounter == 0) {
+                device.state = device.resumeState;
             }
             break;
 
         case STARTUP_DELAY:
-            this->m_startupCounter--;
-            if (this->m_startupCounter <= 0) {
-                this->m_state = CHIP_ID_CHECK;
+            device.startupCounter--;
+            if (device.startupCounter <= 0) {
+                device.state = CHIP_ID_CHECK;
             }
             break;
 
         case CHIP_ID_CHECK: {
             U8 chip_id = 0;
-            bool success = this->read_chip_id(chip_id); 
+            bool success = this->read_chip_id(device, chip_id);
             if (success && chip_id == CHIP_ID_VALUE) {
-                this->m_state = CALIBRATION_READ;
+                device.state = CALIBRATION_READ;
             } else {
-                this->m_state = RESET;
-                this->log_WARNING_HI_ChipIdCheckFailure();
+                this->fail_device(device, RESET);
+                this->log_WARNING_HI_ChipIdCheckFailure(static_cast<U8>(device.port));
             }
             break;
         }
         case CALIBRATION_READ:
-            if (this->read_calibration_data()) {
-                this->m_state = CONFIGURE;
+            if (this->read_calibration_data(device)) {
+                device.state = CONFIGURE;
+                this->store_calibration_cache(device);
             } else {
-                this->m_state = RESET;
-                this->log_WARNING_HI_CalibrationFailure();
+                this->fail_device(device, RESET);
+                this->log_WARNING_HI_CalibrationFailure(static_cast<U8>(device.port));
             }
             break;
         case CONFIGURE:
-            if (this->configure_device()) {
-                this->m_state = RUNNING;
+            this->configure_and_run(device);
+            break;
+        case RECOVER: {
+            // Fast recovery: a matching chip id shows the device kept its trim, so configure with the known
+            // calibration in the same tick. Any failure falls back to the full reset sequence.
+            U8 chip_id = 0;
+            bool success = this->read_chip_id(device, chip_id);
+            if (success && (chip_id == CHIP_ID_VALUE) && device.calibrationValid) {
+                this->configure_and_run(device);
             } else {
-                this->m_state = RESET;
-                this->log_WARNING_HI_DeviceConfigureFailure();
+                this->fail_device(device, RESET);
+                this->log_WARNING_HI_ChipIdCheckFailure(static_cast<U8>(device.port));
             }
             break;
+        }
         case RUNNING: {
-            // Reset throttles for logged events
-            this->log_WARNING_HI_DeviceFailure_ThrottleClear();       // Clear throttle for Device Failure event
-            this->log_WARNING_HI_ChipIdCheckFailure_ThrottleClear();  // Clear throttle for Chip ID Check Failure event
-            this->log_WARNING_HI_CalibrationFailure_ThrottleClear();  // Clear throttle for Data Calibration Failure
-                                                                      // event
-            this->log_WARNING_HI_DeviceConfigureFailure_ThrottleClear();  // Clear throttle for Device Configure Failure
-                                                                          // event
-            // Step 1: Check if measurement is ready
-            U8 status = 0;
-            if (!this->read_status(status)) {
-                this->m_state = RESET;
+            const AcquisitionMode mode = this->m_parameters.mode;
+
+            // Pipelined mode: conversions are triggered at the end of a tick and read on a later tick
+            if (mode == AcquisitionMode::PIPELINED) {
+                this->run_pipelined(device);
                 break;
             }
 
-            // Check if measurement is in progress (bit 3) or if data is being updated (bit 0)
-            if ((status & 0x08) || (status & 0x01)) {
-                break;  // Wait for next cycle
+            // Forced mode: the device sleeps between conversions and each tick must trigger the next one
+            if (mode == AcquisitionMode::FORCED) {
+                // Step 1: Check if measurement is ready
+                U8 status = 0;
+                if (!this->read_status(device, status)) {
+                    this->enter_recovery(device);
+                    break;
+                }
+
+                // Reserved status bits read as zero, any set means the bus returned garbage (e.g. 0xFF)
+                if (status & ~(STATUS_MEASURING | STATUS_IM_UPDATE)) {
+                    this->enter_recovery(device);
+                    this->log_WARNING_HI_DeviceReadFailure(static_cast<U8>(device.port));
+                    break;
+                }
+
+                // Check if measurement is in progress (bit 3) or if data is being updated (bit 0)
+                if ((status & STATUS_MEASURING) || (status & STATUS_IM_UPDATE)) {
+                    break;  // Wait for next cycle
+                }
+
+                // Step 2: Trigger a new measurement in forced mode
+                if (!this->trigger_measurement(device)) {
+                    this->enter_recovery(device);
+                    this->log_WARNING_HI_MeasurementTriggerFailure(static_cast<U8>(device.port));
+                    break;
+                }
             }
+            // Normal mode: the device free-runs and the data registers are shadowed, so a burst read always returns
+            // the last complete conversion without any status polling or triggering
 
-            // Step 2: Trigger a new measurement in forced mode
-            if (!this->trigger_measurement()) {
-                this->m_state = RESET;
-                this->log_WARNING_HI_MeasurementTriggerFailure();
-                break;
+            // Step 3: Read measurement data
+            RawBmpData raw;
+            if (this->read_measurement(device, raw)) {
+                this->store_measurement(device, raw);
+            } else {
+                this->enter_recovery(device);
+                this->log_WARNING_HI_DeviceReadFailure(static_cast<U8>(device.port));
             }
+            break;
+        }
+        default:
+            FW_ASSERT(0, static_cast<FwAssertArgType>(device.state));
+            break;
+    }
+}
 
-            // Step 3: Read measurement data
-            // BMP280 SPI protocol: read 6 bytes starting from PRESSURE_MSB_REGISTER
-            U8 spiData[MEASUREMENT_DATA_LENGTH + 1] = {0};
-            spiData[0] = PRESSURE_MSB_REGISTER | 0x80;  // Register address with MSB=1 for read
+void BmpManager ::configure_and_run(DeviceContext& device) {
+    if (this->configure_device(device)) {
+        device.state = RUNNING;
+        device.triggerPending = false;  // Any previously triggered conversion used the old configuration
+        // Filter history predates the new configuration
+        device.pressureFilter.reset();
+        device.temperatureFilter.reset();
+        device.verticalFilter.reset();
+        device.decimationCount = 0;
+    } else {
+        this->fail_device(device, RESET);
+        this->log_WARNING_HI_DeviceConfigureFailure(static_cast<U8>(device.port));
+    }
+}
 
-            Fw::Buffer writeBuffer(spiData, MEASUREMENT_DATA_LENGTH + 1);
-            Fw::Buffer readBuffer(spiData, MEASUREMENT_DATA_LENGTH + 1);
+void BmpManager ::enter_recovery(DeviceContext& device) {
+    // Without known calibration there is nothing to shortcut, go through the full sequence
+    this->fail_device(device, device.calibrationValid ? RECOVER : RESET);
+}
 
-            if (this->spi_transfer(writeBuffer, readBuffer)) {
-                // Skip first byte (register echo) and deserialize measurement data directly
-                U8* dataPtr = &readBuffer.getData()[1];
-                Fw::Buffer dataBuffer(dataPtr, MEASUREMENT_DATA_LENGTH);
-                RawBmpData raw = this->deserialize_raw_data(dataBuffer);
+void BmpManager ::fail_device(DeviceContext& device, BmpState resumeState) {
+    device.health.consecutiveFailures++;
+    const U32 failures = device.health.consecutiveFailures;
+    if (failures <= MAX_RESET_ATTEMPTS) {
+        device.state = resumeState;
+        return;
+    }
 
-                // Get sea level pressure parameter
-                Fw::ParamValid paramValid;
-                F32 seaLevelPressure = this->paramGet_SEA_LEVEL_PRESSURE(paramValid);
-                FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    // A device that keeps failing is retried ever less often, such that an absent sensor costs almost no bus time
+    const U32 excess = failures - MAX_RESET_ATTEMPTS;
+    const U32 exponent = (excess < MAX_BACKOFF_EXPONENT) ? excess : MAX_BACKOFF_EXPONENT;
+    device.backoffCounter = static_cast<U32>(1) << exponent;
+    device.resumeState = resumeState;
+    device.state = BACKOFF;
+    if (excess == 1) {
+        this->log_WARNING_HI_DeviceUnresponsive(static_cast<U8>(device.port), failures);
+    }
+}
 
-                const Bmp280Data bmpData = this->convert_raw_data(raw, this->m_calibration, seaLevelPressure);
+void BmpManager ::reconfigure_devices() {
+    // Parameters are updated from the command thread while the acquisition may be stepping the devices
+    this->lock();
+    // Devices that have not reached RUNNING pick up the new parameters when they pass through CONFIGURE
+    for (FwSizeType i = 0; i < this->m_deviceCount; i++) {
+        if (this->m_devices[i].state == RUNNING) {
+            this->m_devices[i].state = CONFIGURE;
+        }
+    }
+    this->unLock();
+}
 
-                this->tlmWrite_Reading(bmpData);
+void BmpManager ::write_slot() {
+    ReadingSlot& slot = this->m_slots[this->m_slotBack];
+    U8 runningMask = 0;
+    for (FwSizeType i = 0; i < this->m_deviceCount; i++) {
+        DeviceContext& device = this->m_devices[i];
+        // Time in state is measured from the first acquisition that left the device in its current state
+        if ((device.state != device.health.state) || (device.health.stateTime == Fw::ZERO_TIME)) {
+            device.health.state = device.state;
+            device.health.stateTime = this->getTime();
+        }
+        slot.readings[i] = device.reading;
+        slot.verticals[i] = device.vertical;
+        slot.readingTimes[i] = device.readingTime;
+        slot.readingCounts[i] = device.readingCount;
+        slot.health[i] = device.health;
+        if (device.state == RUNNING) {
+            runningMask |= static_cast<U8>(1 << i);
+        }
+    }
+    slot.runningMask = runningMask;
+
+    // Release makes the slot contents visible with its index, the slot the reader released becomes the next back slot
+    const U8 previous = this->m_slotShared.exchange(static_cast<U8>(this->m_slotBack | SLOT_FRESH),
+                                                    std::memory_order_acq_rel);
+    this->m_slotBack = static_cast<U8>(previous & ~SLOT_FRESH);
+
+    // Reset throttles for logged events once every device is healthy
+    if (runningMask == static_cast<U8>((1 << this->m_deviceCount) - 1)) {
+        this->log_WARNING_HI_DeviceFailure_ThrottleClear();
+        this->log_WARNING_HI_ChipIdCheckFailure_ThrottleClear();
+        this->log_WARNING_HI_CalibrationFailure_ThrottleClear();
+        this->log_WARNING_HI_DeviceConfigureFailure_ThrottleClear();
+        this->log_WARNING_HI_MeasurementTriggerFailure_ThrottleClear();
+        this->log_WARNING_HI_DeviceReadFailure_ThrottleClear();
+    }
+}
 
-                this->log_WARNING_HI_MeasurementTriggerFailure_ThrottleClear();  // Clear throttle for Measurement
-                                                                                 // Trigger Failure event
-                this->log_WARNING_HI_DeviceReadFailure_ThrottleClear();  // Clear throttle for read Failure event
+const BmpManager::ReadingSlot& BmpManager ::read_slot() {
+    // Without a newer slot the front slot is read again, so the reader never waits on the writer
+    if ((this->m_slotShared.load(std::memory_order_relaxed) & SLOT_FRESH) != 0) {
+        const U8 previous = this->m_slotShared.exchange(this->m_slotFront, std::memory_order_acq_rel);
+        this->m_slotFront = static_cast<U8>(previous & ~SLOT_FRESH);
+    }
+    return this->m_slots[this->m_slotFront];
+}
 
-            } else {
-                this->m_state = RESET;
-                this->log_WARNING_HI_DeviceReadFailure();
+void BmpManager ::publish_readings() {
+    const ReadingSlot& slot = this->read_slot();
+    Bmp280DataArray readings;
+    bool primaryFound = false;
+    bool anyFresh = false;
+    for (FwSizeType i = 0; i < this->m_deviceCount; i++) {
+        const bool fresh = (slot.readingCounts[i] != this->m_publishedCounts[i]);
+        this->m_publishedCounts[i] = slot.readingCounts[i];
+        readings[i] = slot.readings[i];
+        anyFresh = anyFresh || fresh;
+        if ((slot.runningMask & (1 << i)) == 0) {
+            continue;
+        }
+        // The lowest running device is the primary reporting on the Reading channel
+        if (!primaryFound) {
+            primaryFound = true;
+            if (fresh) {
+                this->tlmWrite_Reading(slot.readings[i], slot.readingTimes[i]);
+                this->tlmWrite_Vertical(slot.verticals[i], slot.readingTimes[i]);
             }
-            break;
         }
-        default:
-            FW_ASSERT(0, this->m_state);
-            break;
     }
+    // Packed array reports every device at once when more than one device is configured
+    if (anyFresh && (this->m_deviceCount > 1)) {
+        this->tlmWrite_Readings(readings);
+    }
+    if (slot.runningMask != this->m_runningMask) {
+        this->m_runningMask = slot.runningMask;
+        this->tlmWrite_RunningDevices(slot.runningMask);
+    }
+    this->publish_health(slot);
 }
 
-// ----------------------------------------------------------------------
-// Helper functions
-// ----------------------------------------------------------------------
+void BmpManager ::publish_health(const ReadingSlot& slot) {
+    // Ages change on every tick, so health is published on the first tick of each second rather than on change
+    const Fw::Time now = this->getTime();
+    if (now.getSeconds() == this->m_healthSeconds) {
+        return;
+    }
+    this->m_healthSeconds = now.getSeconds();
+
+    static_assert(static_cast<U8>(BACKOFF) == static_cast<U8>(Bmp280State::BACKOFF),
+                  "BmpState must follow the order of Bmp280State");
+    Bmp280HealthArray health;
+    for (FwSizeType i = 0; i < this->m_deviceCount; i++) {
+        const DeviceHealth& device = slot.health[i];
+        health[i].set(static_cast<Bmp280State::T>(device.state), elapsed_ms(device.stateTime, now),
+                      elapsed_ms(device.sampleTime, now), device.consecutiveFailures, device.totalResets);
+    }
+    this->tlmWrite_Health(health, now);
+}
 
-bool BmpManager ::reset() {
+bool BmpManager ::reset(DeviceContext& device) {
     U8 reset_sequence[] = {RESET_REGISTER & 0x7F, RESET_VALUE};  // Clear MSB for write
     Fw::Buffer writeBuffer(reset_sequence, sizeof(reset_sequence));
     Fw::Buffer readBuffer(reset_sequence, sizeof(reset_sequence));
-    bool success = this->spi_transfer(writeBuffer, readBuffer);
+    bool success = this->spi_transfer(device, writeBuffer, readBuffer);
     return success;
 }
 
-bool BmpManager ::read_chip_id(U8& id) {
+bool BmpManager ::read_chip_id(DeviceContext& device, U8& id) {
     U8 spiData[2] = {CHIP_ID_REGISTER | 0x80, 0x00};  // Ensure MSB is set for read
 
     Fw::Buffer writeBuffer(spiData, 2);
     Fw::Buffer readBuffer(spiData, 2);  // Reuse same buffer for read
 
-    bool success = this->spi_transfer(writeBuffer, readBuffer);
+    bool success = this->spi_transfer(device, writeBuffer, readBuffer);
 
     if (success) {
         id = readBuffer.getData()[1];
@@ -187,13 +662,13 @@ bool BmpManager ::read_chip_id(U8& id) {
     return success;
 }
 
-bool BmpManager ::read_status(U8& status) {
+bool BmpManager ::read_status(DeviceContext& device, U8& status) {
     U8 spiData[2] = {STATUS_REGISTER | 0x80, 0x00};  // Ensure MSB is set for read
 
     Fw::Buffer writeBuffer(spiData, 2);
     Fw::Buffer readBuffer(spiData, 2);
 
-    bool success = this->spi_transfer(writeBuffer, readBuffer);
+    bool success = this->spi_transfer(device, writeBuffer, readBuffer);
 
     if (success) {
         status = readBuffer.getData()[1];
@@ -204,7 +679,7 @@ bool BmpManager ::read_status(U8& status) {
     return success;
 }
 
-bool BmpManager ::read_calibration_data() {
+bool BmpManager ::read_calibration_data(DeviceContext& device) {
     U8 spiData[CALIB_DATA_LENGTH + 1];
     spiData[0] = CALIB_DATA_REGISTER | 0x80;  // Register address with MSB=1 for read
     for (U32 i = 1; i <= CALIB_DATA_LENGTH; i++) {
@@ -214,79 +689,265 @@ bool BmpManager ::read_calibration_data() {
     Fw::Buffer writeBuffer(spiData, CALIB_DATA_LENGTH + 1);
     Fw::Buffer readBuffer(spiData, CALIB_DATA_LENGTH + 1);
 
-    if (this->spi_transfer(writeBuffer, readBuffer)) {
+    if (this->spi_transfer(device, writeBuffer, readBuffer)) {
         U8* data = &readBuffer.getData()[1];
-
-        m_calibration.dig_T1 = (static_cast<U16>(data[1]) << 8) | data[0];
-        m_calibration.dig_T2 = (static_cast<I16>(data[3]) << 8) | data[2];
-        m_calibration.dig_T3 = (static_cast<I16>(data[5]) << 8) | data[4];
-
-        m_calibration.dig_P1 = (static_cast<U16>(data[7]) << 8) | data[6];
-        m_calibration.dig_P2 = (static_cast<I16>(data[9]) << 8) | data[8];
-        m_calibration.dig_P3 = (static_cast<I16>(data[11]) << 8) | data[10];
-        m_calibration.dig_P4 = (static_cast<I16>(data[13]) << 8) | data[12];
-        m_calibration.dig_P5 = (static_cast<I16>(data[15]) << 8) | data[14];
-        m_calibration.dig_P6 = (static_cast<I16>(data[17]) << 8) | data[16];
-        m_calibration.dig_P7 = (static_cast<I16>(data[19]) << 8) | data[18];
-        m_calibration.dig_P8 = (static_cast<I16>(data[21]) << 8) | data[20];
-        m_calibration.dig_P9 = (static_cast<I16>(data[23]) << 8) | data[22];
-
+        for (U32 i = 0; i < CALIB_DATA_LENGTH; i++) {
+            device.calibrationBytes[i] = data[i];
+        }
+        device.calibration = parse_calibration(device.calibrationBytes);
+        device.calibrationValid = true;
         return true;
     }
     return false;
 }
 
-bool BmpManager ::configure_device() {
-    Fw::ParamValid paramValid;
-    const PressureOversampling pressureOversampling = this->paramGet_PRESSURE_OVERSAMPLING(paramValid);
-    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
-    const TemperatureOversampling temperatureOversampling = this->paramGet_TEMPERATURE_OVERSAMPLING(paramValid);
-    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+BmpManager::CalibrationData BmpManager ::parse_calibration(const U8* data) {
+    CalibrationData calibration;
+    calibration.dig_T1 = (static_cast<U16>(data[1]) << 8) | data[0];
+    calibration.dig_T2 = (static_cast<I16>(data[3]) << 8) | data[2];
+    calibration.dig_T3 = (static_cast<I16>(data[5]) << 8) | data[4];
+
+    calibration.dig_P1 = (static_cast<U16>(data[7]) << 8) | data[6];
+    calibration.dig_P2 = (static_cast<I16>(data[9]) << 8) | data[8];
+    calibration.dig_P3 = (static_cast<I16>(data[11]) << 8) | data[10];
+    calibration.dig_P4 = (static_cast<I16>(data[13]) << 8) | data[12];
+    calibration.dig_P5 = (static_cast<I16>(data[15]) << 8) | data[14];
+    calibration.dig_P6 = (static_cast<I16>(data[17]) << 8) | data[16];
+    calibration.dig_P7 = (static_cast<I16>(data[19]) << 8) | data[18];
+    calibration.dig_P8 = (static_cast<I16>(data[21]) << 8) | data[20];
+    calibration.dig_P9 = (static_cast<I16>(data[23]) << 8) | data[22];
+    return calibration;
+}
 
-    // CTRL_MEAS register (0xF4) format:
-    // bits 7:5 = osrs_t (temperature oversampling)
-    // bits 4:2 = osrs_p (pressure oversampling)
-    // bits 1:0 = mode (00=sleep, 01=forced, 11=normal)
-    U8 ctrl_meas_value = (static_cast<U8>(temperatureOversampling) << 5) |
-                         (static_cast<U8>(pressureOversampling) << 2) | 0x00;  // Start in sleep mode first
+bool BmpManager ::configure_device(DeviceContext& device) {
+    const ParameterSnapshot& parameters = this->m_parameters;
+    const U8 oversampling_value = parameters.oversampling;
 
-    U8 config_sequence[] = {CTRL_MEAS_REGISTER & 0x7F, ctrl_meas_value};  // Clear MSB for write
+    // CONFIG register (0xF5) writes may be ignored in normal mode, so the device is put to sleep first. Both
+    // registers are written in a single transaction using SPI multi-byte write (address/data pairs).
+    U8 config_sequence[] = {CTRL_MEAS_REGISTER & 0x7F, static_cast<U8>(oversampling_value | SLEEP_MODE),
+                            CONFIG_REGISTER & 0x7F, parameters.config};  // Clear MSB for write
     Fw::Buffer writeBuffer(config_sequence, sizeof(config_sequence));
     Fw::Buffer readBuffer(config_sequence, sizeof(config_sequence));
 
-    bool success = this->spi_transfer(writeBuffer, readBuffer);
+    bool success = this->spi_transfer(device, writeBuffer, readBuffer);
 
-    if (success) {
-        U8 config_value = 0x00;                                         // No IIR filter, 4-wire SPI
-        U8 config_sequence[] = {CONFIG_REGISTER & 0x7F, config_value};  // Clear MSB for write
-        Fw::Buffer configWriteBuffer(config_sequence, sizeof(config_sequence));
-        Fw::Buffer configReadBuffer(config_sequence, sizeof(config_sequence));
+    // Normal mode starts the free-running conversions now, forced mode remains asleep until triggered
+    if (success && (parameters.mode == AcquisitionMode::NORMAL)) {
+        U8 mode_sequence[] = {CTRL_MEAS_REGISTER & 0x7F, static_cast<U8>(oversampling_value | NORMAL_MODE)};
+        Fw::Buffer modeWriteBuffer(mode_sequence, sizeof(mode_sequence));
+        Fw::Buffer modeReadBuffer(mode_sequence, sizeof(mode_sequence));
 
-        success = this->spi_transfer(configWriteBuffer, configReadBuffer);
+        success = this->spi_transfer(device, modeWriteBuffer, modeReadBuffer);
     }
 
     return success;
 }
 
-bool BmpManager ::trigger_measurement() {
-    Fw::ParamValid paramValid;
-    const PressureOversampling pressureOversampling = this->paramGet_PRESSURE_OVERSAMPLING(paramValid);
-    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
-    const TemperatureOversampling temperatureOversampling = this->paramGet_TEMPERATURE_OVERSAMPLING(paramValid);
-    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
-
-    // Set device to forced mode to trigger a measurement
-    U8 ctrl_meas_value =
-        (static_cast<U8>(temperatureOversampling) << 5) | (static_cast<U8>(pressureOversampling) << 2) | FORCED_MODE;
-
-    // For SPI writes, register address MSB must be 0
-    U8 config_sequence[] = {CTRL_MEAS_REGISTER & 0x7F, ctrl_meas_value};  // Clear MSB for write
+bool BmpManager ::trigger_measurement(DeviceContext& device) {
+    // Frame is prebuilt with the parameters and copied since the driver reads back into the same buffer
+    const U8* triggerFrame = this->m_parameters.triggerFrame;
+    U8 config_sequence[] = {triggerFrame[0], triggerFrame[1]};
     Fw::Buffer writeBuffer(config_sequence, sizeof(config_sequence));
     Fw::Buffer readBuffer(config_sequence, sizeof(config_sequence));
-    return this->spi_transfer(writeBuffer, readBuffer);
+    return this->spi_transfer(device, writeBuffer, readBuffer);
 }
 
-bool BmpManager ::spi_transfer(Fw::Buffer& writeBuffer, Fw::Buffer& readBuffer) {
+bool BmpManager ::read_measurement(DeviceContext& device, RawBmpData& raw) {
+    // BMP280 SPI protocol: read 6 bytes starting from PRESSURE_MSB_REGISTER
+    U8 spiData[MEASUREMENT_DATA_LENGTH + 1] = {0};
+    spiData[0] = PRESSURE_MSB_REGISTER | 0x80;  // Register address with MSB=1 for read
+
+    Fw::Buffer writeBuffer(spiData, MEASUREMENT_DATA_LENGTH + 1);
+    Fw::Buffer readBuffer(spiData, MEASUREMENT_DATA_LENGTH + 1);
+
+    bool success = this->spi_transfer(device, writeBuffer, readBuffer);
+    if (success) {
+        // Skip first byte (register echo) and deserialize measurement data directly
+        U8* dataPtr = &readBuffer.getData()[1];
+        Fw::Buffer dataBuffer(dataPtr, MEASUREMENT_DATA_LENGTH);
+        raw = this->deserialize_raw_data(dataBuffer);
+
+        // All zeros or all ones are what a stuck or floating MISO line reads, never a real conversion
+        if ((raw.pressure == RAW_STUCK_LOW) || (raw.pressure == RAW_STUCK_HIGH) ||
+            (raw.temperature == RAW_STUCK_LOW) || (raw.temperature == RAW_STUCK_HIGH)) {
+            success = false;
+        }
+    }
+    return success;
+}
+
+void BmpManager ::run_pipelined(DeviceContext& device) {
+    if (device.triggerPending) {
+        const U32 conversionTime = this->m_parameters.conversionTimeUs;
+
+        // Conversion cannot have finished yet, wait for a later tick instead of polling the status register
+        if (this->elapsed_us(device.triggerTime) < conversionTime) {
+            return;
+        }
+
+        RawBmpData raw;
+        if (!this->read_measurement(device, raw)) {
+            this->enter_recovery(device);
+            this->log_WARNING_HI_DeviceReadFailure(static_cast<U8>(device.port));
+            return;
+        }
+        device.triggerPending = false;
+
+        // The sample represents the conversion window, so it is stamped at the middle of that window
+        Fw::Time sampleTime = device.triggerTime;
+        if (sampleTime != Fw::ZERO_TIME) {
+            sampleTime = Fw::Time::add(sampleTime, Fw::Time(sampleTime.getTimeBase(), 0, conversionTime / 2));
+        }
+        this->store_measurement(device, raw, sampleTime);
+    }
+
+    // Trigger last such that the conversion runs between this tick and the next
+    if (!this->trigger_measurement(device)) {
+        this->enter_recovery(device);
+        this->log_WARNING_HI_MeasurementTriggerFailure(static_cast<U8>(device.port));
+        return;
+    }
+    device.triggerTime = this->getTime();
+    device.triggerPending = true;
+}
+
+U32 BmpManager ::elapsed_us(const Fw::Time& since) {
+    return elapsed_us(since, this->getTime());
+}
+
+U32 BmpManager ::elapsed_us(const Fw::Time& since, const Fw::Time& now) {
+    // Without a time source every tick is assumed to be long enough for a conversion
+    if (since == Fw::ZERO_TIME) {
+        return std::numeric_limits<U32>::max();
+    }
+    switch (Fw::Time::compare(now, since)) {
+        case Fw::Time::GT: {
+            const Fw::Time delta = Fw::Time::sub(now, since);
+            if (delta.getSeconds() >= (std::numeric_limits<U32>::max() / 1000000)) {
+                return std::numeric_limits<U32>::max();
+            }
+            return (delta.getSeconds() * 1000000) + delta.getUSeconds();
+        }
+        case Fw::Time::EQ:
+            return 0;
+        // Time base changed or time jumped backwards, do not stall the pipeline
+        default:
+            return std::numeric_limits<U32>::max();
+    }
+}
+
+U32 BmpManager ::elapsed_ms(const Fw::Time& since, const Fw::Time& now) {
+    if (since == Fw::ZERO_TIME) {
+        return std::numeric_limits<U32>::max();
+    }
+    switch (Fw::Time::compare(now, since)) {
+        case Fw::Time::GT: {
+            const Fw::Time delta = Fw::Time::sub(now, since);
+            if (delta.getSeconds() >= (std::numeric_limits<U32>::max() / 1000)) {
+                return std::numeric_limits<U32>::max();
+            }
+            return (delta.getSeconds() * 1000) + (delta.getUSeconds() / 1000);
+        }
+        case Fw::Time::EQ:
+            return 0;
+        // Time base changed or time jumped backwards, the age is unknown
+        default:
+            return std::numeric_limits<U32>::max();
+    }
+}
+
+void BmpManager ::store_measurement(DeviceContext& device, const RawBmpData& raw, Fw::Time sampleTime) {
+    // A sample is the only proof of a healthy device, reaching RUNNING alone does not clear the failures
+    if (device.health.consecutiveFailures > MAX_RESET_ATTEMPTS) {
+        this->log_ACTIVITY_HI_DeviceRecovered(static_cast<U8>(device.port), device.health.consecutiveFailures);
+    }
+    device.health.consecutiveFailures = 0;
+
+    const ParameterSnapshot& parameters = this->m_parameters;
+    const AltitudeMethod method = parameters.altitudeMethod;
+    Bmp280Data reading = this->convert_raw_data(raw, device.calibration, this->m_altitudeEngine, method);
+    const F32 altitude = reading.get_altitude();
+
+    // Filter history is only cleared when the filter parameters change
+    device.pressureFilter.configure(parameters.medianLength, parameters.boxcarLength, parameters.iirAlpha);
+    device.temperatureFilter.configure(parameters.medianLength, parameters.boxcarLength, parameters.iirAlpha);
+    if (!device.pressureFilter.is_passthrough()) {
+        const F32 pressure = device.pressureFilter.update(reading.get_pressure());
+        reading.set_pressure(pressure);
+        reading.set_temperature(device.temperatureFilter.update(reading.get_temperature()));
+        reading.set_altitude(calculate_altitude(this->m_altitudeEngine, method, pressure));
+    }
+
+    // Readings are stamped when acquired, which may be well before the run port publishes them
+    if (sampleTime == Fw::ZERO_TIME) {
+        sampleTime = this->getTime();
+    }
+
+    // Vertical speed tracks every sample ahead of the filter chain, whose smoothing would only add lag. The period
+    // is measured from the previous sample, so a gap or a missing time source restarts the filter.
+    device.verticalFilter.configure(parameters.processNoise, parameters.measurementNoise);
+    device.verticalFilter.update(altitude, elapsed_us(device.health.sampleTime, sampleTime));
+    device.health.sampleTime = sampleTime;
+
+    // Every sample passes through the filters, only every decimation-th filtered sample is published
+    device.decimationCount++;
+    if (device.decimationCount >= parameters.decimation) {
+        device.decimationCount = 0;
+        device.reading = reading;
+        device.vertical.set(device.verticalFilter.get_altitude(), device.verticalFilter.get_speed());
+        device.readingTime = sampleTime;
+        device.readingCount++;
+    }
+
+    if (this->m_burstCaptureTick) {
+        this->capture_sample(device, raw, sampleTime);
+    }
+}
+
+void BmpManager ::capture_sample(const DeviceContext& device, const RawBmpData& raw, const Fw::Time& sampleTime) {
+    if (this->m_burstFill >= this->m_burstCount) {
+        return;
+    }
+    FW_ASSERT(this->m_burstFill < BURST_CAPACITY, static_cast<FwAssertArgType>(this->m_burstFill));
+    this->m_burstSamples[this->m_burstFill++].set(static_cast<U8>(device.port), sampleTime.getSeconds(),
+                                                  sampleTime.getUSeconds(), raw.pressure, raw.temperature);
+}
+
+void BmpManager ::emit_burst() {
+    this->m_burstActive = false;
+
+    // Calibration of every device leads the raw samples such that the product is self-contained
+    const FwSizeType dataSize = (this->m_deviceCount * DpContainer::SIZE_OF_Calibration_RECORD) +
+                                (static_cast<FwSizeType>(this->m_burstFill) * DpContainer::SIZE_OF_RawSample_RECORD);
+    DpContainer container;
+    // Deployments without a data product manager connected lose the burst rather than asserting
+    const bool connected =
+        this->isConnected_productGetOut_OutputPort(0) && this->isConnected_productSendOut_OutputPort(0);
+    const Fw::Success::T status = connected ? this->dpGet_Burst(dataSize, container) : Fw::Success::FAILURE;
+    if (status != Fw::Success::SUCCESS) {
+        this->log_WARNING_HI_BurstProductFailure(this->m_burstFill);
+        return;
+    }
+
+    Fw::SerializeStatus serializeStatus = Fw::FW_SERIALIZE_OK;
+    for (FwSizeType i = 0; i < this->m_deviceCount; i++) {
+        const CalibrationData& calib = this->m_devices[i].calibration;
+        const Bmp280Calibration record(static_cast<U8>(this->m_devices[i].port), calib.dig_T1, calib.dig_T2,
+                                       calib.dig_T3, calib.dig_P1, calib.dig_P2, calib.dig_P3, calib.dig_P4,
+                                       calib.dig_P5, calib.dig_P6, calib.dig_P7, calib.dig_P8, calib.dig_P9);
+        serializeStatus = container.serializeRecord_Calibration(record);
+        FW_ASSERT(serializeStatus == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(serializeStatus));
+    }
+    for (U32 i = 0; i < this->m_burstFill; i++) {
+        serializeStatus = container.serializeRecord_RawSample(this->m_burstSamples[i]);
+        FW_ASSERT(serializeStatus == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(serializeStatus));
+    }
+    this->dpSend(container);
+    this->log_ACTIVITY_HI_BurstCaptureComplete(this->m_burstFill);
+}
+
+bool BmpManager ::spi_transfer(DeviceContext& device, Fw::Buffer& writeBuffer, Fw::Buffer& readBuffer) {
     // Validate buffer sizes
     FW_ASSERT(writeBuffer.getSize() != 0);
 
@@ -296,7 +957,7 @@ bool BmpManager ::spi_transfer(Fw::Buffer& writeBuffer, Fw::Buffer& readBuffer)
 
     // Perform the SPI transfer
     // Note: spiReadWrite_out calls the underlying SPI driver
-    this->spiReadWrite_out(0, writeBuffer, readBuffer);
+    this->spiReadWrite_out(device.port, writeBuffer, readBuffer);
 
     // Linux SPI driver logs warnings internally if ioctl fails
     return true;
@@ -327,39 +988,9 @@ BmpManager::RawBmpData BmpManager ::deserialize_raw_data(Fw::Buffer& buffer) {
 Bmp280Data BmpManager ::convert_raw_data(const RawBmpData& raw, const CalibrationData& calib, F32 seaLevelPressure) {
     Bmp280Data bmpData;
 
-    // BMP280 Temperature Compensation (from datasheet)
-    // Returns temperature in DegC, resolution is 0.01 DegC
-    I32 adc_T = static_cast<I32>(raw.temperature);
-    I32 var1, var2, t_fine;
-    var1 = ((((adc_T >> 3) - (static_cast<I32>(calib.dig_T1) << 1))) * static_cast<I32>(calib.dig_T2)) >> 11;
-    var2 =
-        (((((adc_T >> 4) - static_cast<I32>(calib.dig_T1)) * ((adc_T >> 4) - static_cast<I32>(calib.dig_T1))) >> 12) *
-         static_cast<I32>(calib.dig_T3)) >>
-        14;
-    t_fine = var1 + var2;
-    F32 temperature = static_cast<F32>((t_fine * 5 + 128) >> 8) / 100.0f;
-
-    // BMP280 Pressure Compensation (from datasheet)
-    // Returns pressure in Pa as unsigned 32 bit integer
-    I32 adc_P = static_cast<I32>(raw.pressure);
-    I64 var1_64, var2_64, p_64;
-    var1_64 = static_cast<I64>(t_fine) - 128000;
-    var2_64 = var1_64 * var1_64 * static_cast<I64>(calib.dig_P6);
-    var2_64 = var2_64 + ((var1_64 * static_cast<I64>(calib.dig_P5)) << 17);
-    var2_64 = var2_64 + (static_cast<I64>(calib.dig_P4) << 35);
-    var1_64 = ((var1_64 * var1_64 * static_cast<I64>(calib.dig_P3)) >> 8) +
-              ((var1_64 * static_cast<I64>(calib.dig_P2)) << 12);
-    var1_64 = (((static_cast<I64>(1) << 47) + var1_64)) * static_cast<I64>(calib.dig_P1) >> 33;
-
-    F32 pressure = 0.0f;
-    if (var1_64 != 0) {
-        p_64 = 1048576 - adc_P;
-        p_64 = (((p_64 << 31) - var2_64) * 3125) / var1_64;
-        var1_64 = (static_cast<I64>(calib.dig_P9) * (p_64 >> 13) * (p_64 >> 13)) >> 25;
-        var2_64 = (static_cast<I64>(calib.dig_P8) * p_64) >> 19;
-        p_64 = ((p_64 + var1_64 + var2_64) >> 8) + (static_cast<I64>(calib.dig_P7) << 4);
-        pressure = static_cast<F32>(p_64) / 256.0f;
-    }
+    const I32 t_fine = compensate_t_fine(static_cast<I32>(raw.temperature), calib);
+    F32 temperature = t_fine_to_temperature(t_fine);
+    F32 pressure = compensate_pressure(static_cast<I32>(raw.pressure), t_fine, calib);
 
     // Calculate altitude using barometric formula
     F32 altitude = calculate_altitude(pressure, seaLevelPressure);
@@ -371,25 +1002,161 @@ Bmp280Data BmpManager ::convert_raw_data(const RawBmpData& raw, const Calibratio
     return bmpData;
 }
 
-F32 BmpManager ::calculate_altitude(F32 pressure, F32 seaLevelPressure) {
-    if (seaLevelPressure <= 0.0f || pressure <= 0.0f) {
-        return 0.0f;  // Return 0 for invalid inputs
+Bmp280Data BmpManager ::convert_raw_data(const RawBmpData& raw,
+                                         const CalibrationData& calib,
+                                         const AltitudeEngine& altitudeEngine,
+                                         AltitudeMethod method) {
+    Bmp280Data bmpData;
+
+    const I32 t_fine = compensate_t_fine(static_cast<I32>(raw.temperature), calib);
+    F32 temperature = t_fine_to_temperature(t_fine);
+    F32 pressure = compensate_pressure(static_cast<I32>(raw.pressure), t_fine, calib);
+
+    F32 altitude = calculate_altitude(altitudeEngine, method, pressure);
+
+    bmpData.set_pressure(pressure);
+    bmpData.set_temperature(temperature);
+    bmpData.set_altitude(altitude);
+
+    return bmpData;
+}
+
+void BmpManager ::compensate_chunk(const RawBmpData* chunk,
+                                   FwSizeType size,
+                                   const CalibrationData& calib,
+                                   F32* pressure,
+                                   F32* temperature) {
+    FW_ASSERT(size <= BATCH_CHUNK_SIZE, static_cast<FwAssertArgType>(size));
+
+    // Scratch space for the chunk, kept on the stack so the kernel is reentrant and allocation free
+    I32 adc[BATCH_CHUNK_SIZE];
+    I32 t_fine[BATCH_CHUNK_SIZE];
+
+    // Stage 1: temperature, 32-bit integer math without branches
+    for (FwSizeType i = 0; i < size; i++) {
+        adc[i] = static_cast<I32>(chunk[i].temperature);
+    }
+    for (FwSizeType i = 0; i < size; i++) {
+        t_fine[i] = compensate_t_fine(adc[i], calib);
+    }
+    for (FwSizeType i = 0; i < size; i++) {
+        temperature[i] = t_fine_to_temperature(t_fine[i]);
+    }
+
+    // Stage 2: pressure, 64-bit math with a division per sample
+    for (FwSizeType i = 0; i < size; i++) {
+        pressure[i] = compensate_pressure(static_cast<I32>(chunk[i].pressure), t_fine[i], calib);
+    }
+}
+
+void BmpManager ::convert_raw_batch(const RawBmpData* raw,
+                                    FwSizeType count,
+                                    const CalibrationData& calib,
+                                    F32 seaLevelPressure,
+                                    F32* pressure,
+                                    F32* temperature,
+                                    F32* altitude) {
+    FW_ASSERT((raw != nullptr) || (count == 0));
+    FW_ASSERT((pressure != nullptr) || (count == 0));
+    FW_ASSERT((temperature != nullptr) || (count == 0));
+    FW_ASSERT((altitude != nullptr) || (count == 0));
+
+    for (FwSizeType base = 0; base < count; base += BATCH_CHUNK_SIZE) {
+        const FwSizeType size = ((count - base) < BATCH_CHUNK_SIZE) ? (count - base) : BATCH_CHUNK_SIZE;
+        compensate_chunk(&raw[base], size, calib, &pressure[base], &temperature[base]);
+
+        // Stage 3: altitude, one pow() per sample
+        for (FwSizeType i = 0; i < size; i++) {
+            altitude[base + i] = calculate_altitude(pressure[base + i], seaLevelPressure);
+        }
     }
+}
 
-    F32 ratio = pressure / seaLevelPressure;
-    if (ratio <= 0.0f) {
-        return 0.0f;
+void BmpManager ::convert_raw_batch(const RawBmpData* raw,
+                                    FwSizeType count,
+                                    const CalibrationData& calib,
+                                    const AltitudeEngine& altitudeEngine,
+                                    AltitudeMethod method,
+                                    F32* pressure,
+                                    F32* temperature,
+                                    F32* altitude) {
+    FW_ASSERT((raw != nullptr) || (count == 0));
+    FW_ASSERT((pressure != nullptr) || (count == 0));
+    FW_ASSERT((temperature != nullptr) || (count == 0));
+    FW_ASSERT((altitude != nullptr) || (count == 0));
+
+    for (FwSizeType base = 0; base < count; base += BATCH_CHUNK_SIZE) {
+        const FwSizeType size = ((count - base) < BATCH_CHUNK_SIZE) ? (count - base) : BATCH_CHUNK_SIZE;
+        compensate_chunk(&raw[base], size, calib, &pressure[base], &temperature[base]);
+
+        // Stage 3: altitude, with the method chosen once per chunk rather than per sample
+        switch (method.e) {
+            case AltitudeMethod::LOOKUP_TABLE:
+                for (FwSizeType i = 0; i < size; i++) {
+                    altitude[base + i] = altitudeEngine.lookup(pressure[base + i]);
+                }
+                break;
+            case AltitudeMethod::POLYNOMIAL:
+                for (FwSizeType i = 0; i < size; i++) {
+                    altitude[base + i] = altitudeEngine.polynomial(pressure[base + i]);
+                }
+                break;
+            default:
+                for (FwSizeType i = 0; i < size; i++) {
+                    altitude[base + i] = altitudeEngine.exact(pressure[base + i]);
+                }
+                break;
+        }
     }
+}
 
-    // Using standard atmosphere model constants
-    // Barometric formula for altitude calculation
-    // altitude = 44330 * (1 - (pressure / seaLevelPressure)^(1/5.255))
-    static const F32 STANDARD_ALTITUDE_CONSTANT = 44330.0f;
-    static const F32 PRESSURE_EXPONENT = 1.0f / 5.255f;
+U8 BmpManager ::pressure_oversampling_to_register(PressureOversampling oversampling) {
+    // Enumeration values are already aligned to the osrs_p bits of CTRL_MEAS
+    return static_cast<U8>(oversampling.e);
+}
 
-    F32 altitude = STANDARD_ALTITUDE_CONSTANT * (1.0f - pow(ratio, PRESSURE_EXPONENT));
+U8 BmpManager ::temperature_oversampling_to_register(TemperatureOversampling oversampling) {
+    // Enumeration values are already aligned to the osrs_t bits of CTRL_MEAS
+    return static_cast<U8>(oversampling.e);
+}
 
-    return altitude;
+U8 BmpManager ::config_to_register(StandbyTime standby, IirFilter filter) {
+    // CONFIG register (0xF5) format:
+    // bits 7:5 = t_sb (standby time in normal mode)
+    // bits 4:2 = filter (IIR filter coefficient)
+    // bit 0 = spi3w_en (left clear for 4-wire SPI)
+    return static_cast<U8>(standby.e) | static_cast<U8>(filter.e);
+}
+
+U32 BmpManager ::max_conversion_time_us(PressureOversampling pressureOversampling,
+                                         TemperatureOversampling temperatureOversampling) {
+    // Oversampling ratio indexed by the 3-bit osrs_x register code
+    static const U32 OVERSAMPLING_RATIO[] = {0, 1, 2, 4, 8, 16, 16, 16};
+    const U32 pressureRatio = OVERSAMPLING_RATIO[(pressure_oversampling_to_register(pressureOversampling) >> 2) & 0x07];
+    const U32 temperatureRatio =
+        OVERSAMPLING_RATIO[(temperature_oversampling_to_register(temperatureOversampling) >> 5) & 0x07];
+
+    // t_measure,max = 1.25 ms + 2.3 ms * osrs_t + (2.3 ms * osrs_p + 0.575 ms)
+    U32 conversionTime = 1250 + 2300 * temperatureRatio;
+    if (pressureRatio != 0) {
+        conversionTime += 2300 * pressureRatio + 575;
+    }
+    return conversionTime;
+}
+
+F32 BmpManager ::calculate_altitude(F32 pressure, F32 seaLevelPressure) {
+    return AltitudeEngine::barometric(pressure, seaLevelPressure);
+}
+
+F32 BmpManager ::calculate_altitude(const AltitudeEngine& altitudeEngine, AltitudeMethod method, F32 pressure) {
+    switch (method.e) {
+        case AltitudeMethod::LOOKUP_TABLE:
+            return altitudeEngine.lookup(pressure);
+        case AltitudeMethod::POLYNOMIAL:
+            return altitudeEngine.polynomial(pressure);
+        default:
+            return altitudeEngine.exact(pressure);
+    }
 }
 
 }  // namespace Bmp280
\ No newline at end of file
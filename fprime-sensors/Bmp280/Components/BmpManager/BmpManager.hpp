@@ -7,7 +7,13 @@
 #ifndef Bmp280_BmpManager_HPP
 #define Bmp280_BmpManager_HPP
 
+#include <atomic>
+#include "Fw/Types/FileNameString.hpp"
+#include "fprime-sensors/Bmp280/Components/BmpManager/AltitudeEngine.hpp"
 #include "fprime-sensors/Bmp280/Components/BmpManager/BmpManagerComponentAc.hpp"
+#include "fprime-sensors/Bmp280/Components/BmpManager/FilterChain.hpp"
+#include "fprime-sensors/Bmp280/Components/BmpManager/VerticalSpeedFilter.hpp"
+#include "fprime-sensors/Bmp280/Types/FppConstantsAc.hpp"
 
 namespace Bmp280 {
 
@@ -27,6 +33,12 @@ class BmpManager final : public BmpManagerComponentBase {
     static constexpr U8 MEASUREMENT_DATA_LENGTH = 6;
     static constexpr U8 NORMAL_MODE = 0x03;
     static constexpr U8 FORCED_MODE = 0x01;
+    static constexpr U8 SLEEP_MODE = 0x00;
+    static constexpr U8 STATUS_MEASURING = 0x08;
+    static constexpr U8 STATUS_IM_UPDATE = 0x01;
+    static constexpr U32 RAW_STUCK_LOW = 0x00000;   // Raw value read with MISO held low
+    static constexpr U32 RAW_STUCK_HIGH = 0xFFFFF;  // Raw value read with MISO floating high
+    static constexpr U32 CACHE_RECORD_SIZE = 1 + CALIB_DATA_LENGTH + sizeof(U32);  // Chip id, trim, CRC-32
 
     struct CalibrationData {
         U16 dig_T1;
@@ -59,18 +71,74 @@ class BmpManager final : public BmpManagerComponentBase {
     //! Destroy BmpManager object
     ~BmpManager();
 
+    //! Configure the number of BMP280 devices, one per spiReadWrite port (chip select)
+    //!
+    //! When calibrationCachePath is supplied, calibration is persisted to that file and devices with a valid cached
+    //! calibration skip straight to a chip id check and configuration after a restart.
+    void configure(FwSizeType deviceCount = 1,                 //!< Number of devices
+                   const char* calibrationCachePath = nullptr  //!< Calibration cache file, nullptr to disable
+    );
+
+    //! Parse the 24-byte trim block read from CALIB_DATA_REGISTER
+    static CalibrationData parse_calibration(const U8* data);
+
     //! Converts raw BMP280 data to the telemetry structure
     static Bmp280Data convert_raw_data(const RawBmpData& raw, const CalibrationData& calib, F32 seaLevelPressure);
 
+    //! Converts raw BMP280 data to the telemetry structure, calculating altitude with the given method
+    static Bmp280Data convert_raw_data(const RawBmpData& raw,
+                                       const CalibrationData& calib,
+                                       const AltitudeEngine& altitudeEngine,
+                                       AltitudeMethod method);
+
+    //! Converts a batch of raw BMP280 samples sharing one calibration into separate output arrays
+    //!
+    //! Results are bit-exact with convert_raw_data. Samples are processed in chunks of BATCH_CHUNK_SIZE with the
+    //! temperature and pressure stages each run over the whole chunk such that the 32-bit temperature stage can be
+    //! vectorized by the compiler. The altitude stage still evaluates the barometric formula, and so pow(), once
+    //! per sample; use the AltitudeEngine overload to avoid it.
+    static void convert_raw_batch(const RawBmpData* raw,              //!< Raw samples
+                                  FwSizeType count,                   //!< Number of samples
+                                  const CalibrationData& calib,       //!< Calibration shared by all samples
+                                  F32 seaLevelPressure,               //!< Sea level pressure for altitude (Pa)
+                                  F32* pressure,                      //!< Output pressure (Pa), count entries
+                                  F32* temperature,                   //!< Output temperature (°C), count entries
+                                  F32* altitude                       //!< Output altitude (m), count entries
+    );
+
+    //! Converts a batch of raw BMP280 samples sharing one calibration, calculating altitude with the given method
+    //!
+    //! Results are bit-exact with the matching convert_raw_data. The LOOKUP_TABLE and POLYNOMIAL methods take the
+    //! altitude stage without a pow() per sample.
+    static void convert_raw_batch(const RawBmpData* raw,                //!< Raw samples
+                                  FwSizeType count,                     //!< Number of samples
+                                  const CalibrationData& calib,         //!< Calibration shared by all samples
+                                  const AltitudeEngine& altitudeEngine, //!< Engine set to the sea level pressure
+                                  AltitudeMethod method,                //!< Altitude calculation method
+                                  F32* pressure,                        //!< Output pressure (Pa), count entries
+                                  F32* temperature,                     //!< Output temperature (°C), count entries
+                                  F32* altitude                         //!< Output altitude (m), count entries
+    );
+
     //! Calculates altitude from pressure using barometric formula
     static F32 calculate_altitude(F32 pressure, F32 seaLevelPressure);
 
+    //! Calculates altitude from pressure using the given method
+    static F32 calculate_altitude(const AltitudeEngine& altitudeEngine, AltitudeMethod method, F32 pressure);
+
     //! Pressure oversampling to register value
     static U8 pressure_oversampling_to_register(PressureOversampling oversampling);
 
     //! Temperature oversampling to register value
     static U8 temperature_oversampling_to_register(TemperatureOversampling oversampling);
 
+    //! Standby time and IIR filter to CONFIG register value
+    static U8 config_to_register(StandbyTime standby, IirFilter filter);
+
+    //! Maximum conversion time in microseconds for the given oversampling (datasheet section 3.8.1)
+    static U32 max_conversion_time_us(PressureOversampling pressureOversampling,
+                                      TemperatureOversampling temperatureOversampling);
+
   private:
     // ----------------------------------------------------------------------
     // Handler implementations for typed input ports
@@ -81,56 +149,309 @@ class BmpManager final : public BmpManagerComponentBase {
     void parameterUpdated(FwPrmIdType id  //!< The parameter ID
                           ) override;
 
+    //! Mark the parameter snapshot stale once parameters are loaded
+    void parametersLoaded() override;
+
     //! Handler implementation for run
     //!
-    //! Scheduling port for reading from BMP280 and writing to telemetry
+    //! Scheduling port writing the latest reading to telemetry, also acquiring through acquireOut or inline
     void run_handler(FwIndexType portNum,  //!< The port number
                      U32 context           //!< The call order
                      ) override;
 
+    //! Handler implementation for acquire
+    //!
+    //! Scheduling port reading the BMP280 on the component thread, at the cadence of the rate group driving it
+    void acquire_handler(FwIndexType portNum,  //!< The port number
+                         U32 context           //!< The call order
+                         ) override;
+
+    // ----------------------------------------------------------------------
+    // Handler implementations for commands
+    // ----------------------------------------------------------------------
+
+    //! Handler implementation for command BURST_CAPTURE
+    //!
+    //! Capture every conversion into a single data product, decoupled from the Reading telemetry rate
+    void BURST_CAPTURE_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                  U32 cmdSeq,           //!< The command sequence number
+                                  U32 count,            //!< Number of samples to capture, at most BURST_CAPACITY
+                                  U32 rateDivisor       //!< Capture on every rateDivisor-th run tick
+                                  ) override;
+
+    //! Handler implementation for command BURST_ABORT
+    //!
+    //! Abort an in-progress burst capture, discarding its samples
+    void BURST_ABORT_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                U32 cmdSeq            //!< The command sequence number
+                                ) override;
+
+    // ----------------------------------------------------------------------
+    // Helper types
+    // ----------------------------------------------------------------------
+
+    //! State of a BMP280 device, in the order of the Bmp280State telemetry enumeration
+    enum BmpState { RESET, STARTUP_DELAY, CHIP_ID_CHECK, CALIBRATION_READ, CONFIGURE, RUNNING, RECOVER, BACKOFF };
+
+    //! Health accounting of a BMP280 device
+    struct DeviceHealth {
+        BmpState state;            //!< State as of the last acquisition
+        Fw::Time stateTime;        //!< Time the state was entered
+        Fw::Time sampleTime;       //!< Time of the last successful sample, zero before the first
+        U32 consecutiveFailures;   //!< Failures since the last successful sample
+        U32 totalResets;           //!< Soft resets issued since construction
+    };
+
+    //! Per-device state, one for each chip select sharing the SPI bus
+    struct DeviceContext {
+        FwIndexType port;                        //!< spiReadWrite port connected to this device's chip select
+        BmpState state;                          //!< Tracks the state of the BMP280
+        U32 startupCounter;                      //!< Startup delay counter
+        U32 backoffCounter;                      //!< Acquisition ticks left before the next retry
+        BmpState resumeState;                    //!< State retried once the backoff expires
+        DeviceHealth health;                     //!< Failure and reset accounting
+        CalibrationData calibration;             //!< Calibration data
+        U8 calibrationBytes[CALIB_DATA_LENGTH];  //!< Trim block the calibration was parsed from
+        bool calibrationValid;                   //!< Whether calibration has been read or loaded from the cache
+        bool triggerPending;                     //!< Whether a pipelined conversion has been triggered and not yet read
+        Fw::Time triggerTime;                    //!< Time the pending pipelined conversion was triggered
+        Bmp280Data reading;                      //!< Latest converted reading
+        Fw::Time readingTime;                    //!< Time stamp of the latest reading
+        U32 readingCount;                        //!< Number of readings stored since construction
+        FilterChain pressureFilter;              //!< Filter applied to pressure before publishing
+        FilterChain temperatureFilter;           //!< Filter applied to temperature before publishing
+        U32 decimationCount;                     //!< Filtered samples since the last published reading
+        VerticalSpeedFilter verticalFilter;      //!< Altitude and vertical speed filter run on every sample
+        Bmp280Vertical vertical;                 //!< Vertical filter output as of the latest reading
+    };
+
+    //! Parameters used on every acquisition, read and derived once per parameter update rather than once per tick
+    struct ParameterSnapshot {
+        ArrayScheduling scheduling;     //!< Order devices are serviced in
+        AcquisitionMode mode;           //!< Acquisition mode
+        U8 oversampling;                //!< osrs_t and osrs_p bits of CTRL_MEAS
+        U8 config;                      //!< CONFIG register value
+        U8 triggerFrame[2];             //!< CTRL_MEAS write starting a forced conversion
+        U32 conversionTimeUs;           //!< Maximum conversion time at the configured oversampling
+        AltitudeMethod altitudeMethod;  //!< Pressure to altitude method
+        U8 medianLength;                //!< Median window length, clamped to 1 to FilterChain::MAX_LENGTH
+        U8 boxcarLength;                //!< Boxcar window length, clamped to 1 to FilterChain::MAX_LENGTH
+        F32 iirAlpha;                   //!< IIR smoothing factor, 1 when out of range
+        U32 decimation;                 //!< Output decimation, at least 1
+        F32 processNoise;               //!< Vertical filter process noise, clamped to the filter bounds
+        F32 measurementNoise;           //!< Vertical filter measurement noise, clamped to the filter bounds
+    };
+
+    //! Snapshot of every device's latest reading, handed from the acquisition to the run port
+    struct ReadingSlot {
+        Bmp280Data readings[MAX_DEVICES];       //!< Latest reading of each device
+        Bmp280Vertical verticals[MAX_DEVICES];  //!< Vertical filter output of each device as of its reading
+        Fw::Time readingTimes[MAX_DEVICES];     //!< Time stamp of each reading
+        U32 readingCounts[MAX_DEVICES];         //!< Reading count of each device, a change marks a new reading
+        DeviceHealth health[MAX_DEVICES];       //!< Health of each device
+        U8 runningMask;                         //!< Bit mask of devices in RUNNING
+    };
+
     // ----------------------------------------------------------------------
     // Helper functions
     // ----------------------------------------------------------------------
 
+    //! Step the scheduled devices under the component lock and hand their readings to the run port
+    void acquire_devices();
+
+    //! Read every parameter into the snapshot and rebuild the altitude constants
+    void refresh_parameters();
+
+    //! Step the state machine of a single device
+    void run_device(DeviceContext& device);
+
+    //! Configure the device and enter RUNNING, or RESET on failure
+    void configure_and_run(DeviceContext& device);
+
+    //! Leave RUNNING after a bus failure, through RECOVER when the calibration is known
+    void enter_recovery(DeviceContext& device);
+
+    //! Count a failure and retry from resumeState, after an exponential backoff once the failures exceed
+    //! MAX_RESET_ATTEMPTS
+    void fail_device(DeviceContext& device, BmpState resumeState);
+
+    //! Read the calibration cache file, false when it does not exist or could not be read
+    bool read_calibration_cache(U8 contents[MAX_DEVICES * CACHE_RECORD_SIZE]);
+
+    //! Load the cached calibration read from the file, moving devices with a valid record to RECOVER
+    void load_calibration_cache(const U8 contents[MAX_DEVICES * CACHE_RECORD_SIZE]);
+
+    //! Update the device's cached record when its calibration differs, marking the cache to be written
+    void store_calibration_cache(const DeviceContext& device);
+
+    //! Write the calibration cache file when a record changed, outside of the acquisition guard
+    void write_calibration_cache();
+
+    //! Move running devices to CONFIGURE such that new parameters are applied
+    void reconfigure_devices();
+
+    //! Copy the latest readings into the back slot and exchange it with the shared slot
+    void write_slot();
+
+    //! Take the shared slot when it holds newer readings than the front slot, and return the front slot
+    const ReadingSlot& read_slot();
+
+    //! Emit the readings updated since the last publication
+    void publish_readings();
+
+    //! Emit the health of every device once per second
+    void publish_health(const ReadingSlot& slot);
+
     //! Resets the BMP280
-    bool reset();
+    bool reset(DeviceContext& device);
 
     //! Read the chip ID
-    bool read_chip_id(U8& id);
+    bool read_chip_id(DeviceContext& device, U8& id);
 
     //! Read the status register
-    bool read_status(U8& status);
+    bool read_status(DeviceContext& device, U8& status);
 
     //! Read calibration data
-    bool read_calibration_data();
+    bool read_calibration_data(DeviceContext& device);
 
     //! Configure the BMP280
-    bool configure_device();
+    bool configure_device(DeviceContext& device);
 
     //! Trigger a measurement in forced mode
-    bool trigger_measurement();
+    bool trigger_measurement(DeviceContext& device);
+
+    //! Burst read the measurement registers 0xF7..0xFC
+    bool read_measurement(DeviceContext& device, RawBmpData& raw);
+
+    //! Convert a raw measurement into the device's latest reading, stamped with sampleTime when supplied
+    void store_measurement(DeviceContext& device, const RawBmpData& raw, Fw::Time sampleTime = Fw::Time());
+
+    //! Read the conversion triggered on a previous tick, then trigger the next conversion
+    void run_pipelined(DeviceContext& device);
+
+    //! Append a raw sample to the burst capture when one is being captured this tick
+    void capture_sample(const DeviceContext& device, const RawBmpData& raw, const Fw::Time& sampleTime);
+
+    //! Serialize the captured burst into a data product and send it
+    void emit_burst();
+
+    //! Microseconds elapsed since the given time, saturating when the time source is unavailable
+    U32 elapsed_us(const Fw::Time& since);
+
+    //! Microseconds from one time to another, saturating when the first time is zero or after the second
+    static U32 elapsed_us(const Fw::Time& since, const Fw::Time& now);
+
+    //! Milliseconds from one time to another, saturating when the first time is zero or after the second
+    static U32 elapsed_ms(const Fw::Time& since, const Fw::Time& now);
 
     //! Write to the SPI bus and handle errors
-    bool spi_transfer(Fw::Buffer& writeBuffer, Fw::Buffer& readBuffer);
+    bool spi_transfer(DeviceContext& device, Fw::Buffer& writeBuffer, Fw::Buffer& readBuffer);
 
     //! Deserializes raw data from the bus
     RawBmpData deserialize_raw_data(Fw::Buffer& buffer);
 
-    //! State of the BMP280 component
-    enum BmpState { RESET, STARTUP_DELAY, CHIP_ID_CHECK, CALIBRATION_READ, CONFIGURE, RUNNING };
+    //! Per-device state
+    DeviceContext m_devices[MAX_DEVICES];
+
+    //! Pressure to altitude conversion shared by all devices
+    AltitudeEngine m_altitudeEngine;
+
+    //! Parameters as of the last refresh, owned by the acquisition
+    ParameterSnapshot m_parameters;
+
+    //! Whether a parameter changed since the snapshot was taken, set by parameter updates and cleared by the
+    //! acquisition
+    std::atomic<bool> m_parametersStale;
+
+    //! Whether calibration is cached to a file
+    bool m_cacheEnabled;
+
+    //! Whether the calibration cache has been loaded, checked before the acquisition takes the guard
+    std::atomic<bool> m_cacheLoaded;
+
+    //! Whether a record changed since the calibration cache file was written, set by the acquisition and cleared by
+    //! the file write
+    std::atomic<bool> m_cacheDirty;
 
-    //! Tracks the state of the BMP280
-    BmpState m_state;
+    //! Path of the calibration cache file
+    Fw::FileNameString m_cachePath;
 
-    //! Startup delay counter
-    U32 m_startupCounter;
+    //! Contents of the calibration cache file, one record per device
+    U8 m_cacheRecords[MAX_DEVICES][CACHE_RECORD_SIZE];
 
-    //! Calibration data
-    CalibrationData m_calibration;
+    //! Preallocated burst capture storage, filled from the run handler without allocation
+    Bmp280RawSample m_burstSamples[BURST_CAPACITY];
 
-    //! Maximum number of reset attempts before giving up
+    //! Whether a burst capture is in progress
+    bool m_burstActive;
+
+    //! Whether samples stored during the current tick are captured
+    bool m_burstCaptureTick;
+
+    //! Number of samples requested for the burst
+    U32 m_burstCount;
+
+    //! Number of samples captured so far
+    U32 m_burstFill;
+
+    //! Run ticks between captured ticks
+    U32 m_burstDivisor;
+
+    //! Run ticks elapsed since the burst started
+    U32 m_burstTick;
+
+    //! Number of configured devices
+    FwSizeType m_deviceCount;
+
+    //! Next device to service when scheduling round-robin
+    FwSizeType m_nextDevice;
+
+    //! Bit mask of devices in RUNNING as last reported in telemetry
+    U8 m_runningMask;
+
+    //! Number of reading slots, one each for the writer and reader and one exchanged between them
+    static constexpr U8 SLOT_COUNT = 3;
+
+    //! Reading slots forming a triple buffer between the acquisition (single writer) and the run port (single reader)
+    ReadingSlot m_slots[SLOT_COUNT];
+
+    //! Index of the slot between the writer and the reader, with SLOT_FRESH set when the reader has not taken it
+    std::atomic<U8> m_slotShared;
+
+    //! Index of the slot being written, owned by the acquisition
+    U8 m_slotBack;
+
+    //! Index of the slot being read, owned by the run port
+    U8 m_slotFront;
+
+    //! Reading count of each device as of the last publication
+    U32 m_publishedCounts[MAX_DEVICES];
+
+    //! Whether acquire has been invoked, after which the run port only publishes
+    std::atomic<bool> m_acquireDriven;
+
+    //! Seconds field of the time the health was last published
+    U32 m_healthSeconds;
+
+    //! Flag on m_slotShared marking readings the run port has not taken
+    static constexpr U8 SLOT_FRESH = 0x80;
+
+    //! Number of samples processed per stage of convert_raw_batch
+    static constexpr FwSizeType BATCH_CHUNK_SIZE = 64;
+
+    //! Temperature and pressure stages of convert_raw_batch over up to BATCH_CHUNK_SIZE samples
+    static void compensate_chunk(const RawBmpData* chunk,
+                                 FwSizeType size,
+                                 const CalibrationData& calib,
+                                 F32* pressure,
+                                 F32* temperature);
+
+    //! Consecutive failures retried on the next tick before retries back off
     static constexpr U32 MAX_RESET_ATTEMPTS = 5;
 
+    //! Backoff doubles with each further failure up to 2^MAX_BACKOFF_EXPONENT acquisition ticks
+    static constexpr U32 MAX_BACKOFF_EXPONENT = 8;
+
     //! Number of cycles to wait after reset for device startup (approximately 2ms at typical scheduling rates)
     static constexpr U32 STARTUP_DELAY_CYCLES = 2;
 };
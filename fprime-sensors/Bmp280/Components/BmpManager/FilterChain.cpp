@@ -0,0 +1,109 @@
+// ======================================================================
+// \title  FilterChain.cpp
+// \author aborjigin
+// \brief  cpp file for the fixed-size BMP280 sample filter chain
+// ======================================================================
+
+#include "fprime-sensors/Bmp280/Components/BmpManager/FilterChain.hpp"
+#include "Fw/Types/Assert.hpp"
+
+namespace Bmp280 {
+
+FilterChain ::FilterChain() : m_medianLength(1), m_boxcarLength(1), m_iirAlpha(1.0f) {
+    this->reset();
+}
+
+void FilterChain ::configure(U32 medianLength, U32 boxcarLength, F32 iirAlpha) {
+    FW_ASSERT((medianLength > 0) && (medianLength <= MAX_LENGTH), static_cast<FwAssertArgType>(medianLength));
+    FW_ASSERT((boxcarLength > 0) && (boxcarLength <= MAX_LENGTH), static_cast<FwAssertArgType>(boxcarLength));
+    FW_ASSERT((iirAlpha > 0.0f) && (iirAlpha <= 1.0f));
+    if ((medianLength == this->m_medianLength) && (boxcarLength == this->m_boxcarLength) &&
+        (iirAlpha == this->m_iirAlpha)) {
+        return;
+    }
+    this->m_medianLength = medianLength;
+    this->m_boxcarLength = boxcarLength;
+    this->m_iirAlpha = iirAlpha;
+    this->reset();
+}
+
+void FilterChain ::reset() {
+    for (U32 i = 0; i < MAX_LENGTH; i++) {
+        this->m_medianWindow[i] = 0.0f;
+        this->m_boxcarWindow[i] = 0.0f;
+    }
+    this->m_medianCount = 0;
+    this->m_medianNext = 0;
+    this->m_boxcarSum = 0.0;
+    this->m_boxcarCount = 0;
+    this->m_boxcarNext = 0;
+    this->m_iirState = 0.0f;
+    this->m_iirPrimed = false;
+}
+
+bool FilterChain ::is_passthrough() const {
+    return (this->m_medianLength == 1) && (this->m_boxcarLength == 1) && (this->m_iirAlpha == 1.0f);
+}
+
+F32 FilterChain ::update(F32 sample) {
+    F32 value = sample;
+
+    // Median stage
+    if (this->m_medianLength > 1) {
+        this->m_medianWindow[this->m_medianNext] = value;
+        this->m_medianNext = (this->m_medianNext + 1) % this->m_medianLength;
+        if (this->m_medianCount < this->m_medianLength) {
+            this->m_medianCount++;
+        }
+        value = this->median();
+    }
+
+    // Boxcar stage, the running sum replaces the oldest sample instead of summing the window each update
+    if (this->m_boxcarLength > 1) {
+        if (this->m_boxcarCount < this->m_boxcarLength) {
+            this->m_boxcarCount++;
+        } else {
+            this->m_boxcarSum -= this->m_boxcarWindow[this->m_boxcarNext];
+        }
+        this->m_boxcarWindow[this->m_boxcarNext] = value;
+        this->m_boxcarSum += value;
+        this->m_boxcarNext = (this->m_boxcarNext + 1) % this->m_boxcarLength;
+        value = static_cast<F32>(this->m_boxcarSum / static_cast<F64>(this->m_boxcarCount));
+    }
+
+    // First-order IIR stage, seeded with the first sample to avoid a start-up transient from zero
+    if (this->m_iirAlpha < 1.0f) {
+        if (!this->m_iirPrimed) {
+            this->m_iirState = value;
+            this->m_iirPrimed = true;
+        } else {
+            this->m_iirState += this->m_iirAlpha * (value - this->m_iirState);
+        }
+        value = this->m_iirState;
+    }
+    return value;
+}
+
+F32 FilterChain ::median() const {
+    FW_ASSERT((this->m_medianCount > 0) && (this->m_medianCount <= MAX_LENGTH),
+              static_cast<FwAssertArgType>(this->m_medianCount));
+
+    // Insertion sort of a copy, the window is at most MAX_LENGTH samples
+    F32 sorted[MAX_LENGTH];
+    for (U32 i = 0; i < this->m_medianCount; i++) {
+        const F32 value = this->m_medianWindow[i];
+        U32 j = i;
+        while ((j > 0) && (sorted[j - 1] > value)) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = value;
+    }
+    const U32 middle = this->m_medianCount / 2;
+    if ((this->m_medianCount % 2) == 0) {
+        return 0.5f * (sorted[middle - 1] + sorted[middle]);
+    }
+    return sorted[middle];
+}
+
+}  // namespace Bmp280
@@ -0,0 +1,65 @@
+// ======================================================================
+// \title  FilterChain.hpp
+// \author aborjigin
+// \brief  hpp file for the fixed-size BMP280 sample filter chain
+// ======================================================================
+
+#ifndef Bmp280_FilterChain_HPP
+#define Bmp280_FilterChain_HPP
+
+#include "Fw/FPrimeBasicTypes.hpp"
+
+namespace Bmp280 {
+
+//! Filters a stream of scalar samples through a median, a boxcar (moving average), and a first-order IIR stage
+//!
+//! Stages run in that order so that the median removes spikes before they are smeared by the averaging stages. A
+//! median or boxcar length of 1 and an IIR alpha of 1 disable the respective stage. Windows are fixed-size members
+//! so filtering never allocates. Until a window fills, the median and boxcar stages use the samples seen so far.
+class FilterChain {
+  public:
+    //! Maximum median and boxcar window length
+    static constexpr U32 MAX_LENGTH = 16;
+
+    //! Construct a pass-through filter
+    FilterChain();
+
+    //! Configure the stages, clearing the filter history if the configuration changed
+    void configure(U32 medianLength,  //!< Median window length, 1 to MAX_LENGTH
+                   U32 boxcarLength,  //!< Boxcar window length, 1 to MAX_LENGTH
+                   F32 iirAlpha       //!< IIR smoothing factor in (0, 1], weight of the newest sample
+    );
+
+    //! Clear the filter history, keeping the configuration
+    void reset();
+
+    //! Whether every stage is disabled such that update() returns its input
+    bool is_passthrough() const;
+
+    //! Filter a new sample, returning the output of the last stage
+    F32 update(F32 sample);
+
+  private:
+    //! Median of the samples held in the median window
+    F32 median() const;
+
+    U32 m_medianLength;  //!< Configured median window length
+    U32 m_boxcarLength;  //!< Configured boxcar window length
+    F32 m_iirAlpha;      //!< Configured IIR smoothing factor
+
+    F32 m_medianWindow[MAX_LENGTH];  //!< Most recent input samples
+    U32 m_medianCount;               //!< Number of valid samples in the median window
+    U32 m_medianNext;                //!< Next median window slot to overwrite
+
+    F32 m_boxcarWindow[MAX_LENGTH];  //!< Most recent median outputs
+    F64 m_boxcarSum;                 //!< Sum of the boxcar window, double precision to avoid drift at ~1e5 Pa
+    U32 m_boxcarCount;               //!< Number of valid samples in the boxcar window
+    U32 m_boxcarNext;                //!< Next boxcar window slot to overwrite
+
+    F32 m_iirState;     //!< IIR output
+    bool m_iirPrimed;   //!< Whether the IIR has been seeded with a sample
+};
+
+}  // namespace Bmp280
+
+#endif
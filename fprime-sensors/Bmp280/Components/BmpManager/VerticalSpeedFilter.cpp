@@ -0,0 +1,136 @@
+// ======================================================================
+// \title  VerticalSpeedFilter.cpp
+// \author aborjigin
+// \brief  cpp file for the fixed-point BMP280 altitude and vertical speed filter
+// ======================================================================
+
+#include "fprime-sensors/Bmp280/Components/BmpManager/VerticalSpeedFilter.hpp"
+#include <cmath>
+#include "Fw/Types/Assert.hpp"
+
+namespace Bmp280 {
+
+namespace {
+constexpr I64 STATE_ONE = static_cast<I64>(1) << VerticalSpeedFilter::STATE_BITS;
+constexpr I64 GAIN_ONE = static_cast<I64>(1) << VerticalSpeedFilter::GAIN_BITS;
+constexpr I64 GAIN_HALF = GAIN_ONE / 2;
+constexpr I64 MAX_RESIDUAL_Q16 = static_cast<I64>(VerticalSpeedFilter::MAX_RESIDUAL) * STATE_ONE;
+
+constexpr I64 MAX_SPEED_Q16 = static_cast<I64>(VerticalSpeedFilter::MAX_SPEED) * STATE_ONE;
+
+// Microseconds to Q30 seconds as a multiply and shift, 2^50 / 10^6 rounded. Q16 would truncate 10 ms by 0.05%,
+// enough to bias the prediction at speed.
+constexpr U32 PERIOD_BITS = 30;
+constexpr U64 US_TO_PERIOD_MULTIPLIER = 1125899907;
+constexpr U32 US_TO_PERIOD_SHIFT = 20;
+
+//! Multiply a Q16 value by a Q24 gain, rounding to nearest so the loop does not integrate a truncation bias
+inline I64 apply_gain(I64 gain, I64 value) {
+    return ((gain * value) + GAIN_HALF) >> VerticalSpeedFilter::GAIN_BITS;
+}
+}  // namespace
+
+VerticalSpeedFilter ::VerticalSpeedFilter()
+    : m_processNoise(1.0f), m_measurementNoise(0.2f), m_gainPeriodUs(0), m_alpha(0), m_betaRate(0) {
+    this->reset();
+}
+
+void VerticalSpeedFilter ::configure(F32 processNoise, F32 measurementNoise) {
+    FW_ASSERT((processNoise >= MIN_NOISE) && (processNoise <= MAX_NOISE));
+    FW_ASSERT((measurementNoise >= MIN_NOISE) && (measurementNoise <= MAX_NOISE));
+    if ((processNoise == this->m_processNoise) && (measurementNoise == this->m_measurementNoise)) {
+        return;
+    }
+    this->m_processNoise = processNoise;
+    this->m_measurementNoise = measurementNoise;
+    this->m_gainPeriodUs = 0;
+}
+
+void VerticalSpeedFilter ::reset() {
+    this->m_altitude = 0;
+    this->m_speed = 0;
+    this->m_primed = false;
+}
+
+void VerticalSpeedFilter ::update(F32 altitude, U32 periodUs) {
+    if (!(std::fabs(altitude) <= MAX_ALTITUDE)) {
+        return;
+    }
+    const I64 measurement = static_cast<I64>(altitude * static_cast<F32>(STATE_ONE));
+    if (!this->m_primed || (periodUs == 0) || (periodUs > MAX_PERIOD_US)) {
+        this->seed(measurement);
+        return;
+    }
+
+    // Jitter in the sample period is tolerated up to an eighth before the gains are recomputed
+    const U32 gainPeriodUs = this->m_gainPeriodUs;
+    const U32 jitter = (periodUs > gainPeriodUs) ? (periodUs - gainPeriodUs) : (gainPeriodUs - periodUs);
+    if ((gainPeriodUs == 0) || (jitter > (gainPeriodUs >> 3))) {
+        this->update_gains(periodUs);
+    }
+
+    // Predict with the actual period, then correct by the residual
+    const I64 period =
+        static_cast<I64>((static_cast<U64>(periodUs) * US_TO_PERIOD_MULTIPLIER) >> US_TO_PERIOD_SHIFT);
+    const I64 predicted = this->m_altitude + ((this->m_speed * period) >> PERIOD_BITS);
+    const I64 residual = measurement - predicted;
+    if ((residual > MAX_RESIDUAL_Q16) || (residual < -MAX_RESIDUAL_Q16)) {
+        this->seed(measurement);
+        return;
+    }
+    this->m_altitude = predicted + apply_gain(this->m_alpha, residual);
+    const I64 speed = this->m_speed + apply_gain(this->m_betaRate, residual);
+    this->m_speed = (speed > MAX_SPEED_Q16) ? MAX_SPEED_Q16 : ((speed < -MAX_SPEED_Q16) ? -MAX_SPEED_Q16 : speed);
+}
+
+F32 VerticalSpeedFilter ::get_altitude() const {
+    return static_cast<F32>(this->m_altitude) / static_cast<F32>(STATE_ONE);
+}
+
+F32 VerticalSpeedFilter ::get_speed() const {
+    return static_cast<F32>(this->m_speed) / static_cast<F32>(STATE_ONE);
+}
+
+F32 VerticalSpeedFilter ::get_alpha() const {
+    return static_cast<F32>(this->m_alpha) / static_cast<F32>(GAIN_ONE);
+}
+
+F32 VerticalSpeedFilter ::get_beta() const {
+    return static_cast<F32>(this->m_betaRate) * (static_cast<F32>(this->m_gainPeriodUs) * 1.0e-6f) /
+           static_cast<F32>(GAIN_ONE);
+}
+
+void VerticalSpeedFilter ::steady_state_gains(F32 processNoise,
+                                              F32 measurementNoise,
+                                              F32 period,
+                                              F32& alpha,
+                                              F32& beta) {
+    FW_ASSERT(measurementNoise > 0.0f);
+    FW_ASSERT(period > 0.0f);
+    // Kalata's tracking index solution: r = sqrt(1 - alpha) is the root of the steady-state Riccati equation
+    const F64 lambda = static_cast<F64>(processNoise) * static_cast<F64>(period) * static_cast<F64>(period) /
+                       static_cast<F64>(measurementNoise);
+    const F64 r = (4.0 + lambda - std::sqrt((8.0 * lambda) + (lambda * lambda))) / 4.0;
+    alpha = static_cast<F32>(1.0 - (r * r));
+    beta = static_cast<F32>(2.0 * (1.0 - r) * (1.0 - r));
+}
+
+void VerticalSpeedFilter ::update_gains(U32 periodUs) {
+    FW_ASSERT(periodUs > 0);
+    const F32 period = static_cast<F32>(periodUs) * 1.0e-6f;
+    F32 alpha = 0.0f;
+    F32 beta = 0.0f;
+    steady_state_gains(this->m_processNoise, this->m_measurementNoise, period, alpha, beta);
+    this->m_alpha = static_cast<I64>(std::llround(static_cast<F64>(alpha) * static_cast<F64>(GAIN_ONE)));
+    this->m_betaRate =
+        static_cast<I64>(std::llround(static_cast<F64>(beta) / static_cast<F64>(period) * static_cast<F64>(GAIN_ONE)));
+    this->m_gainPeriodUs = periodUs;
+}
+
+void VerticalSpeedFilter ::seed(I64 altitude) {
+    this->m_altitude = altitude;
+    this->m_speed = 0;
+    this->m_primed = true;
+}
+
+}  // namespace Bmp280
@@ -0,0 +1,95 @@
+// ======================================================================
+// \title  VerticalSpeedFilter.hpp
+// \author aborjigin
+// \brief  hpp file for the fixed-point BMP280 altitude and vertical speed filter
+// ======================================================================
+
+#ifndef Bmp280_VerticalSpeedFilter_HPP
+#define Bmp280_VerticalSpeedFilter_HPP
+
+#include "Fw/FPrimeBasicTypes.hpp"
+
+namespace Bmp280 {
+
+//! Estimates altitude and vertical speed from a stream of altitude samples with a fixed-point alpha-beta filter
+//!
+//! The gains are those of the steady-state two-state (altitude, speed) Kalman filter with white acceleration noise,
+//! found from the tracking index lambda = processNoise * period^2 / measurementNoise. They are computed in floating
+//! point only when the noise or the sample period changes, each update is a few 64-bit integer operations on state
+//! held in Q16 metres and metres per second. The first sample, a sample of unknown period, and a sample after a gap
+//! restart the filter at the sample altitude and zero speed.
+class VerticalSpeedFilter {
+  public:
+    //! Fraction bits of the altitude and speed state
+    static constexpr U32 STATE_BITS = 16;
+
+    //! Fraction bits of the gains
+    static constexpr U32 GAIN_BITS = 24;
+
+    //! Longest sample period filtered rather than treated as a gap (µs)
+    static constexpr U32 MAX_PERIOD_US = 2000000;
+
+    //! Largest residual filtered, larger jumps are glitches or sea level pressure changes and restart the filter (m)
+    static constexpr I32 MAX_RESIDUAL = 1000;
+
+    //! Speed estimates are clamped to this magnitude such that the fixed-point products cannot overflow (m/s)
+    static constexpr I32 MAX_SPEED = 1000;
+
+    //! Samples beyond this altitude, including not-a-number, are ignored (m)
+    static constexpr F32 MAX_ALTITUDE = 100000.0f;
+
+    //! Bounds of the process and measurement noise
+    static constexpr F32 MIN_NOISE = 1.0e-3f;
+    static constexpr F32 MAX_NOISE = 1.0e3f;
+
+    //! Construct a filter with 1 m/s^2 process noise and 0.2 m measurement noise
+    VerticalSpeedFilter();
+
+    //! Configure the noise, recomputing the gains on the next update if it changed. The state is kept.
+    void configure(F32 processNoise,     //!< RMS vertical acceleration (m/s^2), MIN_NOISE to MAX_NOISE
+                   F32 measurementNoise  //!< RMS altitude noise (m), MIN_NOISE to MAX_NOISE
+    );
+
+    //! Restart the filter from the next sample, keeping the configuration
+    void reset();
+
+    //! Filter an altitude sample taken periodUs after the previous one, zero when the period is unknown
+    void update(F32 altitude, U32 periodUs);
+
+    //! Filtered altitude (m)
+    F32 get_altitude() const;
+
+    //! Filtered vertical speed, positive climbing (m/s)
+    F32 get_speed() const;
+
+    //! Altitude gain in use, zero before the first filtered sample
+    F32 get_alpha() const;
+
+    //! Speed gain in use, zero before the first filtered sample
+    F32 get_beta() const;
+
+    //! Steady-state Kalman gains of a two-state filter sampled every period seconds
+    static void steady_state_gains(F32 processNoise, F32 measurementNoise, F32 period, F32& alpha, F32& beta);
+
+  private:
+    //! Recompute the gains for a sample period
+    void update_gains(U32 periodUs);
+
+    //! Restart the state at an altitude in Q16 metres
+    void seed(I64 altitude);
+
+    F32 m_processNoise;      //!< Configured RMS vertical acceleration (m/s^2)
+    F32 m_measurementNoise;  //!< Configured RMS altitude noise (m)
+
+    U32 m_gainPeriodUs;  //!< Sample period the gains were computed for, zero when they must be recomputed (µs)
+    I64 m_alpha;         //!< Altitude gain, Q24
+    I64 m_betaRate;      //!< Speed gain divided by the gain period, Q24 per second
+
+    I64 m_altitude;  //!< Filtered altitude, Q16 m
+    I64 m_speed;     //!< Filtered vertical speed, Q16 m/s
+    bool m_primed;   //!< Whether the state holds a sample
+};
+
+}  // namespace Bmp280
+
+#endif
@@ -11,6 +11,153 @@ TEST(Nominal, Test) {
     tester.test_nominal();
 }
 
+TEST(Nominal, NormalMode) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_normal_mode();
+}
+
+TEST(Nominal, Reconfigure) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_reconfigure();
+}
+
+TEST(Nominal, Pipelined) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_pipelined();
+}
+
+TEST(Nominal, ConversionTime) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_conversion_time();
+}
+
+TEST(Nominal, ArrayBurst) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_array_burst();
+}
+
+TEST(Nominal, ArrayRoundRobin) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_array_round_robin();
+}
+
+TEST(Nominal, BatchConversion) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_batch_conversion();
+}
+
+TEST(Nominal, AltitudeMethods) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_altitude_methods();
+}
+
+TEST(Nominal, AltitudeParameter) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_altitude_parameter();
+}
+
+TEST(Nominal, BurstCapture) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_burst_capture();
+}
+
+TEST(Error, BurstCapture) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_burst_capture_errors();
+}
+
+TEST(Nominal, FilterChain) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_filter_chain();
+}
+
+TEST(Nominal, OutputDecimation) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_output_decimation();
+}
+
+TEST(Nominal, CalibrationCache) {
+    {
+        Bmp280::BmpManagerTester tester;
+        tester.test_calibration_cache_store();
+    }
+    // Fresh component instance, as after a software restart
+    {
+        Bmp280::BmpManagerTester tester;
+        tester.test_calibration_cache_restore();
+    }
+}
+
+TEST(Nominal, FastRecovery) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_fast_recovery();
+}
+
+TEST(Error, CalibrationCache) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_calibration_cache_invalid();
+}
+
+TEST(Benchmark, BatchConversion) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_batch_benchmark();
+}
+
+TEST(Nominal, Emulator) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_emulator_loop();
+}
+
+TEST(Error, EmulatorFaults) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_emulator_faults();
+}
+
+TEST(Benchmark, EmulatorLoop) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_emulator_benchmark();
+}
+
+TEST(Nominal, OffRateGroup) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_off_rate_group();
+}
+
+TEST(Benchmark, OffRateGroup) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_off_rate_group_benchmark();
+}
+
+TEST(Error, Backoff) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_backoff();
+}
+
+TEST(Nominal, VerticalSpeedFilter) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_vertical_speed_filter();
+}
+
+TEST(Nominal, VerticalSpeed) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_vertical_speed();
+}
+
+TEST(Benchmark, VerticalSpeed) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_vertical_speed_benchmark();
+}
+
+TEST(Nominal, ParameterSnapshot) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_parameter_snapshot();
+}
+
+TEST(Benchmark, ParameterSnapshot) {
+    Bmp280::BmpManagerTester tester;
+    tester.test_parameter_snapshot_benchmark();
+}
+
 TEST(Error, Test) {
     Bmp280::BmpManagerTester tester;
     tester.test_error();
@@ -19,4 +166,4 @@ TEST(Error, Test) {
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
-}
\ No newline at end of file
+}
@@ -5,17 +5,48 @@
 // ======================================================================
 
 #include "BmpManagerTester.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include "Os/File.hpp"
+#include "Os/FileSystem.hpp"
 
 namespace Bmp280 {
 
+// Example trimming parameters and ADC outputs from section 8.1 of the BMP280 datasheet
+static const U16 DIG_T1 = 27504;
+static const I16 DIG_T2 = 26435;
+static const I16 DIG_T3 = -1000;
+static const U16 DIG_P1 = 36477;
+static const I16 DIG_P2 = -10685;
+static const I16 DIG_P3 = 3024;
+static const I16 DIG_P4 = 2855;
+static const I16 DIG_P5 = 140;
+static const I16 DIG_P6 = -7;
+static const I16 DIG_P7 = 15500;
+static const I16 DIG_P8 = -14600;
+static const I16 DIG_P9 = 6000;
+static const U32 ADC_P = 415148;
+static const U32 ADC_T = 519888;
+
 // ----------------------------------------------------------------------
 // Construction and destruction
 // ----------------------------------------------------------------------
 
 BmpManagerTester ::BmpManagerTester()
-    : BmpManagerGTestBase("BmpManagerTester", BmpManagerTester::MAX_HISTORY_SIZE), component("BmpManager") {
+    : BmpManagerGTestBase("BmpManagerTester", BmpManagerTester::MAX_HISTORY_SIZE),
+      component("BmpManager"),
+      emulator("BmpEmulator"),
+      emulatorTime(0),
+      transactionCount(0),
+      productAvailable(true),
+      acquireForwarded(true) {
     this->initComponents();
     this->connectPorts();
+    this->emulator.init(TEST_INSTANCE_ID);
+    this->fill_registers();
 }
 
 BmpManagerTester ::~BmpManagerTester() {}
@@ -25,65 +56,1395 @@ BmpManagerTester ::~BmpManagerTester() {}
 // ----------------------------------------------------------------------
 
 void BmpManagerTester ::test_nominal() {
-    // Test nominal operation
-    this->invoke_to_run(0, 0);
+    this->component.loadParameters();
+    this->boot_sequence();
+    this->clearHistory();
 
-    // Verify telemetry was sent
-    ASSERT_TLM_SIZE(1);
+    // Forced mode: status poll, trigger, and burst read, queued by run to the component thread
+    this->tick();
+    ASSERT_from_acquireOut_SIZE(1);
+    ASSERT_EQ(this->transactionCount, 3);
+    ASSERT_EQ(this->transactions[0].data[0], 0xF3);
+    const U8 trigger[] = {0x74, 0x20 | 0x04 | 0x01};
+    this->verify_write(1, trigger, sizeof(trigger));
+    ASSERT_EQ(this->transactions[2].data[0], 0xF7);
+    ASSERT_EQ(this->transactions[2].size, BmpManager::MEASUREMENT_DATA_LENGTH + 1);
+
+    // Verify telemetry was sent and matches the datasheet example
+    ASSERT_TLM_SIZE(2);
     ASSERT_TLM_Reading_SIZE(1);
+    ASSERT_TLM_Reading(0, this->expected_reading());
+    ASSERT_NEAR(this->tlmHistory_Reading->at(0).arg.get_temperature(), 25.08f, 0.005f);
+    ASSERT_NEAR(this->tlmHistory_Reading->at(0).arg.get_pressure(), 100653.27f, 0.01f);
+
+    // Without a time source the sample period is unknown, the vertical filter follows the altitude at zero speed
+    ASSERT_TLM_Vertical_SIZE(1);
+    ASSERT_NEAR(this->tlmHistory_Vertical->at(0).arg.get_altitude(), this->expected_reading().get_altitude(), 1.0e-4f);
+    ASSERT_EQ(this->tlmHistory_Vertical->at(0).arg.get_speed(), 0.0f);
 
     // Verify no events were emitted
     ASSERT_EVENTS_SIZE(0);
 }
 
+void BmpManagerTester ::test_normal_mode() {
+    this->paramSet_ACQUISITION_MODE(AcquisitionMode::NORMAL, Fw::ParamValid::VALID);
+    this->paramSet_STANDBY_TIME(StandbyTime::STANDBY_62_5MS, Fw::ParamValid::VALID);
+    this->paramSet_IIR_FILTER(IirFilter::COEFFICIENT_4, Fw::ParamValid::VALID);
+    this->component.loadParameters();
+    this->boot_sequence();
+
+    // Configuration puts the device to sleep, writes CONFIG, and then starts normal mode
+    ASSERT_EQ(this->transactionCount, 2);
+    const U8 config[] = {0x74, 0x20 | 0x04, 0x75, 0x20 | 0x08};
+    this->verify_write(0, config, sizeof(config));
+    const U8 normal[] = {0x74, 0x20 | 0x04 | 0x03};
+    this->verify_write(1, normal, sizeof(normal));
+
+    // Each running tick is a single burst read
+    for (U32 i = 0; i < 5; i++) {
+        this->clearHistory();
+        this->tick();
+        ASSERT_EQ(this->transactionCount, 1);
+        ASSERT_EQ(this->transactions[0].data[0], 0xF7);
+        ASSERT_TLM_Reading_SIZE(1);
+        ASSERT_TLM_Reading(0, this->expected_reading());
+    }
+    ASSERT_EVENTS_SIZE(0);
+}
+
+void BmpManagerTester ::test_reconfigure() {
+    this->component.loadParameters();
+    this->boot_sequence();
+    this->clearHistory();
+
+    // Switching to normal mode reconfigures the device on the next tick
+    this->paramSet_ACQUISITION_MODE(AcquisitionMode::NORMAL, Fw::ParamValid::VALID);
+    this->paramSend_ACQUISITION_MODE(0, 0);
+    ASSERT_EVENTS_AcquisitionModeUpdated_SIZE(1);
+    ASSERT_EVENTS_AcquisitionModeUpdated(0, AcquisitionMode::NORMAL);
+
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 2);
+    const U8 normal[] = {0x74, 0x20 | 0x04 | 0x03};
+    this->verify_write(1, normal, sizeof(normal));
+
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 1);
+    ASSERT_TLM_Reading_SIZE(1);
+}
+
+void BmpManagerTester ::test_pipelined() {
+    this->paramSet_ACQUISITION_MODE(AcquisitionMode::PIPELINED, Fw::ParamValid::VALID);
+    this->component.loadParameters();
+    this->boot_sequence();
+    this->clearHistory();
+
+    // First running tick only triggers a conversion
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 100, 0));
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 1);
+    const U8 trigger[] = {0x74, 0x20 | 0x04 | 0x01};
+    this->verify_write(0, trigger, sizeof(trigger));
+    // Only the health, published on the first tick of a new second
+    ASSERT_TLM_SIZE(1);
+    ASSERT_TLM_Health_SIZE(1);
+
+    // Conversion time (6.425 ms at 1x oversampling) has not passed, so the bus is left alone
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 100, 1000));
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 0);
+    ASSERT_TLM_SIZE(0);
+
+    // Next tick reads the previous conversion and triggers the next one without a status poll
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 100, 10000));
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 2);
+    ASSERT_EQ(this->transactions[0].data[0], 0xF7);
+    this->verify_write(1, trigger, sizeof(trigger));
+    ASSERT_TLM_Reading_SIZE(1);
+    ASSERT_TLM_Reading(0, this->expected_reading());
+    // Sample is stamped at the middle of the conversion window
+    ASSERT_EQ(this->tlmHistory_Reading->at(0).time, Fw::Time(TimeBase::TB_NONE, 100, 6425 / 2));
+    ASSERT_EVENTS_SIZE(0);
+}
+
+void BmpManagerTester ::test_conversion_time() {
+    // Datasheet table 13 maximum measurement times
+    ASSERT_EQ(BmpManager::max_conversion_time_us(PressureOversampling::OVERSAMPLE_1X,
+                                                 TemperatureOversampling::OVERSAMPLE_1X),
+              6425);
+    ASSERT_EQ(BmpManager::max_conversion_time_us(PressureOversampling::OVERSAMPLE_4X,
+                                                 TemperatureOversampling::OVERSAMPLE_1X),
+              13325);
+    ASSERT_EQ(BmpManager::max_conversion_time_us(PressureOversampling::OVERSAMPLE_16X,
+                                                 TemperatureOversampling::OVERSAMPLE_2X),
+              43225);
+    ASSERT_EQ(BmpManager::max_conversion_time_us(PressureOversampling::SKIP, TemperatureOversampling::OVERSAMPLE_1X),
+              3550);
+}
+
+void BmpManagerTester ::test_array_burst() {
+    this->component.configure(3);
+    this->paramSet_ACQUISITION_MODE(AcquisitionMode::NORMAL, Fw::ParamValid::VALID);
+    this->component.loadParameters();
+    this->boot_sequence(3);
+    ASSERT_TLM_RunningDevices_SIZE(1);
+    ASSERT_TLM_RunningDevices(0, 0x07);
+    this->clearHistory();
+
+    // Every device is read within a single tick and reported in one packed channel
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 3);
+    for (FwSizeType i = 0; i < 3; i++) {
+        ASSERT_EQ(this->transactions[i].port, static_cast<FwIndexType>(i));
+        ASSERT_EQ(this->transactions[i].data[0], 0xF7);
+    }
+    ASSERT_TLM_Reading_SIZE(1);
+    ASSERT_TLM_Readings_SIZE(1);
+    const Bmp280DataArray& readings = this->tlmHistory_Readings->at(0).arg;
+    for (FwSizeType i = 0; i < 3; i++) {
+        ASSERT_EQ(readings[i], this->expected_reading());
+    }
+
+    // A device that is still converting does not hold back the others
+    this->paramSet_ACQUISITION_MODE(AcquisitionMode::FORCED, Fw::ParamValid::VALID);
+    this->paramSend_ACQUISITION_MODE(0, 0);
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 3);
+    this->registers[1][BmpManager::STATUS_REGISTER] = 0x08;
+    this->clearHistory();
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 7);
+    ASSERT_EQ(this->transactions[3].port, 1);
+    ASSERT_EQ(this->transactions[3].data[0], 0xF3);
+    ASSERT_EQ(this->transactions[4].port, 2);
+    ASSERT_TLM_Reading_SIZE(1);
+    ASSERT_TLM_Readings_SIZE(1);
+    ASSERT_TLM_RunningDevices_SIZE(0);
+    ASSERT_EVENTS_SIZE(0);
+}
+
+void BmpManagerTester ::test_array_round_robin() {
+    this->component.configure(2);
+    this->paramSet_ACQUISITION_MODE(AcquisitionMode::NORMAL, Fw::ParamValid::VALID);
+    this->paramSet_ARRAY_SCHEDULING(ArrayScheduling::ROUND_ROBIN, Fw::ParamValid::VALID);
+    this->component.loadParameters();
+
+    // Each tick services a single device, alternating between them
+    for (U32 i = 0; i < 12; i++) {
+        this->tick();
+        for (FwSizeType j = 0; j < this->transactionCount; j++) {
+            ASSERT_EQ(this->transactions[j].port, static_cast<FwIndexType>(i % 2));
+        }
+    }
+    ASSERT_TLM_RunningDevices(this->tlmHistory_RunningDevices->size() - 1, 0x03);
+    this->clearHistory();
+
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 1);
+    ASSERT_EQ(this->transactions[0].port, 0);
+    ASSERT_TLM_Readings_SIZE(1);
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 1);
+    ASSERT_EQ(this->transactions[0].port, 1);
+    ASSERT_TLM_Readings_SIZE(2);
+    ASSERT_EVENTS_SIZE(0);
+}
+
+void BmpManagerTester ::test_batch_conversion() {
+    const BmpManager::CalibrationData calibration = {DIG_T1, DIG_T2, DIG_T3, DIG_P1, DIG_P2, DIG_P3,
+                                                     DIG_P4, DIG_P5, DIG_P6, DIG_P7, DIG_P8, DIG_P9};
+    // Not a multiple of the chunk size such that the partial final chunk is covered
+    const FwSizeType count = 3 * BmpManager::BATCH_CHUNK_SIZE + 7;
+    BmpManager::RawBmpData raw[count];
+    F32 pressure[count];
+    F32 temperature[count];
+    F32 altitude[count];
+    fill_raw_samples(raw, count);
+    // Include the datasheet example and the extremes of the 20-bit range
+    raw[0] = {ADC_P, ADC_T};
+    raw[1] = {0x00000, 0x00000};
+    raw[2] = {0xFFFFF, 0xFFFFF};
+
+    BmpManager::convert_raw_batch(raw, count, calibration, 101325.0f, pressure, temperature, altitude);
+    for (FwSizeType i = 0; i < count; i++) {
+        const Bmp280Data expected = BmpManager::convert_raw_data(raw[i], calibration, 101325.0f);
+        ASSERT_EQ(pressure[i], expected.get_pressure()) << "Sample " << i;
+        ASSERT_EQ(temperature[i], expected.get_temperature()) << "Sample " << i;
+        ASSERT_EQ(altitude[i], expected.get_altitude()) << "Sample " << i;
+    }
+
+    // The AltitudeEngine overload matches the scalar conversion for every method
+    AltitudeEngine engine;
+    engine.set_sea_level_pressure(101325.0f);
+    const AltitudeMethod methods[] = {AltitudeMethod::EXACT, AltitudeMethod::LOOKUP_TABLE, AltitudeMethod::POLYNOMIAL};
+    for (const AltitudeMethod method : methods) {
+        BmpManager::convert_raw_batch(raw, count, calibration, engine, method, pressure, temperature, altitude);
+        for (FwSizeType i = 0; i < count; i++) {
+            const Bmp280Data expected = BmpManager::convert_raw_data(raw[i], calibration, engine, method);
+            ASSERT_EQ(pressure[i], expected.get_pressure()) << "Sample " << i;
+            ASSERT_EQ(temperature[i], expected.get_temperature()) << "Sample " << i;
+            ASSERT_EQ(altitude[i], expected.get_altitude()) << "Method " << method.e << " sample " << i;
+        }
+    }
+
+    // Empty batches are permitted
+    BmpManager::convert_raw_batch(nullptr, 0, calibration, 101325.0f, nullptr, nullptr, nullptr);
+    BmpManager::convert_raw_batch(nullptr, 0, calibration, engine, AltitudeMethod::POLYNOMIAL, nullptr, nullptr,
+                                  nullptr);
+}
+
+void BmpManagerTester ::test_batch_benchmark() {
+    const BmpManager::CalibrationData calibration = {DIG_T1, DIG_T2, DIG_T3, DIG_P1, DIG_P2, DIG_P3,
+                                                     DIG_P4, DIG_P5, DIG_P6, DIG_P7, DIG_P8, DIG_P9};
+    static BmpManager::RawBmpData raw[BENCHMARK_SAMPLES];
+    static F32 pressure[BENCHMARK_SAMPLES];
+    static F32 temperature[BENCHMARK_SAMPLES];
+    static F32 altitude[BENCHMARK_SAMPLES];
+    fill_raw_samples(raw, BENCHMARK_SAMPLES);
+
+    // Accumulate results such that the scalar loop cannot be optimized away
+    F32 checksum = 0.0f;
+    const auto scalarStart = std::chrono::steady_clock::now();
+    for (FwSizeType pass = 0; pass < BENCHMARK_PASSES; pass++) {
+        for (FwSizeType i = 0; i < BENCHMARK_SAMPLES; i++) {
+            checksum += BmpManager::convert_raw_data(raw[i], calibration, 101325.0f).get_pressure();
+        }
+    }
+    const auto scalarEnd = std::chrono::steady_clock::now();
+
+    const auto batchStart = std::chrono::steady_clock::now();
+    for (FwSizeType pass = 0; pass < BENCHMARK_PASSES; pass++) {
+        BmpManager::convert_raw_batch(raw, BENCHMARK_SAMPLES, calibration, 101325.0f, pressure, temperature,
+                                      altitude);
+        checksum -= pressure[pass % BENCHMARK_SAMPLES];
+    }
+    const auto batchEnd = std::chrono::steady_clock::now();
+
+    // Batch with the polynomial altitude, which avoids a pow() per sample
+    AltitudeEngine engine;
+    engine.set_sea_level_pressure(101325.0f);
+    const auto polynomialStart = std::chrono::steady_clock::now();
+    for (FwSizeType pass = 0; pass < BENCHMARK_PASSES; pass++) {
+        BmpManager::convert_raw_batch(raw, BENCHMARK_SAMPLES, calibration, engine, AltitudeMethod::POLYNOMIAL,
+                                      pressure, temperature, altitude);
+        checksum += altitude[pass % BENCHMARK_SAMPLES];
+    }
+    const auto polynomialEnd = std::chrono::steady_clock::now();
+
+    const F64 samples = static_cast<F64>(BENCHMARK_SAMPLES * BENCHMARK_PASSES);
+    const F64 scalarSeconds = std::chrono::duration<F64>(scalarEnd - scalarStart).count();
+    const F64 batchSeconds = std::chrono::duration<F64>(batchEnd - batchStart).count();
+    const F64 polynomialSeconds = std::chrono::duration<F64>(polynomialEnd - polynomialStart).count();
+    ::printf("[ BENCHMARK ] scalar: %.0f samples/s, batch: %.0f samples/s, batch polynomial: %.0f samples/s "
+             "(checksum %f)\n",
+             (scalarSeconds > 0.0) ? samples / scalarSeconds : 0.0,
+             (batchSeconds > 0.0) ? samples / batchSeconds : 0.0,
+             (polynomialSeconds > 0.0) ? samples / polynomialSeconds : 0.0, static_cast<F64>(checksum));
+    ASSERT_GT(batchSeconds, 0.0);
+}
+
+void BmpManagerTester ::test_altitude_methods() {
+    const F64 lookupBound = AltitudeEngine::LOOKUP_TABLE_MAX_ERROR;
+    const F64 polynomialBound = AltitudeEngine::POLYNOMIAL_MAX_ERROR;
+    AltitudeEngine engine;
+    engine.set_sea_level_pressure(101325.0f);
+
+    F64 lookupError = 0.0;
+    F64 polynomialError = 0.0;
+    for (F64 pressure = 300.0; pressure <= 110000.0; pressure += 0.5) {
+        const F32 sample = static_cast<F32>(pressure);
+        const F64 expected = 44330.0 * (1.0 - std::pow(static_cast<F64>(sample) / 101325.0, 1.0 / 5.255));
+        lookupError = std::fmax(lookupError, std::fabs(engine.lookup(sample) - expected));
+        polynomialError = std::fmax(polynomialError, std::fabs(engine.polynomial(sample) - expected));
+        ASSERT_LT(std::fabs(engine.exact(sample) - expected), 0.01) << "Pressure " << pressure;
+    }
+    ::printf("[ ALTITUDE  ] max error lookup table: %f m, polynomial: %f m\n", lookupError, polynomialError);
+    ASSERT_LT(lookupError, lookupBound);
+    ASSERT_LT(polynomialError, polynomialBound);
+
+    // Changing the sea level pressure rebuilds the table
+    engine.set_sea_level_pressure(95000.0f);
+    ASSERT_EQ(engine.get_sea_level_pressure(), 95000.0f);
+    ASSERT_NEAR(engine.lookup(95000.0f), 0.0f, lookupBound);
+    ASSERT_NEAR(engine.polynomial(95000.0f), 0.0f, polynomialBound);
+
+    // Pressures outside of the table and invalid inputs fall back to the exact formula
+    ASSERT_EQ(engine.lookup(200.0f), engine.exact(200.0f));
+    ASSERT_EQ(engine.lookup(200000.0f), engine.exact(200000.0f));
+    ASSERT_EQ(engine.polynomial(0.5f), engine.exact(0.5f));
+    ASSERT_EQ(engine.lookup(0.0f), 0.0f);
+    ASSERT_EQ(engine.polynomial(-1.0f), 0.0f);
+}
+
+void BmpManagerTester ::test_altitude_parameter() {
+    const F32 lookupBound = AltitudeEngine::LOOKUP_TABLE_MAX_ERROR;
+    const F32 polynomialBound = AltitudeEngine::POLYNOMIAL_MAX_ERROR;
+    this->paramSet_ACQUISITION_MODE(AcquisitionMode::NORMAL, Fw::ParamValid::VALID);
+    this->paramSet_ALTITUDE_METHOD(AltitudeMethod::LOOKUP_TABLE, Fw::ParamValid::VALID);
+    this->component.loadParameters();
+    this->boot_sequence();
+    this->clearHistory();
+
+    // Pressure and temperature are unaffected, altitude is within the method's bound
+    const Bmp280Data expected = this->expected_reading();
+    this->tick();
+    ASSERT_TLM_Reading_SIZE(1);
+    Bmp280Data reading = this->tlmHistory_Reading->at(0).arg;
+    ASSERT_EQ(reading.get_pressure(), expected.get_pressure());
+    ASSERT_EQ(reading.get_temperature(), expected.get_temperature());
+    ASSERT_NEAR(reading.get_altitude(), expected.get_altitude(), lookupBound);
+
+    // Method changes apply on the next reading without reconfiguring the device
+    this->paramSet_ALTITUDE_METHOD(AltitudeMethod::POLYNOMIAL, Fw::ParamValid::VALID);
+    this->paramSend_ALTITUDE_METHOD(0, 0);
+    ASSERT_EVENTS_AltitudeMethodUpdated_SIZE(1);
+    ASSERT_EVENTS_AltitudeMethodUpdated(0, AltitudeMethod::POLYNOMIAL);
+    this->clearHistory();
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 1);
+    ASSERT_TLM_Reading_SIZE(1);
+    reading = this->tlmHistory_Reading->at(0).arg;
+    ASSERT_NEAR(reading.get_altitude(), expected.get_altitude(), polynomialBound);
+
+    // Sea level pressure changes are picked up by the table
+    this->paramSet_ALTITUDE_METHOD(AltitudeMethod::LOOKUP_TABLE, Fw::ParamValid::VALID);
+    this->paramSend_ALTITUDE_METHOD(0, 0);
+    this->paramSet_SEA_LEVEL_PRESSURE(expected.get_pressure(), Fw::ParamValid::VALID);
+    this->paramSend_SEA_LEVEL_PRESSURE(0, 0);
+    this->clearHistory();
+    this->tick();
+    ASSERT_TLM_Reading_SIZE(1);
+    ASSERT_NEAR(this->tlmHistory_Reading->at(0).arg.get_altitude(), 0.0f, lookupBound);
+}
+
+void BmpManagerTester ::test_burst_capture() {
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 10, 0));
+    this->component.configure(2);
+    this->paramSet_ACQUISITION_MODE(AcquisitionMode::NORMAL, Fw::ParamValid::VALID);
+    this->component.loadParameters();
+    this->boot_sequence(2);
+    this->clearHistory();
+
+    // Capture every other tick, two devices per tick
+    this->sendCmd_BURST_CAPTURE(0, 0, 5, 2);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, BmpManager::OPCODE_BURST_CAPTURE, 0, Fw::CmdResponse::OK);
+    ASSERT_EVENTS_BurstCaptureStarted(0, 5, 2);
+
+    // Telemetry continues at its own rate while the burst fills
+    for (U32 i = 0; i < 5; i++) {
+        this->setTestTime(Fw::Time(TimeBase::TB_NONE, 11, i * 1000));
+        this->tick();
+        ASSERT_EQ(this->transactionCount, 2);
+    }
+    ASSERT_TLM_Reading_SIZE(5);
+    ASSERT_TLM_Readings_SIZE(5);
+    ASSERT_PRODUCT_SEND_SIZE(1);
+    ASSERT_EVENTS_BurstCaptureComplete_SIZE(1);
+    ASSERT_EVENTS_BurstCaptureComplete(0, 5);
+
+    // Product holds both calibrations followed by the five raw samples
+    const FwSizeType dataSize = (2 * BmpManager::DpContainer::SIZE_OF_Calibration_RECORD) +
+                                (5 * BmpManager::DpContainer::SIZE_OF_RawSample_RECORD);
+    ASSERT_PRODUCT_GET_SIZE(1);
+    ASSERT_EQ(this->productGetHistory->at(0).size, dataSize);
+    Fw::Buffer buffer = this->productSendHistory->at(0).buffer;
+    Fw::DpContainer container;
+    container.setBuffer(buffer);
+    ASSERT_EQ(container.deserializeHeader(), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(container.getDataSize(), dataSize);
+
+    Fw::ExternalSerializeBuffer data(buffer.getData() + Fw::DpContainer::DATA_OFFSET, dataSize);
+    ASSERT_EQ(data.setBuffLen(dataSize), Fw::FW_SERIALIZE_OK);
+    FwDpIdType id = 0;
+    for (U8 device = 0; device < 2; device++) {
+        Bmp280Calibration calibration;
+        ASSERT_EQ(data.deserialize(id), Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(id, this->component.getIdBase() + BmpManager::RecordId::Calibration);
+        ASSERT_EQ(data.deserialize(calibration), Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(calibration.get_device(), device);
+        ASSERT_EQ(calibration.get_dig_T1(), DIG_T1);
+        ASSERT_EQ(calibration.get_dig_P9(), DIG_P9);
+    }
+    // Ticks 0, 2, and 4 were captured, the last tick only until the requested count was reached
+    const U32 capturedTicks[] = {0, 0, 2, 2, 4};
+    for (U32 i = 0; i < 5; i++) {
+        Bmp280RawSample sample;
+        ASSERT_EQ(data.deserialize(id), Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(id, this->component.getIdBase() + BmpManager::RecordId::RawSample);
+        ASSERT_EQ(data.deserialize(sample), Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(sample.get_device(), i % 2);
+        ASSERT_EQ(sample.get_seconds(), 11);
+        ASSERT_EQ(sample.get_useconds(), capturedTicks[i] * 1000);
+        ASSERT_EQ(sample.get_pressure(), ADC_P);
+        ASSERT_EQ(sample.get_temperature(), ADC_T);
+    }
+    ASSERT_EQ(data.getBuffLeft(), 0);
+
+    // Nothing further is captured once the burst is complete
+    this->clearHistory();
+    this->tick();
+    ASSERT_TLM_Reading_SIZE(1);
+    ASSERT_PRODUCT_SEND_SIZE(0);
+}
+
+void BmpManagerTester ::test_burst_capture_errors() {
+    this->paramSet_ACQUISITION_MODE(AcquisitionMode::NORMAL, Fw::ParamValid::VALID);
+    this->component.loadParameters();
+    this->boot_sequence();
+    this->clearHistory();
+
+    // Zero counts, counts beyond the capacity, and zero divisors are rejected
+    this->sendCmd_BURST_CAPTURE(0, 0, 0, 1);
+    this->sendCmd_BURST_CAPTURE(0, 1, BURST_CAPACITY + 1, 1);
+    this->sendCmd_BURST_CAPTURE(0, 2, 1, 0);
+    ASSERT_CMD_RESPONSE_SIZE(3);
+    for (U32 i = 0; i < 3; i++) {
+        ASSERT_CMD_RESPONSE(i, BmpManager::OPCODE_BURST_CAPTURE, i, Fw::CmdResponse::VALIDATION_ERROR);
+    }
+    ASSERT_EVENTS_BurstCaptureInvalid_SIZE(3);
+
+    // A second capture is refused while one is in progress, and an abort discards the samples
+    this->clearHistory();
+    this->sendCmd_BURST_CAPTURE(0, 0, 10, 1);
+    this->tick();
+    this->sendCmd_BURST_CAPTURE(0, 1, 10, 1);
+    ASSERT_CMD_RESPONSE(1, BmpManager::OPCODE_BURST_CAPTURE, 1, Fw::CmdResponse::BUSY);
+    ASSERT_EVENTS_BurstCaptureBusy_SIZE(1);
+    this->sendCmd_BURST_ABORT(0, 2);
+    ASSERT_CMD_RESPONSE(2, BmpManager::OPCODE_BURST_ABORT, 2, Fw::CmdResponse::OK);
+    ASSERT_EVENTS_BurstCaptureAborted(0, 1);
+    for (U32 i = 0; i < 10; i++) {
+        this->tick();
+    }
+    ASSERT_PRODUCT_GET_SIZE(0);
+    ASSERT_PRODUCT_SEND_SIZE(0);
+
+    // Failure to allocate the product is reported and ends the capture
+    this->clearHistory();
+    this->productAvailable = false;
+    this->sendCmd_BURST_CAPTURE(0, 0, 2, 1);
+    this->tick();
+    this->tick();
+    ASSERT_PRODUCT_GET_SIZE(1);
+    ASSERT_PRODUCT_SEND_SIZE(0);
+    ASSERT_EVENTS_BurstProductFailure_SIZE(1);
+    ASSERT_EVENTS_BurstProductFailure(0, 2);
+    this->sendCmd_BURST_CAPTURE(0, 1, 2, 1);
+    ASSERT_CMD_RESPONSE(1, BmpManager::OPCODE_BURST_CAPTURE, 1, Fw::CmdResponse::OK);
+}
+
+void BmpManagerTester ::test_filter_chain() {
+    FilterChain filter;
+    ASSERT_TRUE(filter.is_passthrough());
+    ASSERT_EQ(filter.update(42.0f), 42.0f);
+
+    // Median removes a single spike entirely
+    filter.configure(3, 1, 1.0f);
+    ASSERT_FALSE(filter.is_passthrough());
+    const F32 spiky[] = {1.0f, 2.0f, 100.0f, 3.0f, 4.0f};
+    const F32 medians[] = {1.0f, 1.5f, 2.0f, 3.0f, 4.0f};
+    for (U32 i = 0; i < 5; i++) {
+        ASSERT_EQ(filter.update(spiky[i]), medians[i]);
+    }
+
+    // Boxcar averages the samples seen so far until the window fills
+    filter.configure(1, 4, 1.0f);
+    const F32 averages[] = {1.0f, 1.5f, 2.0f, 2.5f, 3.5f, 4.5f};
+    for (U32 i = 0; i < 6; i++) {
+        ASSERT_EQ(filter.update(static_cast<F32>(i + 1)), averages[i]);
+    }
+
+    // Boxcar stays accurate at pressure magnitudes over many updates
+    for (U32 i = 0; i < 100000; i++) {
+        filter.update(101325.0f + static_cast<F32>(i % 4) * 0.25f);
+    }
+    ASSERT_NEAR(filter.update(101325.0f), 101325.375f, 0.01f);
+
+    // IIR is seeded with the first sample then approaches a step geometrically
+    filter.configure(1, 1, 0.5f);
+    ASSERT_EQ(filter.update(0.0f), 0.0f);
+    ASSERT_EQ(filter.update(8.0f), 4.0f);
+    ASSERT_EQ(filter.update(8.0f), 6.0f);
+    ASSERT_EQ(filter.update(8.0f), 7.0f);
+
+    // Reconfiguring with the same values keeps the history, reset clears it
+    filter.configure(1, 1, 0.5f);
+    ASSERT_EQ(filter.update(8.0f), 7.5f);
+    filter.reset();
+    ASSERT_EQ(filter.update(8.0f), 8.0f);
+}
+
+void BmpManagerTester ::test_output_decimation() {
+    this->paramSet_ACQUISITION_MODE(AcquisitionMode::NORMAL, Fw::ParamValid::VALID);
+    this->paramSet_FILTER_MEDIAN_LENGTH(3, Fw::ParamValid::VALID);
+    this->paramSet_OUTPUT_DECIMATION(4, Fw::ParamValid::VALID);
+    this->component.loadParameters();
+    this->boot_sequence();
+    this->clearHistory();
+
+    // Bus is read every tick, a reading is published every fourth tick
+    for (U32 i = 0; i < 8; i++) {
+        // Single conversion glitch on the third tick
+        this->registers[0][0xF7] = (i == 2) ? 0x10 : static_cast<U8>(ADC_P >> 12);
+        this->tick();
+        ASSERT_EQ(this->transactionCount, 1);
+        ASSERT_TLM_Reading_SIZE((i + 1) / 4);
+    }
+
+    // Glitch was removed by the median filter
+    ASSERT_TLM_Reading(0, this->expected_reading());
+    ASSERT_TLM_Reading(1, this->expected_reading());
+
+    // Parameter updates are reported
+    this->paramSet_FILTER_BOXCAR_LENGTH(8, Fw::ParamValid::VALID);
+    this->paramSend_FILTER_BOXCAR_LENGTH(0, 0);
+    ASSERT_EVENTS_FilterUpdated_SIZE(1);
+    ASSERT_EVENTS_FilterUpdated(0, 3, 8, 1.0f);
+    this->paramSet_OUTPUT_DECIMATION(1, Fw::ParamValid::VALID);
+    this->paramSend_OUTPUT_DECIMATION(0, 0);
+    ASSERT_EVENTS_OutputDecimationUpdated(0, 1);
+    this->clearHistory();
+    this->tick();
+    ASSERT_TLM_Reading_SIZE(1);
+}
+
+void BmpManagerTester ::test_calibration_cache_store() {
+    (void)Os::FileSystem::removeFile(CACHE_PATH);
+    this->component.configure(1, CACHE_PATH);
+    this->component.loadParameters();
+    this->boot_sequence();
+
+    // One record per possible device
+    FwSizeType size = 0;
+    ASSERT_EQ(Os::FileSystem::getFileSize(CACHE_PATH, size), Os::FileSystem::OP_OK);
+    ASSERT_EQ(size, MAX_DEVICES * BmpManager::CACHE_RECORD_SIZE);
+}
+
+void BmpManagerTester ::test_calibration_cache_restore() {
+    this->component.configure(1, CACHE_PATH);
+    this->paramSet_ACQUISITION_MODE(AcquisitionMode::NORMAL, Fw::ParamValid::VALID);
+    this->component.loadParameters();
+
+    // First tick verifies the chip id and configures, without a reset or calibration read
+    this->tick();
+    ASSERT_EVENTS_CalibrationCacheLoaded_SIZE(1);
+    ASSERT_EVENTS_CalibrationCacheLoaded(0, 1);
+    ASSERT_EQ(this->transactionCount, 3);
+    ASSERT_EQ(this->transactions[0].data[0], 0xD0);
+    const U8 normal[] = {0x74, 0x20 | 0x04 | 0x03};
+    this->verify_write(2, normal, sizeof(normal));
+
+    // Data flows on the second tick with the cached calibration
+    this->tick();
+    ASSERT_TLM_Reading_SIZE(1);
+    ASSERT_TLM_Reading(0, this->expected_reading());
+    (void)Os::FileSystem::removeFile(CACHE_PATH);
+}
+
+void BmpManagerTester ::test_calibration_cache_invalid() {
+    // Record claims a BMP280 but its CRC does not match
+    U8 contents[MAX_DEVICES * BmpManager::CACHE_RECORD_SIZE] = {0};
+    contents[0] = BmpManager::CHIP_ID_VALUE;
+    Os::File file;
+    ASSERT_EQ(file.open(CACHE_PATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    FwSizeType size = sizeof(contents);
+    ASSERT_EQ(file.write(contents, size), Os::File::OP_OK);
+    file.close();
+
+    this->component.configure(1, CACHE_PATH);
+    this->component.loadParameters();
+    this->tick();
+    ASSERT_EVENTS_CalibrationCacheInvalid_SIZE(1);
+    ASSERT_EVENTS_CalibrationCacheInvalid(0, 0);
+    ASSERT_EVENTS_CalibrationCacheLoaded(0, 0);
+
+    // Full sequence started with a reset
+    ASSERT_EQ(this->transactionCount, 1);
+    const U8 reset[] = {0x60, 0xB6};
+    this->verify_write(0, reset, sizeof(reset));
+    (void)Os::FileSystem::removeFile(CACHE_PATH);
+}
+
+void BmpManagerTester ::test_fast_recovery() {
+    this->paramSet_ACQUISITION_MODE(AcquisitionMode::NORMAL, Fw::ParamValid::VALID);
+    this->component.loadParameters();
+    this->boot_sequence();
+    this->clearHistory();
+
+    // Floating MISO reads all ones
+    U8 saved[BmpManager::MEASUREMENT_DATA_LENGTH];
+    ::memcpy(saved, &this->registers[0][0xF7], sizeof(saved));
+    ::memset(&this->registers[0][0xF7], 0xFF, sizeof(saved));
+    this->tick();
+    ASSERT_TLM_Reading_SIZE(0);
+    ASSERT_EVENTS_DeviceReadFailure_SIZE(1);
+    ASSERT_EVENTS_DeviceReadFailure(0, 0);
+
+    // Bus recovers: chip id check and configuration in one tick, data on the next
+    ::memcpy(&this->registers[0][0xF7], saved, sizeof(saved));
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 3);
+    ASSERT_EQ(this->transactions[0].data[0], 0xD0);
+    ASSERT_TLM_Reading_SIZE(0);
+    this->tick();
+    ASSERT_TLM_Reading_SIZE(1);
+    ASSERT_TLM_Reading(0, this->expected_reading());
+
+    // Forced mode garbage status is a failure rather than a conversion in progress
+    this->paramSet_ACQUISITION_MODE(AcquisitionMode::FORCED, Fw::ParamValid::VALID);
+    this->paramSend_ACQUISITION_MODE(0, 0);
+    this->tick();
+    this->clearHistory();
+    this->registers[0][BmpManager::STATUS_REGISTER] = 0xFF;
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 1);
+    ASSERT_EVENTS_DeviceReadFailure_SIZE(1);
+
+    // A failed chip id check during recovery falls back to the full sequence
+    this->registers[0][BmpManager::CHIP_ID_REGISTER] = 0x00;
+    this->tick();
+    ASSERT_EVENTS_ChipIdCheckFailure_SIZE(1);
+    this->tick();
+    const U8 reset[] = {0x60, 0xB6};
+    this->verify_write(0, reset, sizeof(reset));
+}
+
+void BmpManagerTester ::test_emulator_loop() {
+    this->component.configure(2);
+    this->component.loadParameters();
+    this->connect_emulator();
+    ASSERT_TRUE(this->emulator.set_environment(90000.0f, 15.0f));
+
+    // Six ticks to boot, then each forced read returns the conversion triggered on the tick before. Default 1x
+    // oversampling has 16-bit resolution, about 3 Pa.
+    for (U32 i = 0; i < 8; i++) {
+        this->emulator_tick();
+    }
+    ASSERT_TLM_Reading_SIZE(1);
+    ASSERT_NEAR(this->tlmHistory_Reading->at(0).arg.get_pressure(), 90000.0f, 3.0f);
+    ASSERT_NEAR(this->tlmHistory_Reading->at(0).arg.get_temperature(), 15.0f, 0.02f);
+    ASSERT_TLM_Readings_SIZE(1);
+    ASSERT_EVENTS_SIZE(0);
+
+    // Each running tick polls status, triggers, and reads every device, conversions finish between ticks
+    const U32 transactions = this->emulator.get_transaction_count();
+    const U32 conversions = this->emulator.get_conversion_count(1);
+    this->emulator_tick();
+    ASSERT_EQ(this->emulator.get_transaction_count() - transactions, 6);
+    ASSERT_EQ(this->emulator.get_conversion_count(1) - conversions, 1);
+    ASSERT_TLM_Readings_SIZE(1);
+    ASSERT_NEAR(this->tlmHistory_Readings->at(0).arg[1].get_pressure(), 90000.0f, 3.0f);
+
+    // Conversions latched after an environment change report it
+    ASSERT_TRUE(this->emulator.set_environment(85000.0f, 20.0f));
+    this->emulator_tick();
+    ASSERT_NEAR(this->tlmHistory_Reading->at(0).arg.get_pressure(), 85000.0f, 3.0f);
+    ASSERT_NEAR(this->tlmHistory_Reading->at(0).arg.get_temperature(), 20.0f, 0.02f);
+}
+
+void BmpManagerTester ::test_emulator_faults() {
+    this->component.loadParameters();
+    this->connect_emulator();
+    for (U32 i = 0; i < 8; i++) {
+        this->emulator_tick();
+    }
+    ASSERT_TLM_Reading_SIZE(1);
+
+    // Floating MISO: the status poll reads reserved bits, and fast recovery then finds no chip id
+    ASSERT_TRUE(this->emulator.inject_fault(0, EmulatorFault::MISO_HIGH));
+    this->emulator_tick();
+    ASSERT_EVENTS_DeviceReadFailure_SIZE(1);
+    ASSERT_TLM_Reading_SIZE(0);
+    ASSERT_TLM_RunningDevices(0, 0);
+    this->emulator_tick();
+    ASSERT_EVENTS_ChipIdCheckFailure_SIZE(1);
+
+    // Once the line recovers the full reset sequence brings the device back
+    ASSERT_TRUE(this->emulator.inject_fault(0, EmulatorFault::NONE));
+    for (U32 i = 0; i < 8; i++) {
+        this->emulator_tick();
+    }
+    ASSERT_TLM_Reading_SIZE(1);
+    ASSERT_NEAR(this->tlmHistory_Reading->at(0).arg.get_pressure(), 100653.27f, 3.0f);
+    ASSERT_EVENTS_SIZE(0);
+
+    // A device stuck measuring is waited on without events, and resumes with the held conversion
+    ASSERT_TRUE(this->emulator.inject_fault(0, EmulatorFault::STUCK_BUSY));
+    for (U32 i = 0; i < 5; i++) {
+        this->emulator_tick();
+        ASSERT_TLM_Reading_SIZE(0);
+        ASSERT_EVENTS_SIZE(0);
+    }
+    ASSERT_TRUE(this->emulator.inject_fault(0, EmulatorFault::NONE));
+    this->emulator_tick();
+    ASSERT_TLM_Reading_SIZE(1);
+    ASSERT_NEAR(this->tlmHistory_Reading->at(0).arg.get_pressure(), 100653.27f, 3.0f);
+
+    // A replaced device fails fast recovery and is rebooted
+    ASSERT_TRUE(this->emulator.inject_fault(0, EmulatorFault::MISO_LOW));
+    this->emulator_tick();
+    ASSERT_EVENTS_DeviceReadFailure_SIZE(1);
+    ASSERT_TRUE(this->emulator.inject_fault(0, EmulatorFault::WRONG_CHIP_ID));
+    this->emulator_tick();
+    ASSERT_EVENTS_ChipIdCheckFailure_SIZE(1);
+    ASSERT_TLM_Reading_SIZE(0);
+}
+
+void BmpManagerTester ::test_emulator_benchmark() {
+    this->component.loadParameters();
+    this->connect_emulator();
+    for (U32 i = 0; i < 8; i++) {
+        this->emulator_tick();
+    }
+
+    const AcquisitionMode modes[] = {AcquisitionMode::FORCED, AcquisitionMode::PIPELINED, AcquisitionMode::NORMAL};
+    for (const AcquisitionMode mode : modes) {
+        this->paramSet_ACQUISITION_MODE(mode, Fw::ParamValid::VALID);
+        this->paramSend_ACQUISITION_MODE(0, 0);
+        this->emulator_tick();
+
+        // Only the run port call is timed, history bookkeeping is excluded
+        std::chrono::steady_clock::duration elapsed(0);
+        U32 readings = 0;
+        for (U32 i = 0; i < EMULATOR_BENCHMARK_TICKS; i++) {
+            this->emulatorTime += EMULATOR_TICK_US;
+            this->setTestTime(Fw::Time(TimeBase::TB_NONE, static_cast<U32>(this->emulatorTime / 1000000),
+                                       static_cast<U32>(this->emulatorTime % 1000000)));
+            this->clearHistory();
+            const auto start = std::chrono::steady_clock::now();
+            this->invoke_to_run(0, 0);
+            elapsed += std::chrono::steady_clock::now() - start;
+            readings += static_cast<U32>(this->tlmHistory_Reading->size());
+        }
+        const F64 nanoseconds = std::chrono::duration<F64, std::nano>(elapsed).count();
+        ::printf("[ BENCHMARK ] acquisition mode %d: %.0f ns/tick including the emulator\n",
+                 static_cast<int>(mode.e), nanoseconds / static_cast<F64>(EMULATOR_BENCHMARK_TICKS));
+        // Pipelined acquisition only triggers on its first tick
+        ASSERT_GE(readings, EMULATOR_BENCHMARK_TICKS - 1);
+    }
+    ASSERT_GT(this->emulator.get_conversion_count(0), EMULATOR_BENCHMARK_TICKS);
+}
+
+void BmpManagerTester ::test_off_rate_group() {
+    // Acquisitions are paced separately from run, as by a second rate group
+    this->acquireForwarded = false;
+    this->component.loadParameters();
+
+    // Boot on the component thread, nothing is published until the run port ticks
+    for (U32 i = 0; i < 6; i++) {
+        this->acquire();
+    }
+    ASSERT_TLM_SIZE(0);
+    ASSERT_EVENTS_SIZE(0);
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 0);
+    ASSERT_TLM_SIZE(1);
+    ASSERT_TLM_RunningDevices(0, 0x1);
+
+    // A conversion acquired between ticks is published once, stamped with its acquisition time
+    this->clearHistory();
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 100, 0));
+    this->acquire();
+    ASSERT_EQ(this->transactionCount, 3);
+    ASSERT_TLM_SIZE(0);
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 100, 5000));
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 0);
+    ASSERT_TLM_SIZE(3);
+    ASSERT_TLM_Health_SIZE(1);
+    ASSERT_TLM_Vertical_SIZE(1);
+    ASSERT_TLM_Reading(0, this->expected_reading());
+    ASSERT_EQ(this->tlmHistory_Reading->at(0).time, Fw::Time(TimeBase::TB_NONE, 100, 0));
+    this->clearHistory();
+    this->tick();
+    ASSERT_TLM_SIZE(0);
+
+    // Several conversions between ticks publish only the latest
+    for (U32 i = 0; i < 3; i++) {
+        this->acquire();
+    }
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 0);
+    ASSERT_TLM_Reading_SIZE(1);
+
+    // Parameter updates still reconfigure the device on the next acquisition
+    this->clearHistory();
+    this->paramSet_ACQUISITION_MODE(AcquisitionMode::NORMAL, Fw::ParamValid::VALID);
+    this->paramSend_ACQUISITION_MODE(0, 0);
+    this->acquire();
+    const U8 configure[] = {0x74, 0x20 | 0x04, 0x75, 0x00};
+    this->verify_write(0, configure, sizeof(configure));
+    this->acquire();
+    ASSERT_EQ(this->transactionCount, 1);
+    ASSERT_EQ(this->transactions[0].data[0], 0xF7);
+    this->tick();
+    ASSERT_TLM_Reading_SIZE(1);
+}
+
+void BmpManagerTester ::test_off_rate_group_benchmark() {
+    this->acquireForwarded = false;
+    this->component.loadParameters();
+    this->connect_emulator();
+    for (U32 i = 0; i < 8; i++) {
+        this->emulatorTime += EMULATOR_TICK_US;
+        this->setTestTime(Fw::Time(TimeBase::TB_NONE, static_cast<U32>(this->emulatorTime / 1000000),
+                                   static_cast<U32>(this->emulatorTime % 1000000)));
+        this->acquire();
+    }
+
+    const AcquisitionMode modes[] = {AcquisitionMode::FORCED, AcquisitionMode::PIPELINED, AcquisitionMode::NORMAL};
+    for (const AcquisitionMode mode : modes) {
+        this->paramSet_ACQUISITION_MODE(mode, Fw::ParamValid::VALID);
+        this->paramSend_ACQUISITION_MODE(0, 0);
+        this->acquire();
+
+        // The acquisition stands in for the component thread, only the rate group's run port call is timed
+        std::chrono::steady_clock::duration elapsed(0);
+        U32 readings = 0;
+        for (U32 i = 0; i < EMULATOR_BENCHMARK_TICKS; i++) {
+            this->emulatorTime += EMULATOR_TICK_US;
+            this->setTestTime(Fw::Time(TimeBase::TB_NONE, static_cast<U32>(this->emulatorTime / 1000000),
+                                       static_cast<U32>(this->emulatorTime % 1000000)));
+            this->clearHistory();
+            this->acquire();
+            const auto start = std::chrono::steady_clock::now();
+            this->invoke_to_run(0, 0);
+            elapsed += std::chrono::steady_clock::now() - start;
+            readings += static_cast<U32>(this->tlmHistory_Reading->size());
+        }
+        const F64 nanoseconds = std::chrono::duration<F64, std::nano>(elapsed).count();
+        ::printf("[ BENCHMARK ] acquisition mode %d: %.0f ns/tick with acquisition off the rate group\n",
+                 static_cast<int>(mode.e), nanoseconds / static_cast<F64>(EMULATOR_BENCHMARK_TICKS));
+        // Pipelined acquisition only triggers on its first tick
+        ASSERT_GE(readings, EMULATOR_BENCHMARK_TICKS - 1);
+    }
+    ASSERT_GT(this->emulator.get_conversion_count(0), EMULATOR_BENCHMARK_TICKS);
+}
+
+void BmpManagerTester ::test_backoff() {
+    // Device never reports its chip id, as when unplugged
+    this->registers[0][BmpManager::CHIP_ID_REGISTER] = 0x00;
+    this->component.loadParameters();
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 1, 0));
+
+    // First five failures are retried at once, a reset and a chip id read every four ticks. The sixth starts the
+    // backoff.
+    FwSizeType transactions = 0;
+    FwSizeType unresponsive = 0;
+    for (U32 i = 0; i < 24; i++) {
+        this->clearHistory();
+        this->tick();
+        transactions += this->transactionCount;
+        unresponsive += this->eventHistory_DeviceUnresponsive->size();
+    }
+    ASSERT_EQ(transactions, 12);
+    ASSERT_EQ(unresponsive, 1);
+
+    // Backoff doubles from 2 ticks up to the 256 tick cap, which follows the thirteenth failure on tick 306. A dead
+    // device then costs two transactions every 260 ticks.
+    for (U32 i = 0; i < 300; i++) {
+        this->clearHistory();
+        this->tick();
+        unresponsive += this->eventHistory_DeviceUnresponsive->size();
+    }
+    transactions = 0;
+    for (U32 i = 0; i < 2600; i++) {
+        this->clearHistory();
+        this->tick();
+        transactions += this->transactionCount;
+        unresponsive += this->eventHistory_DeviceUnresponsive->size();
+    }
+    ASSERT_EQ(transactions, 20);
+    ASSERT_EQ(unresponsive, 1);
+
+    // Health on tick 2925 reports the twenty-third failure, 19 ticks into its backoff, and that no sample was taken
+    this->clearHistory();
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 2, 0));
+    this->tick();
+    ASSERT_TLM_Health_SIZE(1);
+    const Bmp280Health failing = this->tlmHistory_Health->at(0).arg[0];
+    ASSERT_EQ(failing.get_state(), Bmp280State::BACKOFF);
+    ASSERT_EQ(failing.get_timeInState(), 1000);
+    ASSERT_EQ(failing.get_sampleAge(), 0xFFFFFFFF);
+    ASSERT_EQ(failing.get_consecutiveFailures(), 23);
+    ASSERT_EQ(failing.get_totalResets(), 23);
+
+    // Once the device answers it boots after the remaining 237 ticks of backoff, and the first sample clears the
+    // failures
+    this->registers[0][BmpManager::CHIP_ID_REGISTER] = BmpManager::CHIP_ID_VALUE;
+    bool running = false;
+    for (U32 i = 0; (i < 300) && !running; i++) {
+        this->clearHistory();
+        this->tick();
+        running = (this->tlmHistory_Reading->size() > 0);
+    }
+    ASSERT_TRUE(running);
+    ASSERT_EVENTS_DeviceRecovered_SIZE(1);
+    ASSERT_EVENTS_DeviceRecovered(0, 0, 23);
+
+    this->clearHistory();
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, 3, 250000));
+    this->tick();
+    ASSERT_TLM_Health_SIZE(1);
+    const Bmp280Health& health = this->tlmHistory_Health->at(0).arg[0];
+    ASSERT_EQ(health.get_state(), Bmp280State::RUNNING);
+    ASSERT_EQ(health.get_timeInState(), 1250);
+    ASSERT_EQ(health.get_sampleAge(), 0);
+    ASSERT_EQ(health.get_consecutiveFailures(), 0);
+    ASSERT_EQ(health.get_totalResets(), 24);
+}
+
+void BmpManagerTester ::test_vertical_speed_filter() {
+    const U32 periodUs = 10000;
+    const F32 period = 0.01f;
+    const F32 processNoise = 1.0f;
+    const F32 measurementNoise = 0.2f;
+
+    // Steady-state gains satisfy Kalata's relation lambda^2 = beta^2 / (1 - alpha)
+    F32 alpha = 0.0f;
+    F32 beta = 0.0f;
+    VerticalSpeedFilter::steady_state_gains(processNoise, measurementNoise, period, alpha, beta);
+    const F64 lambda = static_cast<F64>(processNoise) * period * period / measurementNoise;
+    ASSERT_GT(alpha, 0.0f);
+    ASSERT_LT(alpha, 1.0f);
+    ASSERT_GT(beta, 0.0f);
+    ASSERT_NEAR(static_cast<F64>(beta) * beta / (1.0 - alpha), lambda * lambda, lambda * lambda * 1.0e-3);
+
+    // Hovering with noisy altitude: estimates are smoother than the samples and the speed is unbiased
+    std::mt19937 generator(12345);
+    std::normal_distribution<F64> noise(0.0, measurementNoise);
+    VerticalSpeedFilter filter;
+    filter.configure(processNoise, measurementNoise);
+    F64 altitudeSquares = 0.0;
+    F64 speedSquares = 0.0;
+    for (U32 i = 0; i < VERTICAL_SAMPLES; i++) {
+        filter.update(static_cast<F32>(500.0 + noise(generator)), periodUs);
+        if (i >= VERTICAL_SETTLE_SAMPLES) {
+            const F64 altitudeError = filter.get_altitude() - 500.0;
+            altitudeSquares += altitudeError * altitudeError;
+            speedSquares += static_cast<F64>(filter.get_speed()) * filter.get_speed();
+        }
+    }
+    const F64 checked = static_cast<F64>(VERTICAL_SAMPLES - VERTICAL_SETTLE_SAMPLES);
+    ASSERT_NEAR(filter.get_alpha(), alpha, 1.0e-6f);
+    ASSERT_NEAR(filter.get_beta(), beta, 1.0e-6f);
+    ASSERT_LT(std::sqrt(altitudeSquares / checked), 0.5 * measurementNoise);
+    ASSERT_LT(std::sqrt(speedSquares / checked), 0.1);
+
+    // Climbing at a constant 5 m/s is tracked without lag
+    filter.reset();
+    F64 altitudeBias = 0.0;
+    F64 speedBias = 0.0;
+    for (U32 i = 0; i < VERTICAL_SAMPLES; i++) {
+        const F64 expected = 500.0 + 5.0 * i * period;
+        filter.update(static_cast<F32>(expected + noise(generator)), periodUs);
+        if (i >= VERTICAL_SETTLE_SAMPLES) {
+            altitudeBias += filter.get_altitude() - expected;
+            speedBias += filter.get_speed() - 5.0;
+        }
+    }
+    ASSERT_LT(std::fabs(altitudeBias / checked), 0.02);
+    ASSERT_LT(std::fabs(speedBias / checked), 0.03);
+
+    // Constant 2 m/s^2 acceleration lags by the alpha-beta steady-state errors a T^2 (1 - alpha) / beta and
+    // a T (alpha - beta / 2) / beta
+    filter.reset();
+    F64 expected = 0.0;
+    for (U32 i = 0; i < VERTICAL_SAMPLES; i++) {
+        const F64 time = i * period;
+        expected = 500.0 + time * time;
+        filter.update(static_cast<F32>(expected), periodUs);
+    }
+    const F64 acceleration = 2.0;
+    const F64 altitudeLag = acceleration * period * period * (1.0 - alpha) / beta;
+    const F64 speedLag = acceleration * period * (alpha - beta / 2.0) / beta;
+    ASSERT_NEAR(expected - filter.get_altitude(), altitudeLag, 0.01 * altitudeLag);
+    ASSERT_NEAR(acceleration * (VERTICAL_SAMPLES - 1) * period - filter.get_speed(), speedLag, 0.01 * speedLag);
+
+    // Jitter up to an eighth of the period keeps the gains, slower sampling recomputes them
+    filter.update(static_cast<F32>(expected), periodUs + periodUs / 10);
+    ASSERT_NEAR(filter.get_alpha(), alpha, 1.0e-6f);
+    filter.update(static_cast<F32>(expected), 2 * periodUs);
+    VerticalSpeedFilter::steady_state_gains(processNoise, measurementNoise, 2 * period, alpha, beta);
+    ASSERT_NEAR(filter.get_alpha(), alpha, 1.0e-6f);
+
+    // Unknown periods, gaps, and jumps beyond MAX_RESIDUAL restart at the sample with zero speed
+    filter.update(100.0f, 0);
+    ASSERT_NEAR(filter.get_altitude(), 100.0f, 1.0e-4f);
+    ASSERT_EQ(filter.get_speed(), 0.0f);
+    filter.update(101.0f, periodUs);
+    ASSERT_NE(filter.get_speed(), 0.0f);
+    filter.update(200.0f, VerticalSpeedFilter::MAX_PERIOD_US + 1);
+    ASSERT_NEAR(filter.get_altitude(), 200.0f, 1.0e-4f);
+    ASSERT_EQ(filter.get_speed(), 0.0f);
+    filter.update(200.0f + 2.0f * VerticalSpeedFilter::MAX_RESIDUAL, periodUs);
+    ASSERT_NEAR(filter.get_altitude(), 200.0f + 2.0f * VerticalSpeedFilter::MAX_RESIDUAL, 1.0e-3f);
+    ASSERT_EQ(filter.get_speed(), 0.0f);
+
+    // Samples that are not a number are ignored
+    const F32 held = filter.get_altitude();
+    filter.update(std::nanf(""), periodUs);
+    ASSERT_EQ(filter.get_altitude(), held);
+}
+
+void BmpManagerTester ::test_vertical_speed() {
+    this->component.loadParameters();
+    this->connect_emulator();
+
+    // Hover at 500 m while the device boots and the filter settles
+    F32 altitude = 500.0f;
+    ASSERT_TRUE(this->emulator.set_environment(pressure_at(altitude), 15.0f));
+    for (U32 i = 0; i < 100; i++) {
+        this->emulator_tick();
+    }
+    ASSERT_TLM_Vertical_SIZE(1);
+    ASSERT_NEAR(this->tlmHistory_Vertical->at(0).arg.get_altitude(), altitude, 1.0f);
+    ASSERT_NEAR(this->tlmHistory_Vertical->at(0).arg.get_speed(), 0.0f, 0.5f);
+    ASSERT_EQ(this->tlmHistory_Vertical->at(0).time, this->tlmHistory_Reading->at(0).time);
+
+    // Climb at 20 m/s for ten seconds, the speed settles within a few seconds
+    const F32 climbRate = 20.0f;
+    for (U32 i = 0; i < 1000; i++) {
+        altitude += climbRate * static_cast<F32>(EMULATOR_TICK_US) * 1.0e-6f;
+        ASSERT_TRUE(this->emulator.set_environment(pressure_at(altitude), 15.0f));
+        this->emulator_tick();
+    }
+    ASSERT_TLM_Vertical_SIZE(1);
+    ASSERT_NEAR(this->tlmHistory_Vertical->at(0).arg.get_altitude(), altitude, 1.0f);
+    ASSERT_NEAR(this->tlmHistory_Vertical->at(0).arg.get_speed(), climbRate, 0.5f);
+
+    // Level off
+    for (U32 i = 0; i < 500; i++) {
+        this->emulator_tick();
+    }
+    ASSERT_NEAR(this->tlmHistory_Vertical->at(0).arg.get_altitude(), altitude, 1.0f);
+    ASSERT_NEAR(this->tlmHistory_Vertical->at(0).arg.get_speed(), 0.0f, 0.5f);
+    ASSERT_EVENTS_SIZE(0);
+}
+
+void BmpManagerTester ::test_vertical_speed_benchmark() {
+    const BmpManager::CalibrationData calibration = {DIG_T1, DIG_T2, DIG_T3, DIG_P1, DIG_P2, DIG_P3,
+                                                     DIG_P4, DIG_P5, DIG_P6, DIG_P7, DIG_P8, DIG_P9};
+    static BmpManager::RawBmpData raw[BENCHMARK_SAMPLES];
+    static F32 altitude[BENCHMARK_SAMPLES];
+    fill_raw_samples(raw, BENCHMARK_SAMPLES);
+    // Climbing altitude with a few centimetres of jitter keeps the filter on its update path
+    for (FwSizeType i = 0; i < BENCHMARK_SAMPLES; i++) {
+        altitude[i] = 500.0f + 0.05f * static_cast<F32>(i) + 0.01f * static_cast<F32>(raw[i].pressure & 0x7);
+    }
+
+    // Accumulate results such that neither loop can be optimized away
+    F32 checksum = 0.0f;
+    const auto convertStart = std::chrono::steady_clock::now();
+    for (FwSizeType pass = 0; pass < BENCHMARK_PASSES; pass++) {
+        for (FwSizeType i = 0; i < BENCHMARK_SAMPLES; i++) {
+            checksum += BmpManager::convert_raw_data(raw[i], calibration, 101325.0f).get_altitude();
+        }
+    }
+    const auto convertEnd = std::chrono::steady_clock::now();
+
+    VerticalSpeedFilter filter;
+    const auto filterStart = std::chrono::steady_clock::now();
+    for (FwSizeType pass = 0; pass < BENCHMARK_PASSES; pass++) {
+        for (FwSizeType i = 0; i < BENCHMARK_SAMPLES; i++) {
+            filter.update(altitude[i], EMULATOR_TICK_US);
+        }
+        checksum -= filter.get_speed();
+    }
+    const auto filterEnd = std::chrono::steady_clock::now();
+
+    const F64 samples = static_cast<F64>(BENCHMARK_SAMPLES * BENCHMARK_PASSES);
+    const F64 convertSeconds = std::chrono::duration<F64>(convertEnd - convertStart).count();
+    const F64 filterSeconds = std::chrono::duration<F64>(filterEnd - filterStart).count();
+    ::printf("[ BENCHMARK ] convert_raw_data: %.1f ns/sample, vertical speed filter: %.1f ns/sample (checksum %f)\n",
+             convertSeconds * 1.0e9 / samples, filterSeconds * 1.0e9 / samples, static_cast<F64>(checksum));
+    // Each pass ends on the steady climb of 5 cm per tick
+    ASSERT_TRUE(std::isfinite(checksum));
+    ASSERT_NEAR(filter.get_speed(), 0.05f * 1.0e6f / static_cast<F32>(EMULATOR_TICK_US), 0.5f);
+}
+
+void BmpManagerTester ::test_parameter_snapshot() {
+    this->component.loadParameters();
+    this->boot_sequence();
+    this->clearHistory();
+
+    // An oversampling update reconfigures the device, and every later trigger carries the new oversampling
+    this->paramSet_PRESSURE_OVERSAMPLING(PressureOversampling::OVERSAMPLE_4X, Fw::ParamValid::VALID);
+    this->paramSend_PRESSURE_OVERSAMPLING(0, 0);
+    ASSERT_EVENTS_PressureOversamplingUpdated_SIZE(1);
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 1);
+    const U8 config[] = {0x74, 0x20 | 0x0C, 0x75, 0x00};
+    this->verify_write(0, config, sizeof(config));
+    const U8 trigger[] = {0x74, 0x20 | 0x0C | 0x01};
+    for (U32 i = 0; i < 3; i++) {
+        this->tick();
+        ASSERT_EQ(this->transactionCount, 3);
+        this->verify_write(1, trigger, sizeof(trigger));
+    }
+
+    // Sea level pressure applies to the next reading without touching the device
+    this->clearHistory();
+    this->paramSet_SEA_LEVEL_PRESSURE(this->expected_reading().get_pressure(), Fw::ParamValid::VALID);
+    this->paramSend_SEA_LEVEL_PRESSURE(0, 0);
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 3);
+    this->verify_write(1, trigger, sizeof(trigger));
+    ASSERT_TLM_Reading_SIZE(1);
+    ASSERT_NEAR(this->tlmHistory_Reading->at(0).arg.get_altitude(), 0.0f, 0.01f);
+    ASSERT_EVENTS_SIZE(0);
+}
+
+void BmpManagerTester ::test_parameter_snapshot_benchmark() {
+    this->paramSet_SEA_LEVEL_PRESSURE(101325.0f, Fw::ParamValid::VALID);
+    this->component.loadParameters();
+    this->boot_sequence();
+
+    // Ticks with a current snapshot read no parameters
+    std::chrono::steady_clock::duration cached(0);
+    U32 readings = 0;
+    for (U32 i = 0; i < PARAMETER_BENCHMARK_TICKS; i++) {
+        this->clearHistory();
+        const auto start = std::chrono::steady_clock::now();
+        this->tick();
+        cached += std::chrono::steady_clock::now() - start;
+        readings += static_cast<U32>(this->tlmHistory_Reading->size());
+    }
+
+    // Updating a passive parameter before each tick makes every tick refresh the snapshot, reading each parameter
+    // once as the ticks did before the snapshot existed
+    std::chrono::steady_clock::duration refreshed(0);
+    for (U32 i = 0; i < PARAMETER_BENCHMARK_TICKS; i++) {
+        this->clearHistory();
+        this->paramSend_SEA_LEVEL_PRESSURE(0, 0);
+        const auto start = std::chrono::steady_clock::now();
+        this->tick();
+        refreshed += std::chrono::steady_clock::now() - start;
+        readings += static_cast<U32>(this->tlmHistory_Reading->size());
+    }
+
+    const F64 ticks = static_cast<F64>(PARAMETER_BENCHMARK_TICKS);
+    const F64 cachedNanoseconds = std::chrono::duration<F64, std::nano>(cached).count() / ticks;
+    const F64 refreshedNanoseconds = std::chrono::duration<F64, std::nano>(refreshed).count() / ticks;
+    ::printf("[ BENCHMARK ] run tick: %.0f ns with the parameter snapshot, %.0f ns refreshing it every tick\n",
+             cachedNanoseconds, refreshedNanoseconds);
+    ASSERT_EQ(readings, 2 * PARAMETER_BENCHMARK_TICKS);
+    ASSERT_GT(refreshedNanoseconds, 0.0);
+}
+
 void BmpManagerTester ::test_error() {
-    // Test error cases
-    this->invoke_to_run(0, 0);
+    // Device reports the wrong chip id
+    this->registers[0][BmpManager::CHIP_ID_REGISTER] = 0x00;
+    this->component.loadParameters();
+
+    this->tick();  // RESET
+    this->tick();  // STARTUP_DELAY
+    this->tick();  // STARTUP_DELAY
+    this->tick();  // CHIP_ID_CHECK
 
     // Verify error event was emitted
     ASSERT_EVENTS_SIZE(1);
-    ASSERT_EVENTS_I2cError_SIZE(1);
+    ASSERT_EVENTS_ChipIdCheckFailure_SIZE(1);
+    ASSERT_EVENTS_ChipIdCheckFailure(0, 0);
+
+    // Next tick restarts with a reset
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 1);
+    const U8 reset[] = {0x60, 0xB6};
+    this->verify_write(0, reset, sizeof(reset));
+    ASSERT_TLM_SIZE(0);
+}
+
+// ----------------------------------------------------------------------
+// Handlers for data product ports
+// ----------------------------------------------------------------------
+
+Fw::Success::T BmpManagerTester ::productGet_handler(FwDpIdType id, FwSizeType dataSize, Fw::Buffer& buffer) {
+    this->pushProductGetEntry(id, dataSize);
+    const FwSizeType packetSize = Fw::DpContainer::getPacketSizeForDataSize(dataSize);
+    if (!this->productAvailable || (packetSize > PRODUCT_DATA_SIZE)) {
+        return Fw::Success::FAILURE;
+    }
+    buffer = Fw::Buffer(this->productData, packetSize);
+    return Fw::Success::SUCCESS;
 }
 
 // ----------------------------------------------------------------------
 // Handlers for typed from ports
 // ----------------------------------------------------------------------
 
-void BmpManagerTester ::from_busWriteRead_handler(FwIndexType portNum,
-                                                  U32 addr,
+void BmpManagerTester ::from_spiReadWrite_handler(FwIndexType portNum,
                                                   Fw::Buffer& writeBuffer,
                                                   Fw::Buffer& readBuffer) {
-    this->pushFromPortEntry_busWriteRead(addr, writeBuffer, readBuffer);
+    this->pushFromPortEntry_spiReadWrite(writeBuffer, readBuffer);
+    ASSERT_EQ(writeBuffer.getSize(), readBuffer.getSize());
+    ASSERT_LT(this->transactionCount, MAX_TRANSACTIONS);
+    ASSERT_LE(writeBuffer.getSize(), MAX_TRANSACTION_SIZE);
+
+    // Record the written bytes before the read overwrites them (the component reuses a single buffer)
+    ASSERT_LT(portNum, MAX_DEVICES);
+    Transaction& transaction = this->transactions[this->transactionCount++];
+    transaction.port = portNum;
+    transaction.size = writeBuffer.getSize();
+    ::memcpy(transaction.data, writeBuffer.getData(), transaction.size);
+
+    // SPI addresses replace the register MSB with the read/write bit
+    U8* const registers = this->registers[portNum];
+    const U8 address = transaction.data[0];
+    if (address & 0x80) {
+        readBuffer.getData()[0] = 0xFF;
+        for (FwSizeType i = 1; i < transaction.size; i++) {
+            readBuffer.getData()[i] = registers[(address + i - 1) & 0xFF];
+        }
+    } else {
+        for (FwSizeType i = 0; i + 1 < transaction.size; i += 2) {
+            registers[transaction.data[i] | 0x80] = transaction.data[i + 1];
+        }
+    }
 }
 
-void BmpManagerTester ::from_busWrite_handler(FwIndexType portNum, U32 addr, Fw::Buffer& writeBuffer) {
-    this->pushFromPortEntry_busWrite(addr, writeBuffer);
+void BmpManagerTester ::from_acquireOut_handler(FwIndexType portNum, U32 context) {
+    this->pushFromPortEntry_acquireOut(context);
+    // Dispatched at once, as though the component thread ran ahead of the rest of the run tick
+    if (this->acquireForwarded) {
+        this->invoke_to_acquire(0, context);
+        this->component.doDispatch();
+    }
 }
 
 // ----------------------------------------------------------------------
 // Helper functions
 // ----------------------------------------------------------------------
 
-void BmpManagerTester ::connectPorts() {
-    // Connect ports
-    this->connect_to_run(0, this->component.get_run_InputPort(0));
-    this->connect_to_timeCaller(0, this->component.get_timeCaller_OutputPort(0));
-    this->connect_to_CmdDisp(0, this->component.get_CmdDisp_OutputPort(0));
-    this->connect_to_CmdReg(0, this->component.get_CmdReg_OutputPort(0));
-    this->connect_to_CmdStatus(0, this->component.get_CmdStatus_OutputPort(0));
-    this->connect_to_Log(0, this->component.get_Log_OutputPort(0));
-    this->connect_to_LogText(0, this->component.get_LogText_OutputPort(0));
-    this->connect_to_tlmOut(0, this->component.get_tlmOut_OutputPort(0));
-    this->connect_to_PrmGet(0, this->component.get_PrmGet_OutputPort(0));
-    this->connect_to_PrmSet(0, this->component.get_PrmSet_OutputPort(0));
+void BmpManagerTester ::tick() {
+    this->transactionCount = 0;
+    this->invoke_to_run(0, 0);
+}
+
+void BmpManagerTester ::acquire() {
+    this->transactionCount = 0;
+    this->invoke_to_acquire(0, 0);
+    this->component.doDispatch();
+}
+
+void BmpManagerTester ::boot_sequence(FwSizeType devices) {
+    // RESET writes the soft reset value
+    this->tick();
+    ASSERT_EQ(this->transactionCount, devices);
+    const U8 reset[] = {0x60, 0xB6};
+    for (FwSizeType i = 0; i < devices; i++) {
+        this->verify_write(i, reset, sizeof(reset));
+        ASSERT_EQ(this->transactions[i].port, static_cast<FwIndexType>(i));
+    }
+
+    // STARTUP_DELAY does not touch the bus
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 0);
+    this->tick();
+    ASSERT_EQ(this->transactionCount, 0);
+
+    // CHIP_ID_CHECK
+    this->tick();
+    ASSERT_EQ(this->transactionCount, devices);
+    for (FwSizeType i = 0; i < devices; i++) {
+        ASSERT_EQ(this->transactions[i].data[0], 0xD0);
+    }
+
+    // CALIBRATION_READ
+    this->tick();
+    ASSERT_EQ(this->transactionCount, devices);
+    for (FwSizeType i = 0; i < devices; i++) {
+        ASSERT_EQ(this->transactions[i].data[0], 0x88);
+        ASSERT_EQ(this->transactions[i].size, BmpManager::CALIB_DATA_LENGTH + 1);
+    }
+
+    // CONFIGURE
+    this->tick();
+    ASSERT_GE(this->transactionCount, devices);
+    ASSERT_TLM_Reading_SIZE(0);
+    ASSERT_EVENTS_SIZE(0);
+}
+
+void BmpManagerTester ::connect_emulator() {
+    for (FwIndexType i = 0; i < MAX_DEVICES; i++) {
+        this->component.set_spiReadWrite_OutputPort(i, this->emulator.get_spiReadWrite_InputPort(i));
+    }
+    // Emulated conversions are paced by the test time
+    this->emulator.set_timeCaller_OutputPort(0, this->get_from_timeCaller(0));
+    this->emulatorTime = 10 * 1000000ULL;
+}
+
+void BmpManagerTester ::emulator_tick() {
+    this->emulatorTime += EMULATOR_TICK_US;
+    this->setTestTime(Fw::Time(TimeBase::TB_NONE, static_cast<U32>(this->emulatorTime / 1000000),
+                               static_cast<U32>(this->emulatorTime % 1000000)));
+    this->clearHistory();
+    this->invoke_to_run(0, 0);
+}
+
+void BmpManagerTester ::fill_registers() {
+    ::memset(this->registers, 0, sizeof(this->registers));
+    const U16 trim[] = {DIG_T1,
+                        static_cast<U16>(DIG_T2),
+                        static_cast<U16>(DIG_T3),
+                        DIG_P1,
+                        static_cast<U16>(DIG_P2),
+                        static_cast<U16>(DIG_P3),
+                        static_cast<U16>(DIG_P4),
+                        static_cast<U16>(DIG_P5),
+                        static_cast<U16>(DIG_P6),
+                        static_cast<U16>(DIG_P7),
+                        static_cast<U16>(DIG_P8),
+                        static_cast<U16>(DIG_P9)};
+    for (FwSizeType device = 0; device < MAX_DEVICES; device++) {
+        U8* const registers = this->registers[device];
+        registers[BmpManager::CHIP_ID_REGISTER] = BmpManager::CHIP_ID_VALUE;
+
+        // Trimming parameters are stored little-endian
+        for (U32 i = 0; i < sizeof(trim) / sizeof(trim[0]); i++) {
+            registers[BmpManager::CALIB_DATA_REGISTER + 2 * i] = static_cast<U8>(trim[i] & 0xFF);
+            registers[BmpManager::CALIB_DATA_REGISTER + 2 * i + 1] = static_cast<U8>(trim[i] >> 8);
+        }
+        // Measurements are stored as 20-bit big-endian values
+        registers[0xF7] = static_cast<U8>(ADC_P >> 12);
+        registers[0xF8] = static_cast<U8>(ADC_P >> 4);
+        registers[0xF9] = static_cast<U8>(ADC_P << 4);
+        registers[0xFA] = static_cast<U8>(ADC_T >> 12);
+        registers[0xFB] = static_cast<U8>(ADC_T >> 4);
+        registers[0xFC] = static_cast<U8>(ADC_T << 4);
+    }
+}
+
+void BmpManagerTester ::verify_write(FwSizeType index, const U8* expected, FwSizeType size) {
+    ASSERT_LT(index, this->transactionCount);
+    ASSERT_EQ(this->transactions[index].size, size);
+    for (FwSizeType i = 0; i < size; i++) {
+        ASSERT_EQ(this->transactions[index].data[i], expected[i]) << "Byte " << i;
+    }
+}
+
+Bmp280Data BmpManagerTester ::expected_reading() {
+    BmpManager::CalibrationData calibration = {DIG_T1, DIG_T2, DIG_T3, DIG_P1, DIG_P2, DIG_P3,
+                                               DIG_P4, DIG_P5, DIG_P6, DIG_P7, DIG_P8, DIG_P9};
+    BmpManager::RawBmpData raw = {ADC_P, ADC_T};
+    return BmpManager::convert_raw_data(raw, calibration, 101325.0f);
+}
 
-    this->component.set_busWriteRead_OutputPort(0, this->get_from_busWriteRead(0));
-    this->component.set_busWrite_OutputPort(0, this->get_from_busWrite(0));
+F32 BmpManagerTester ::pressure_at(F32 altitude) {
+    return static_cast<F32>(101325.0 * std::pow(1.0 - static_cast<F64>(altitude) / 44330.0, 5.255));
 }
 
-void BmpManagerTester ::initComponents() {
-    this->init();
-    this->component.init(BmpManagerTester::TEST_INSTANCE_QUEUE_DEPTH, BmpManagerTester::TEST_INSTANCE_ID);
+void BmpManagerTester ::fill_raw_samples(BmpManager::RawBmpData* raw, FwSizeType count) {
+    // Linear congruential generator, fixed seed keeps failures reproducible
+    U32 state = 0x12345678;
+    for (FwSizeType i = 0; i < count; i++) {
+        state = state * 1664525 + 1013904223;
+        raw[i].pressure = state >> 12;
+        state = state * 1664525 + 1013904223;
+        raw[i].temperature = state >> 12;
+    }
 }
 
-}  // namespace Bmp280
\ No newline at end of file
+}  // namespace Bmp280
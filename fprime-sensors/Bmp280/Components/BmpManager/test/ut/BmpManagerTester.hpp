@@ -7,6 +7,7 @@
 #ifndef Bmp280_BmpManagerTester_HPP
 #define Bmp280_BmpManagerTester_HPP
 
+#include "fprime-sensors/Bmp280/Components/BmpEmulator/BmpEmulator.hpp"
 #include "fprime-sensors/Bmp280/Components/BmpManager/BmpManager.hpp"
 #include "fprime-sensors/Bmp280/Components/BmpManager/BmpManagerGTestBase.hpp"
 
@@ -14,6 +15,58 @@ namespace Bmp280 {
 
 class BmpManagerTester : public BmpManagerGTestBase {
   public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const FwSizeType MAX_HISTORY_SIZE = 10;
+
+    // Instance ID supplied to the component instance under test
+    static const FwEnumStoreType TEST_INSTANCE_ID = 0;
+
+    // Queue depth supplied to the component instance under test
+    static const FwSizeType TEST_INSTANCE_QUEUE_DEPTH = 10;
+
+    // Maximum number of SPI transactions recorded per tick
+    static const FwSizeType MAX_TRANSACTIONS = 16;
+
+    // Number of samples used by the batch conversion benchmark
+    static const FwSizeType BENCHMARK_SAMPLES = 4096;
+
+    // Number of passes over the samples in the batch conversion benchmark
+    static const FwSizeType BENCHMARK_PASSES = 50;
+
+    // Run tick period when running against the emulator (µs)
+    static const U32 EMULATOR_TICK_US = 10000;
+
+    // Number of run ticks timed per acquisition mode by the emulator benchmark
+    static const U32 EMULATOR_BENCHMARK_TICKS = 20000;
+
+    // Altitude samples filtered per synthetic profile by the vertical speed filter test, and how many of them are
+    // left for the filter to settle before it is checked
+    static const U32 VERTICAL_SAMPLES = 6000;
+    static const U32 VERTICAL_SETTLE_SAMPLES = 1000;
+
+    // Number of run ticks timed per case by the parameter snapshot benchmark
+    static const U32 PARAMETER_BENCHMARK_TICKS = 20000;
+
+    // Calibration cache file used by the cache tests
+    static constexpr const char* CACHE_PATH = "BmpManagerCalibrationCache.bin";
+
+    // Size of the memory available for data products
+    static const FwSizeType PRODUCT_DATA_SIZE = 16384;
+
+    // Maximum size of a recorded SPI transaction
+    static const FwSizeType MAX_TRANSACTION_SIZE = 32;
+
+    //! Record of the bytes written during a single SPI transaction
+    struct Transaction {
+        FwIndexType port;
+        U8 data[MAX_TRANSACTION_SIZE];
+        FwSizeType size;
+    };
+
     // ----------------------------------------------------------------------
     // Construction and destruction
     // ----------------------------------------------------------------------
@@ -29,28 +82,160 @@ class BmpManagerTester : public BmpManagerGTestBase {
     // Tests
     // ----------------------------------------------------------------------
 
-    //! Test nominal operation
+    //! Test nominal operation in forced mode
     void test_nominal();
 
+    //! Test nominal operation in normal mode
+    void test_normal_mode();
+
+    //! Test reconfiguration on parameter update
+    void test_reconfigure();
+
+    //! Test pipelined forced-mode acquisition
+    void test_pipelined();
+
+    //! Test the conversion time model against the datasheet
+    void test_conversion_time();
+
+    //! Test a multi-device array serviced in bursts
+    void test_array_burst();
+
+    //! Test a multi-device array serviced round-robin
+    void test_array_round_robin();
+
+    //! Test the batch conversion is bit-exact with the scalar conversion
+    void test_batch_conversion();
+
+    //! Compare batch and scalar conversion throughput
+    void test_batch_benchmark();
+
+    //! Sweep the altitude methods over 300 to 110000 Pa against the barometric formula
+    void test_altitude_methods();
+
+    //! Test selecting the altitude method by parameter
+    void test_altitude_parameter();
+
+    //! Test burst capture into a data product
+    void test_burst_capture();
+
+    //! Test burst capture command validation, abort, and product allocation failure
+    void test_burst_capture_errors();
+
+    //! Test the median, boxcar, and IIR filter stages
+    void test_filter_chain();
+
+    //! Test filtering and output decimation of published readings
+    void test_output_decimation();
+
+    //! Test calibration is written to the cache on the first boot
+    void test_calibration_cache_store();
+
+    //! Test a restart with a cached calibration skips to configuration
+    void test_calibration_cache_restore();
+
+    //! Test a corrupt cache falls back to the full boot sequence
+    void test_calibration_cache_invalid();
+
+    //! Test recovery from a bus glitch without repeating the reset sequence
+    void test_fast_recovery();
+
+    //! Run the manager end-to-end against the register-level emulator
+    void test_emulator_loop();
+
+    //! Test recovery from faults injected by the emulator
+    void test_emulator_faults();
+
+    //! Measure the average run tick time against the emulator in each acquisition mode
+    void test_emulator_benchmark();
+
+    //! Test acquisition driven by the acquire port with the run port only publishing
+    void test_off_rate_group();
+
+    //! Measure the average run tick time against the emulator with acquisition off the rate group
+    void test_off_rate_group_benchmark();
+
+    //! Test retries of a dead device back off and health telemetry tracks it
+    void test_backoff();
+
+    //! Test the vertical speed filter against synthetic altitude profiles
+    void test_vertical_speed_filter();
+
+    //! Test vertical speed telemetry while the emulator climbs
+    void test_vertical_speed();
+
+    //! Compare the vertical speed filter cost per sample with the raw data conversion
+    void test_vertical_speed_benchmark();
+
+    //! Test parameter updates reach the device and the conversion through the parameter snapshot
+    void test_parameter_snapshot();
+
+    //! Compare the run tick time with a current parameter snapshot against refreshing it every tick
+    void test_parameter_snapshot_benchmark();
+
     //! Test error cases
     void test_error();
 
   private:
+    // ----------------------------------------------------------------------
+    // Handlers for data product ports
+    // ----------------------------------------------------------------------
+
+    //! Handler for productGetOut, supplies the tester's product memory when available
+    Fw::Success::T productGet_handler(FwDpIdType id,          //!< The container ID
+                                      FwSizeType dataSize,    //!< The requested data size
+                                      Fw::Buffer& buffer      //!< The buffer to fill
+                                      ) override;
+
     // ----------------------------------------------------------------------
     // Handlers for typed from ports
     // ----------------------------------------------------------------------
 
-    //! Handler for from_busWriteRead
-    void from_busWriteRead_handler(FwIndexType portNum, U32 addr, Fw::Buffer& writeBuffer, Fw::Buffer& readBuffer);
+    //! Handler for from_spiReadWrite
+    void from_spiReadWrite_handler(FwIndexType portNum,      //!< The port number
+                                   Fw::Buffer& writeBuffer,  //!< Buffer written to the device
+                                   Fw::Buffer& readBuffer    //!< Buffer read back from the device
+                                   ) final;
 
-    //! Handler for from_busWrite
-    void from_busWrite_handler(FwIndexType portNum, U32 addr, Fw::Buffer& writeBuffer);
+    //! Handler for from_acquireOut
+    void from_acquireOut_handler(FwIndexType portNum,  //!< The port number
+                                 U32 context           //!< The call order
+                                 ) final;
 
   private:
     // ----------------------------------------------------------------------
     // Helper functions
     // ----------------------------------------------------------------------
 
+    //! Ticks the run port after clearing the transaction log
+    void tick();
+
+    //! Ticks the acquire port and dispatches it after clearing the transaction log
+    void acquire();
+
+    //! Ticks through RESET, STARTUP_DELAY, CHIP_ID_CHECK, CALIBRATION_READ, and CONFIGURE
+    void boot_sequence(FwSizeType devices = 1);
+
+    //! Route the component's SPI ports to the emulator instead of the tester's register file
+    void connect_emulator();
+
+    //! Advance the test time by one tick period, clear the history, and tick the run port
+    void emulator_tick();
+
+    //! Load the datasheet example calibration and measurement into the register file
+    void fill_registers();
+
+    //! Verifies that a transaction wrote the given register value pairs
+    void verify_write(FwSizeType index, const U8* expected, FwSizeType size);
+
+    //! Expected telemetry for the register file measurement
+    Bmp280Data expected_reading();
+
+    //! Pressure at an altitude in the standard atmosphere the Reading altitude is calculated with (Pa)
+    static F32 pressure_at(F32 altitude);
+
+    //! Fill samples with pseudo-random 20-bit raw values from a fixed seed
+    static void fill_raw_samples(BmpManager::RawBmpData* raw, FwSizeType count);
+
     //! Connect ports
     void connectPorts();
 
@@ -64,8 +249,32 @@ class BmpManagerTester : public BmpManagerGTestBase {
 
     //! The component under test
     BmpManager component;
+
+    //! Register-level emulator, connected by tests running the component end-to-end
+    BmpEmulator emulator;
+
+    //! Test time advanced by emulator_tick (µs)
+    U64 emulatorTime;
+
+    //! Register file of the simulated devices
+    U8 registers[MAX_DEVICES][256];
+
+    //! Transactions seen during the last tick
+    Transaction transactions[MAX_TRANSACTIONS];
+
+    //! Number of transactions seen during the last tick
+    FwSizeType transactionCount;
+
+    //! Memory handed out for data products
+    U8 productData[PRODUCT_DATA_SIZE];
+
+    //! Whether productGet requests succeed
+    bool productAvailable;
+
+    //! Whether acquireOut is forwarded to acquire, as connected in the subtopology
+    bool acquireForwarded;
 };
 
 }  // namespace Bmp280
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,196 @@
+// ======================================================================
+// \title  AhrsFilter.cpp
+// \author mstarch
+// \brief  cpp file for the quaternion complementary filter estimating attitude from MPU6050 samples
+// ======================================================================
+
+#include "fprime-sensors/MpuImu/Components/AttitudeEstimator/AhrsFilter.hpp"
+#include <cmath>
+
+namespace MpuImu {
+
+static constexpr F32 DEGREES_TO_RADIANS = 0.017453292519943295f;
+static constexpr F32 RADIANS_TO_DEGREES = 57.29577951308232f;
+
+AhrsFilter ::AhrsFilter() : m_proportional(0.0f), m_integralGain(0.0f), m_beta(0.0f) {
+    this->reset();
+}
+
+void AhrsFilter ::set_mahony_gains(F32 proportional, F32 integral) {
+    this->m_proportional = proportional;
+    this->m_integralGain = integral;
+    if (integral <= 0.0f) {
+        // Without an integral term the accumulated correction no longer decays, so it is dropped
+        for (U32 axis = 0; axis < 3; axis++) {
+            this->m_integral[axis] = 0.0f;
+        }
+    }
+}
+
+void AhrsFilter ::set_madgwick_beta(F32 beta) {
+    this->m_beta = beta;
+}
+
+void AhrsFilter ::reset() {
+    this->m_q[0] = 1.0f;
+    this->m_q[1] = 0.0f;
+    this->m_q[2] = 0.0f;
+    this->m_q[3] = 0.0f;
+    for (U32 axis = 0; axis < 3; axis++) {
+        this->m_integral[axis] = 0.0f;
+    }
+}
+
+bool AhrsFilter ::align(const F32 acceleration[3]) {
+    F32 unit[3];
+    if (!unit_acceleration(acceleration, unit)) {
+        return false;
+    }
+    // Gravity reads as +1 G up, so roll and pitch are those rotating z up onto the measurement
+    const F32 roll = std::atan2(unit[1], unit[2]);
+    const F32 pitch = std::atan2(-unit[0], std::sqrt((unit[1] * unit[1]) + (unit[2] * unit[2])));
+    const F32 cr = std::cos(0.5f * roll);
+    const F32 sr = std::sin(0.5f * roll);
+    const F32 cp = std::cos(0.5f * pitch);
+    const F32 sp = std::sin(0.5f * pitch);
+    this->reset();
+    this->m_q[0] = cr * cp;
+    this->m_q[1] = sr * cp;
+    this->m_q[2] = cr * sp;
+    this->m_q[3] = -sr * sp;
+    return true;
+}
+
+void AhrsFilter ::update_mahony(const F32 rotation[3], const F32 acceleration[3], F32 dt) {
+    F32 gx = rotation[0] * DEGREES_TO_RADIANS;
+    F32 gy = rotation[1] * DEGREES_TO_RADIANS;
+    F32 gz = rotation[2] * DEGREES_TO_RADIANS;
+    if (!std::isfinite(gx + gy + gz + dt)) {
+        return;
+    }
+    const F32 q0 = this->m_q[0];
+    const F32 q1 = this->m_q[1];
+    const F32 q2 = this->m_q[2];
+    const F32 q3 = this->m_q[3];
+
+    F32 a[3];
+    if (unit_acceleration(acceleration, a)) {
+        // Estimated gravity direction in the body frame, and its rotation error from the measured one
+        const F32 vx = 2.0f * ((q1 * q3) - (q0 * q2));
+        const F32 vy = 2.0f * ((q0 * q1) + (q2 * q3));
+        const F32 vz = (q0 * q0) - (q1 * q1) - (q2 * q2) + (q3 * q3);
+        const F32 ex = (a[1] * vz) - (a[2] * vy);
+        const F32 ey = (a[2] * vx) - (a[0] * vz);
+        const F32 ez = (a[0] * vy) - (a[1] * vx);
+        if (this->m_integralGain > 0.0f) {
+            this->m_integral[0] += this->m_integralGain * ex * dt;
+            this->m_integral[1] += this->m_integralGain * ey * dt;
+            this->m_integral[2] += this->m_integralGain * ez * dt;
+        }
+        gx += (this->m_proportional * ex) + this->m_integral[0];
+        gy += (this->m_proportional * ey) + this->m_integral[1];
+        gz += (this->m_proportional * ez) + this->m_integral[2];
+    }
+
+    // Integrate the quaternion derivative, half the product of the attitude and the corrected rate
+    const F32 half = 0.5f * dt;
+    gx *= half;
+    gy *= half;
+    gz *= half;
+    this->m_q[0] = q0 + ((-q1 * gx) - (q2 * gy) - (q3 * gz));
+    this->m_q[1] = q1 + ((q0 * gx) + (q2 * gz) - (q3 * gy));
+    this->m_q[2] = q2 + ((q0 * gy) - (q1 * gz) + (q3 * gx));
+    this->m_q[3] = q3 + ((q0 * gz) + (q1 * gy) - (q2 * gx));
+    this->normalize();
+}
+
+void AhrsFilter ::update_madgwick(const F32 rotation[3], const F32 acceleration[3], F32 dt) {
+    const F32 gx = rotation[0] * DEGREES_TO_RADIANS;
+    const F32 gy = rotation[1] * DEGREES_TO_RADIANS;
+    const F32 gz = rotation[2] * DEGREES_TO_RADIANS;
+    if (!std::isfinite(gx + gy + gz + dt)) {
+        return;
+    }
+    const F32 q0 = this->m_q[0];
+    const F32 q1 = this->m_q[1];
+    const F32 q2 = this->m_q[2];
+    const F32 q3 = this->m_q[3];
+
+    // Rate of change of the quaternion from the angular rate
+    F32 dq0 = 0.5f * ((-q1 * gx) - (q2 * gy) - (q3 * gz));
+    F32 dq1 = 0.5f * ((q0 * gx) + (q2 * gz) - (q3 * gy));
+    F32 dq2 = 0.5f * ((q0 * gy) - (q1 * gz) + (q3 * gx));
+    F32 dq3 = 0.5f * ((q0 * gz) + (q1 * gy) - (q2 * gx));
+
+    F32 a[3];
+    if (unit_acceleration(acceleration, a)) {
+        // Gradient of the squared difference between the estimated and measured gravity directions
+        const F32 q0q0 = q0 * q0;
+        const F32 q1q1 = q1 * q1;
+        const F32 q2q2 = q2 * q2;
+        const F32 q3q3 = q3 * q3;
+        F32 s0 = (4.0f * q0 * q2q2) + (2.0f * q2 * a[0]) + (4.0f * q0 * q1q1) - (2.0f * q1 * a[1]);
+        F32 s1 = (4.0f * q1 * q3q3) - (2.0f * q3 * a[0]) + (4.0f * q0q0 * q1) - (2.0f * q0 * a[1]) - (4.0f * q1) +
+                 (8.0f * q1 * q1q1) + (8.0f * q1 * q2q2) + (4.0f * q1 * a[2]);
+        F32 s2 = (4.0f * q0q0 * q2) + (2.0f * q0 * a[0]) + (4.0f * q2 * q3q3) - (2.0f * q3 * a[1]) - (4.0f * q2) +
+                 (8.0f * q2 * q1q1) + (8.0f * q2 * q2q2) + (4.0f * q2 * a[2]);
+        F32 s3 = (4.0f * q1q1 * q3) - (2.0f * q1 * a[0]) + (4.0f * q2q2 * q3) - (2.0f * q2 * a[1]);
+        const F32 norm = std::sqrt((s0 * s0) + (s1 * s1) + (s2 * s2) + (s3 * s3));
+        // At the minimum the gradient vanishes and there is nothing to correct
+        if (norm > 0.0f) {
+            const F32 step = this->m_beta / norm;
+            dq0 -= step * s0;
+            dq1 -= step * s1;
+            dq2 -= step * s2;
+            dq3 -= step * s3;
+        }
+    }
+
+    this->m_q[0] = q0 + (dq0 * dt);
+    this->m_q[1] = q1 + (dq1 * dt);
+    this->m_q[2] = q2 + (dq2 * dt);
+    this->m_q[3] = q3 + (dq3 * dt);
+    this->normalize();
+}
+
+const F32* AhrsFilter ::quaternion() const {
+    return this->m_q;
+}
+
+void AhrsFilter ::euler(F32 angles[3]) const {
+    const F32 q0 = this->m_q[0];
+    const F32 q1 = this->m_q[1];
+    const F32 q2 = this->m_q[2];
+    const F32 q3 = this->m_q[3];
+    // Rounding can carry the pitch sine just past one at the poles
+    F32 sinPitch = 2.0f * ((q0 * q2) - (q3 * q1));
+    sinPitch = (sinPitch > 1.0f) ? 1.0f : ((sinPitch < -1.0f) ? -1.0f : sinPitch);
+    angles[0] = std::atan2(2.0f * ((q0 * q1) + (q2 * q3)), 1.0f - (2.0f * ((q1 * q1) + (q2 * q2)))) * RADIANS_TO_DEGREES;
+    angles[1] = std::asin(sinPitch) * RADIANS_TO_DEGREES;
+    angles[2] = std::atan2(2.0f * ((q0 * q3) + (q1 * q2)), 1.0f - (2.0f * ((q2 * q2) + (q3 * q3)))) * RADIANS_TO_DEGREES;
+}
+
+bool AhrsFilter ::unit_acceleration(const F32 acceleration[3], F32 unit[3]) {
+    const F32 norm = std::sqrt((acceleration[0] * acceleration[0]) + (acceleration[1] * acceleration[1]) +
+                               (acceleration[2] * acceleration[2]));
+    // Free fall carries no direction, and a non-finite sample would corrupt the attitude for good
+    if (!(norm > 0.0f) || !std::isfinite(norm)) {
+        return false;
+    }
+    const F32 reciprocal = 1.0f / norm;
+    unit[0] = acceleration[0] * reciprocal;
+    unit[1] = acceleration[1] * reciprocal;
+    unit[2] = acceleration[2] * reciprocal;
+    return true;
+}
+
+void AhrsFilter ::normalize() {
+    const F32 norm = std::sqrt((this->m_q[0] * this->m_q[0]) + (this->m_q[1] * this->m_q[1]) +
+                               (this->m_q[2] * this->m_q[2]) + (this->m_q[3] * this->m_q[3]));
+    const F32 reciprocal = 1.0f / norm;
+    for (U32 i = 0; i < 4; i++) {
+        this->m_q[i] *= reciprocal;
+    }
+}
+
+}  // namespace MpuImu
@@ -0,0 +1,66 @@
+// ======================================================================
+// \title  AhrsFilter.hpp
+// \author mstarch
+// \brief  hpp file for the quaternion complementary filter estimating attitude from MPU6050 samples
+// ======================================================================
+
+#ifndef MpuImu_AhrsFilter_HPP
+#define MpuImu_AhrsFilter_HPP
+
+#include "Fw/FPrimeBasicTypes.hpp"
+
+namespace MpuImu {
+
+//! Estimates attitude from angular rate and acceleration with a Mahony or Madgwick complementary filter
+//!
+//! The state is a unit quaternion rotating the body frame into a level frame with z up. Each update integrates the
+//! angular rate and pulls the estimated gravity direction toward the measured acceleration: Mahony by feeding back the
+//! cross product of the two as a proportional and integral rate correction, Madgwick by a gradient descent step of
+//! size beta. Neither observes heading, so yaw is integrated angular rate only. State is a handful of F32 values and
+//! updates neither allocate nor branch on history, so the cost per sample is constant.
+class AhrsFilter {
+  public:
+    //! Construct a filter at the identity attitude with zero gains
+    AhrsFilter();
+
+    //! Set the Mahony proportional (1/s) and integral (1/s^2) gains
+    void set_mahony_gains(F32 proportional, F32 integral);
+
+    //! Set the Madgwick gradient descent step (rad/s)
+    void set_madgwick_beta(F32 beta);
+
+    //! Return to the identity attitude and clear the integral correction
+    void reset();
+
+    //! Set roll and pitch from an acceleration (G) measured at rest with zero yaw, false when it has no direction
+    bool align(const F32 acceleration[3]);
+
+    //! Update with the Mahony filter from an angular rate (deg/s) and acceleration (G) over dt seconds
+    void update_mahony(const F32 rotation[3], const F32 acceleration[3], F32 dt);
+
+    //! Update with the Madgwick filter from an angular rate (deg/s) and acceleration (G) over dt seconds
+    void update_madgwick(const F32 rotation[3], const F32 acceleration[3], F32 dt);
+
+    //! Attitude quaternion as w, x, y, z
+    const F32* quaternion() const;
+
+    //! Roll, pitch, and yaw (degrees) of the attitude, in z-y-x order
+    void euler(F32 angles[3]) const;
+
+  private:
+    //! Unit acceleration in the body frame, false when zero or not finite such that no correction is applied
+    static bool unit_acceleration(const F32 acceleration[3], F32 unit[3]);
+
+    //! Scale the quaternion back to unit length
+    void normalize();
+
+    F32 m_q[4];             //!< Attitude quaternion, w, x, y, z
+    F32 m_integral[3];      //!< Mahony integral rate correction (rad/s)
+    F32 m_proportional;     //!< Mahony proportional gain (1/s)
+    F32 m_integralGain;     //!< Mahony integral gain (1/s^2)
+    F32 m_beta;             //!< Madgwick step (rad/s)
+};
+
+}  // namespace MpuImu
+
+#endif
@@ -0,0 +1,139 @@
+// ======================================================================
+// \title  AttitudeEstimator.cpp
+// \author mstarch
+// \brief  cpp file for AttitudeEstimator component implementation class
+// ======================================================================
+
+#include "fprime-sensors/MpuImu/Components/AttitudeEstimator/AttitudeEstimator.hpp"
+
+namespace MpuImu {
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+AttitudeEstimator ::AttitudeEstimator(const char* const compName)
+    : AttitudeEstimatorComponentBase(compName),
+      m_filterType(AttitudeFilter::MAHONY),
+      m_parametersLoaded(false),
+      m_aligned(false),
+      m_updated(false),
+      m_sampleGaps(0) {}
+
+AttitudeEstimator ::~AttitudeEstimator() {}
+
+void AttitudeEstimator ::parameterUpdated(FwPrmIdType id) {
+    Fw::ParamValid isValid = Fw::ParamValid::INVALID;
+    switch (id) {
+        case PARAMID_FILTER: {
+            // Read back the parameter value
+            const AttitudeFilter filter = this->paramGet_FILTER(isValid);
+            // NOTE: isValid is always VALID in parameterUpdated as it was just properly set
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_FilterUpdated(filter);
+            break;
+        }
+        case PARAMID_MAHONY_PROPORTIONAL_GAIN:
+        case PARAMID_MAHONY_INTEGRAL_GAIN:
+        case PARAMID_MADGWICK_BETA:
+            // Loaded on the next run
+            break;
+        default:
+            FW_ASSERT(0, static_cast<FwAssertArgType>(id));
+            break;
+    }
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for typed input ports
+// ----------------------------------------------------------------------
+
+void AttitudeEstimator ::imuIn_handler(FwIndexType portNum, const Fw::Time& time, const MpuImu::ImuData& data) {
+    // Samples may arrive before the first run
+    if (!this->m_parametersLoaded) {
+        this->load_parameters();
+    }
+    const F32 rotation[3] = {data.get_rotation().get_x(), data.get_rotation().get_y(), data.get_rotation().get_z()};
+    const F32 acceleration[3] = {data.get_acceleration().get_x(), data.get_acceleration().get_y(),
+                                 data.get_acceleration().get_z()};
+
+    if (!this->m_aligned) {
+        // Starting level would take the filter seconds to pull a tilted vehicle in, so start from gravity
+        if (!this->m_filter.align(acceleration)) {
+            return;
+        }
+        this->m_aligned = true;
+        F32 angles[3];
+        this->m_filter.euler(angles);
+        this->log_ACTIVITY_HI_AttitudeAligned(angles[0], angles[1]);
+    } else {
+        const U32 elapsed = elapsed_us(this->m_sampleTime, time);
+        if ((elapsed == 0) || (elapsed > MAX_SAMPLE_GAP_US)) {
+            // Keep the attitude and integrate from this sample on
+            this->m_sampleTime = time;
+            this->m_sampleGaps++;
+            return;
+        }
+        const F32 dt = static_cast<F32>(elapsed) * 1.0e-6f;
+        if (this->m_filterType == AttitudeFilter::MADGWICK) {
+            this->m_filter.update_madgwick(rotation, acceleration, dt);
+        } else {
+            this->m_filter.update_mahony(rotation, acceleration, dt);
+        }
+    }
+    this->m_sampleTime = time;
+    this->m_updated = true;
+    if (this->isConnected_attitudeOut_OutputPort(0)) {
+        this->attitudeOut_out(0, time, this->attitude());
+    }
+}
+
+void AttitudeEstimator ::run_handler(FwIndexType portNum, U32 context) {
+    this->load_parameters();
+    if (this->m_updated) {
+        const Attitude estimate = this->attitude();
+        this->tlmWrite_Quaternion(estimate.get_quaternion(), this->m_sampleTime);
+        this->tlmWrite_EulerAngles(estimate.get_euler(), this->m_sampleTime);
+        this->m_updated = false;
+    }
+    this->tlmWrite_SampleGaps(this->m_sampleGaps);
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for commands
+// ----------------------------------------------------------------------
+
+void AttitudeEstimator ::ALIGN_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
+    // The vehicle must be still for the next acceleration to be gravity alone
+    this->m_aligned = false;
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void AttitudeEstimator ::load_parameters() {
+    Fw::ParamValid paramValid;
+    this->m_filterType = this->paramGet_FILTER(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    const F32 proportional = this->paramGet_MAHONY_PROPORTIONAL_GAIN(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    const F32 integral = this->paramGet_MAHONY_INTEGRAL_GAIN(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    const F32 beta = this->paramGet_MADGWICK_BETA(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    this->m_filter.set_mahony_gains(proportional, integral);
+    this->m_filter.set_madgwick_beta(beta);
+    this->m_parametersLoaded = true;
+}
+
+Attitude AttitudeEstimator ::attitude() const {
+    const F32* q = this->m_filter.quaternion();
+    F32 angles[3];
+    this->m_filter.euler(angles);
+    return Attitude(AttitudeQuaternion(q[0], q[1], q[2], q[3]),
+                    FprimeSensors::GeometricVector3(angles[0], angles[1], angles[2]));
+}
+
+}  // namespace MpuImu
@@ -0,0 +1,102 @@
+// ======================================================================
+// \title  AttitudeEstimator.hpp
+// \author mstarch
+// \brief  hpp file for AttitudeEstimator component implementation class
+// ======================================================================
+
+#ifndef MpuImu_AttitudeEstimator_HPP
+#define MpuImu_AttitudeEstimator_HPP
+
+#include "fprime-sensors/MpuImu/Components/AttitudeEstimator/AhrsFilter.hpp"
+#include "fprime-sensors/MpuImu/Components/AttitudeEstimator/AttitudeEstimatorComponentAc.hpp"
+#include "fprime-sensors/MpuImu/Types/ElapsedTime.hpp"
+
+namespace MpuImu {
+
+//! Estimates attitude from every ImuManager sample with a Mahony or Madgwick filter
+//!
+//! Each sample on imuIn updates the filter over the time since the previous sample and is passed on as an attitude
+//! on attitudeOut. The first sample with a usable acceleration aligns roll and pitch to gravity instead. The filter
+//! parameters are loaded and the estimate written to telemetry on each run tick, so the per-sample path does no
+//! parameter or telemetry work.
+class AttitudeEstimator final : public AttitudeEstimatorComponentBase {
+    friend class AttitudeEstimatorTester;
+
+  public:
+    //! Longest time between samples that is integrated (µs), a longer gap would integrate a stale angular rate. It
+    //! leaves margin for a late sample of a 10 Hz rate group reading the IMU.
+    static constexpr U32 MAX_SAMPLE_GAP_US = 250000;
+
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct AttitudeEstimator object
+    AttitudeEstimator(const char* const compName  //!< The component name
+    );
+
+    //! Destroy AttitudeEstimator object
+    ~AttitudeEstimator();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Handler implementations for typed input ports
+    // ----------------------------------------------------------------------
+
+    //! Emit parameter updated EVR
+    //!
+    void parameterUpdated(FwPrmIdType id  //!< The parameter ID
+                          ) override;
+
+    //! Handler implementation for imuIn
+    //!
+    //! Port receiving every IMU sample, updating the estimate
+    void imuIn_handler(FwIndexType portNum,         //!< The port number
+                       const Fw::Time& time,        //!< Time the sample was taken
+                       const MpuImu::ImuData& data  //!< The sample
+                       ) override;
+
+    //! Handler implementation for run
+    //!
+    //! Scheduling port for loading the filter parameters and writing the estimate to telemetry
+    void run_handler(FwIndexType portNum,  //!< The port number
+                     U32 context           //!< The call order
+                     ) override;
+
+    // ----------------------------------------------------------------------
+    // Handler implementations for commands
+    // ----------------------------------------------------------------------
+
+    //! Handler implementation for command ALIGN
+    //!
+    //! Command to align roll and pitch to the next acceleration, with zero yaw
+    void ALIGN_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                          U32 cmdSeq            //!< The command sequence number
+                          ) override;
+
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Load the filter selection and gains from the parameters
+    void load_parameters();
+
+    //! Estimate as an Attitude
+    Attitude attitude() const;
+
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    AhrsFilter m_filter;          //!< Attitude filter
+    AttitudeFilter m_filterType;  //!< Filter run on each sample
+    bool m_parametersLoaded;      //!< Whether the filter parameters were loaded since construction
+    bool m_aligned;               //!< Whether roll and pitch were aligned to gravity
+    bool m_updated;               //!< Whether the estimate changed since the last telemetry
+    Fw::Time m_sampleTime;        //!< Time of the newest sample
+    U32 m_sampleGaps;             //!< Samples not integrated for their time
+};
+
+}  // namespace MpuImu
+
+#endif
@@ -0,0 +1,49 @@
+// ======================================================================
+// \title  AttitudeEstimatorTestMain.cpp
+// \author mstarch
+// \brief  test main for AttitudeEstimator component
+// ======================================================================
+
+#include "AttitudeEstimatorTester.hpp"
+#include "STest/Random/Random.hpp"
+
+TEST(Nominal, Alignment) {
+    MpuImu::AttitudeEstimatorTester tester;
+    tester.test_alignment();
+}
+
+TEST(Nominal, YawIntegration) {
+    MpuImu::AttitudeEstimatorTester tester;
+    tester.test_yaw_integration();
+}
+
+TEST(Nominal, AccelerometerCorrection) {
+    MpuImu::AttitudeEstimatorTester tester;
+    tester.test_accelerometer_correction();
+}
+
+TEST(Nominal, RateBiasIntegral) {
+    MpuImu::AttitudeEstimatorTester tester;
+    tester.test_rate_bias_integral();
+}
+
+TEST(Error, SampleGaps) {
+    MpuImu::AttitudeEstimatorTester tester;
+    tester.test_sample_gaps();
+}
+
+TEST(Nominal, TelemetryAndCommands) {
+    MpuImu::AttitudeEstimatorTester tester;
+    tester.test_telemetry_and_commands();
+}
+
+TEST(Benchmark, SampleCost) {
+    MpuImu::AttitudeEstimatorTester tester;
+    tester.test_benchmark();
+}
+
+int main(int argc, char** argv) {
+    STest::Random::seed();
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,299 @@
+// ======================================================================
+// \title  AttitudeEstimatorTester.cpp
+// \author mstarch
+// \brief  cpp file for AttitudeEstimator component test harness implementation class
+// ======================================================================
+
+#include "AttitudeEstimatorTester.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include "STest/Pick/Pick.hpp"
+
+namespace MpuImu {
+
+static constexpr F32 DEGREES_TO_RADIANS = 0.017453292519943295f;
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+AttitudeEstimatorTester ::AttitudeEstimatorTester()
+    : AttitudeEstimatorGTestBase("AttitudeEstimatorTester", AttitudeEstimatorTester::MAX_HISTORY_SIZE),
+      component("AttitudeEstimator"),
+      sampleTime(TimeBase::TB_PROC_TIME, 0, 100, 0) {
+    this->initComponents();
+    this->connectPorts();
+}
+
+AttitudeEstimatorTester ::~AttitudeEstimatorTester() {}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void AttitudeEstimatorTester ::test_alignment() {
+    const F32 still[3] = {0.0f, 0.0f, 0.0f};
+    // Free fall has no gravity direction to align to
+    this->send_sample(still, still, SAMPLE_PERIOD_US);
+    ASSERT_EQ(this->attitudeCount, 0);
+    ASSERT_EVENTS_AttitudeAligned_SIZE(0);
+
+    // Clear of the poles, where roll and yaw are indistinguishable
+    const F32 roll = static_cast<F32>(STest::Pick::lowerUpper(0, 1600)) * 0.1f - 80.0f;
+    const F32 pitch = static_cast<F32>(STest::Pick::lowerUpper(0, 1600)) * 0.1f - 80.0f;
+    const F32 magnitude = static_cast<F32>(STest::Pick::lowerUpper(50, 150)) * 0.01f;
+    F32 acceleration[3];
+    gravity(roll, pitch, magnitude, acceleration);
+    this->send_sample(still, acceleration, SAMPLE_PERIOD_US);
+    ASSERT_EQ(this->attitudeCount, 1);
+    ASSERT_EQ(this->attitudeTime, this->sampleTime);
+    ASSERT_EVENTS_AttitudeAligned_SIZE(1);
+    ASSERT_NEAR(this->eventHistory_AttitudeAligned->at(0).roll, roll, 0.01f);
+    ASSERT_NEAR(this->eventHistory_AttitudeAligned->at(0).pitch, pitch, 0.01f);
+    ASSERT_NEAR(this->attitude.get_euler().get_x(), roll, 0.01f);
+    ASSERT_NEAR(this->attitude.get_euler().get_y(), pitch, 0.01f);
+    ASSERT_NEAR(this->attitude.get_euler().get_z(), 0.0f, 0.01f);
+    const AttitudeQuaternion& q = this->attitude.get_quaternion();
+    ASSERT_NEAR((q.get_w() * q.get_w()) + (q.get_x() * q.get_x()) + (q.get_y() * q.get_y()) + (q.get_z() * q.get_z()),
+                1.0f, 1.0e-5f);
+}
+
+void AttitudeEstimatorTester ::test_yaw_integration() {
+    const AttitudeFilter filters[] = {AttitudeFilter::MAHONY, AttitudeFilter::MADGWICK};
+    for (const AttitudeFilter filter : filters) {
+        this->set_filter(filter, 1.0f, 0.0f, 0.1f);
+        this->sendCmd_ALIGN(0, 0);
+        ASSERT_CMD_RESPONSE(0, AttitudeEstimator::OPCODE_ALIGN, 0, Fw::CmdResponse::OK);
+        const F32 level[3] = {0.0f, 0.0f, 1.0f};
+        const F32 still[3] = {0.0f, 0.0f, 0.0f};
+        this->send_sample(still, level, SAMPLE_PERIOD_US);
+
+        // One second of samples turns through the rate in degrees, levelling keeps roll and pitch at zero
+        const F32 rotation[3] = {0.0f, 0.0f, static_cast<F32>(STest::Pick::lowerUpper(0, 400)) - 200.0f};
+        for (U32 i = 0; i < 1000000 / SAMPLE_PERIOD_US; i++) {
+            this->send_sample(rotation, level, SAMPLE_PERIOD_US);
+        }
+        ASSERT_NEAR(angle_difference(this->attitude.get_euler().get_z(), rotation[2]), 0.0f, 0.05f)
+            << "Filter " << static_cast<int>(filter.e);
+        ASSERT_NEAR(this->attitude.get_euler().get_x(), 0.0f, 0.01f);
+        ASSERT_NEAR(this->attitude.get_euler().get_y(), 0.0f, 0.01f);
+        this->clearHistory();
+    }
+}
+
+void AttitudeEstimatorTester ::test_accelerometer_correction() {
+    const AttitudeFilter filters[] = {AttitudeFilter::MAHONY, AttitudeFilter::MADGWICK};
+    for (const AttitudeFilter filter : filters) {
+        this->set_filter(filter, 1.0f, 0.0f, 0.1f);
+        this->sendCmd_ALIGN(0, 0);
+        const F32 level[3] = {0.0f, 0.0f, 1.0f};
+        const F32 still[3] = {0.0f, 0.0f, 0.0f};
+        this->send_sample(still, level, SAMPLE_PERIOD_US);
+
+        // Ten seconds at rest in a new attitude, well past the time constant of the default gains
+        const F32 roll = static_cast<F32>(STest::Pick::lowerUpper(0, 40)) - 20.0f;
+        const F32 pitch = static_cast<F32>(STest::Pick::lowerUpper(0, 40)) - 20.0f;
+        F32 acceleration[3];
+        gravity(roll, pitch, 1.0f, acceleration);
+        for (U32 i = 0; i < 10000; i++) {
+            this->send_sample(still, acceleration, SAMPLE_PERIOD_US);
+        }
+        ASSERT_NEAR(this->attitude.get_euler().get_x(), roll, 0.1f) << "Filter " << static_cast<int>(filter.e);
+        ASSERT_NEAR(this->attitude.get_euler().get_y(), pitch, 0.1f) << "Filter " << static_cast<int>(filter.e);
+        this->clearHistory();
+    }
+}
+
+void AttitudeEstimatorTester ::test_rate_bias_integral() {
+    const F32 level[3] = {0.0f, 0.0f, 1.0f};
+    const F32 bias[3] = {0.5f, 0.0f, 0.0f};
+
+    // Proportional feedback alone settles where the correction cancels the bias, bias / gain radians off level
+    this->set_filter(AttitudeFilter::MAHONY, 1.0f, 0.0f, 0.1f);
+    this->send_sample(bias, level, SAMPLE_PERIOD_US);
+    for (U32 i = 0; i < 30000; i++) {
+        this->send_sample(bias, level, SAMPLE_PERIOD_US);
+    }
+    const F32 proportionalError = std::fabs(this->attitude.get_euler().get_x());
+    ASSERT_NEAR(proportionalError, 0.5f, 0.05f);
+
+    // The integral takes the bias over, returning to level
+    this->set_filter(AttitudeFilter::MAHONY, 1.0f, 0.1f, 0.1f);
+    for (U32 i = 0; i < 60000; i++) {
+        this->send_sample(bias, level, SAMPLE_PERIOD_US);
+    }
+    ASSERT_NEAR(this->attitude.get_euler().get_x(), 0.0f, 0.01f);
+    ASSERT_NEAR(this->attitude.get_euler().get_y(), 0.0f, 0.01f);
+}
+
+void AttitudeEstimatorTester ::test_sample_gaps() {
+    const F32 level[3] = {0.0f, 0.0f, 1.0f};
+    const F32 rotation[3] = {0.0f, 0.0f, 90.0f};
+    this->send_sample(rotation, level, SAMPLE_PERIOD_US);
+    ASSERT_EQ(this->attitudeCount, 1);
+
+    // A repeated time and a time long after the previous are skipped rather than integrated
+    this->send_sample(rotation, level, 0);
+    this->send_sample(rotation, level, AttitudeEstimator::MAX_SAMPLE_GAP_US + 1);
+    ASSERT_EQ(this->attitudeCount, 1);
+    ASSERT_NEAR(this->attitude.get_euler().get_z(), 0.0f, 1.0e-3f);
+
+    // Integration resumes from the skipped sample
+    this->send_sample(rotation, level, 100000);
+    ASSERT_EQ(this->attitudeCount, 2);
+    ASSERT_NEAR(this->attitude.get_euler().get_z(), 9.0f, 0.01f);
+
+    // A 10 Hz sample delivered a little late, or at the limit, is still integrated
+    this->send_sample(rotation, level, 103000);
+    this->send_sample(rotation, level, AttitudeEstimator::MAX_SAMPLE_GAP_US);
+    ASSERT_EQ(this->attitudeCount, 4);
+
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_SampleGaps_SIZE(1);
+    ASSERT_TLM_SampleGaps(0, 2);
+}
+
+void AttitudeEstimatorTester ::test_telemetry_and_commands() {
+    // Nothing to report before the first sample
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_Quaternion_SIZE(0);
+    ASSERT_TLM_EulerAngles_SIZE(0);
+    ASSERT_TLM_SampleGaps_SIZE(1);
+    ASSERT_TLM_SampleGaps(0, 0);
+    this->clearHistory();
+
+    const F32 still[3] = {0.0f, 0.0f, 0.0f};
+    F32 acceleration[3];
+    gravity(10.0f, -5.0f, 1.0f, acceleration);
+    this->send_sample(still, acceleration, SAMPLE_PERIOD_US);
+    this->send_sample(still, acceleration, SAMPLE_PERIOD_US);
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_Quaternion_SIZE(1);
+    ASSERT_TLM_Quaternion(0, this->attitude.get_quaternion());
+    ASSERT_TLM_EulerAngles_SIZE(1);
+    ASSERT_TLM_EulerAngles(0, this->attitude.get_euler());
+    this->clearHistory();
+
+    // Telemetry is only written for a changed estimate
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_Quaternion_SIZE(0);
+    ASSERT_TLM_EulerAngles_SIZE(0);
+
+    this->paramSet_FILTER(AttitudeFilter::MADGWICK, Fw::ParamValid::VALID);
+    this->paramSend_FILTER(0, 0);
+    ASSERT_EVENTS_FilterUpdated_SIZE(1);
+    ASSERT_EVENTS_FilterUpdated(0, AttitudeFilter::MADGWICK);
+    this->clearHistory();
+
+    // Realigning takes the next acceleration as gravity whatever the estimate was
+    this->sendCmd_ALIGN(0, 0);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, AttitudeEstimator::OPCODE_ALIGN, 0, Fw::CmdResponse::OK);
+    gravity(-30.0f, 25.0f, 1.0f, acceleration);
+    this->send_sample(still, acceleration, SAMPLE_PERIOD_US);
+    ASSERT_EVENTS_AttitudeAligned_SIZE(1);
+    ASSERT_NEAR(this->eventHistory_AttitudeAligned->at(0).roll, -30.0f, 0.01f);
+    ASSERT_NEAR(this->eventHistory_AttitudeAligned->at(0).pitch, 25.0f, 0.01f);
+}
+
+void AttitudeEstimatorTester ::test_benchmark() {
+    // Ten seconds of random samples replayed, the filters do the same work whatever the samples
+    static ImuData samples[BENCHMARK_SAMPLES];
+    for (U32 i = 0; i < BENCHMARK_SAMPLES; i++) {
+        const F32 roll = static_cast<F32>(STest::Pick::lowerUpper(0, 60)) - 30.0f;
+        const F32 pitch = static_cast<F32>(STest::Pick::lowerUpper(0, 60)) - 30.0f;
+        F32 acceleration[3];
+        gravity(roll, pitch, 1.0f, acceleration);
+        samples[i] = ImuData(FprimeSensors::GeometricVector3(acceleration[0], acceleration[1], acceleration[2]),
+                             FprimeSensors::GeometricVector3(static_cast<F32>(STest::Pick::lowerUpper(0, 200)) - 100.0f,
+                                                             static_cast<F32>(STest::Pick::lowerUpper(0, 200)) - 100.0f,
+                                                             static_cast<F32>(STest::Pick::lowerUpper(0, 200)) - 100.0f),
+                             25.0f);
+    }
+
+    const AttitudeFilter filters[] = {AttitudeFilter::MAHONY, AttitudeFilter::MADGWICK};
+    for (const AttitudeFilter filter : filters) {
+        this->set_filter(filter, 1.0f, 0.1f, 0.1f);
+        const U32 before = this->attitudeCount;
+        const auto start = std::chrono::steady_clock::now();
+        for (U32 pass = 0; pass < BENCHMARK_PASSES; pass++) {
+            for (U32 i = 0; i < BENCHMARK_SAMPLES; i++) {
+                const U64 timeUs = (static_cast<U64>(this->sampleTime.getSeconds()) * 1000000) +
+                                   this->sampleTime.getUSeconds() + SAMPLE_PERIOD_US;
+                this->sampleTime.set(TimeBase::TB_PROC_TIME, 0, static_cast<U32>(timeUs / 1000000),
+                                     static_cast<U32>(timeUs % 1000000));
+                this->invoke_to_imuIn(0, this->sampleTime, samples[i]);
+            }
+        }
+        const F64 seconds = std::chrono::duration<F64>(std::chrono::steady_clock::now() - start).count();
+        const F64 count = static_cast<F64>(BENCHMARK_SAMPLES) * BENCHMARK_PASSES;
+        ASSERT_EQ(this->attitudeCount - before, BENCHMARK_SAMPLES * BENCHMARK_PASSES);
+
+        // Share of one core taken by 1000 samples a second
+        const F64 nanoseconds = (seconds * 1.0e9) / count;
+        const F64 percent = (nanoseconds * 1000.0 / 1.0e9) * 100.0;
+        ::printf("[ BENCHMARK ] %s: %.0f ns/sample through imuIn, %.4f%% of a core at 1 kHz (budget %.0f%%)\n",
+                 (filter == AttitudeFilter::MAHONY) ? "Mahony" : "Madgwick", nanoseconds, percent,
+                 CORE_BUDGET_PERCENT);
+        ASSERT_TRUE(std::isfinite(this->attitude.get_euler().get_z()));
+    }
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void AttitudeEstimatorTester ::send_sample(const F32 rotation[3], const F32 acceleration[3], U32 us) {
+    const U64 timeUs =
+        (static_cast<U64>(this->sampleTime.getSeconds()) * 1000000) + this->sampleTime.getUSeconds() + us;
+    this->sampleTime =
+        Fw::Time(TimeBase::TB_PROC_TIME, 0, static_cast<U32>(timeUs / 1000000), static_cast<U32>(timeUs % 1000000));
+    const ImuData data(FprimeSensors::GeometricVector3(acceleration[0], acceleration[1], acceleration[2]),
+                       FprimeSensors::GeometricVector3(rotation[0], rotation[1], rotation[2]), 25.0f);
+    this->invoke_to_imuIn(0, this->sampleTime, data);
+}
+
+void AttitudeEstimatorTester ::gravity(F32 roll, F32 pitch, F32 magnitude, F32 acceleration[3]) {
+    // Gravity reads as +1 G up, rotated into the body frame by pitch then roll
+    const F32 r = roll * DEGREES_TO_RADIANS;
+    const F32 p = pitch * DEGREES_TO_RADIANS;
+    acceleration[0] = -std::sin(p) * magnitude;
+    acceleration[1] = std::sin(r) * std::cos(p) * magnitude;
+    acceleration[2] = std::cos(r) * std::cos(p) * magnitude;
+}
+
+void AttitudeEstimatorTester ::set_filter(AttitudeFilter filter, F32 proportional, F32 integral, F32 beta) {
+    this->paramSet_FILTER(filter, Fw::ParamValid::VALID);
+    this->paramSend_FILTER(0, 0);
+    this->paramSet_MAHONY_PROPORTIONAL_GAIN(proportional, Fw::ParamValid::VALID);
+    this->paramSend_MAHONY_PROPORTIONAL_GAIN(0, 0);
+    this->paramSet_MAHONY_INTEGRAL_GAIN(integral, Fw::ParamValid::VALID);
+    this->paramSend_MAHONY_INTEGRAL_GAIN(0, 0);
+    this->paramSet_MADGWICK_BETA(beta, Fw::ParamValid::VALID);
+    this->paramSend_MADGWICK_BETA(0, 0);
+    // Parameters are loaded on the run tick
+    this->invoke_to_run(0, 0);
+    this->clearHistory();
+}
+
+F32 AttitudeEstimatorTester ::angle_difference(F32 angle, F32 expected) {
+    F32 difference = angle - expected;
+    while (difference > 180.0f) {
+        difference -= 360.0f;
+    }
+    while (difference < -180.0f) {
+        difference += 360.0f;
+    }
+    return difference;
+}
+
+void AttitudeEstimatorTester ::from_attitudeOut_handler(FwIndexType portNum,
+                                                        const Fw::Time& time,
+                                                        const MpuImu::Attitude& attitude) {
+    this->attitude = attitude;
+    this->attitudeTime = time;
+    this->attitudeCount++;
+}
+
+}  // namespace MpuImu
@@ -0,0 +1,127 @@
+// ======================================================================
+// \title  AttitudeEstimatorTester.hpp
+// \author mstarch
+// \brief  hpp file for AttitudeEstimator component test harness implementation class
+// ======================================================================
+
+#ifndef MpuImu_AttitudeEstimatorTester_HPP
+#define MpuImu_AttitudeEstimatorTester_HPP
+
+#include "fprime-sensors/MpuImu/Components/AttitudeEstimator/AttitudeEstimator.hpp"
+#include "fprime-sensors/MpuImu/Components/AttitudeEstimator/AttitudeEstimatorGTestBase.hpp"
+
+namespace MpuImu {
+
+class AttitudeEstimatorTester : public AttitudeEstimatorGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const FwSizeType MAX_HISTORY_SIZE = 10;
+
+    // Instance ID supplied to the component instance under test
+    static const FwEnumStoreType TEST_INSTANCE_ID = 0;
+
+    // Sample period of the 1 kHz IMU rate (µs)
+    static const U32 SAMPLE_PERIOD_US = 1000;
+
+    // Samples timed by the benchmark, ten seconds at 1 kHz
+    static const U32 BENCHMARK_SAMPLES = 10000;
+
+    // Passes over the benchmark samples
+    static const U32 BENCHMARK_PASSES = 20;
+
+    // Share of one core the estimator may take at 1 kHz (%)
+    static constexpr F64 CORE_BUDGET_PERCENT = 5.0;
+
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object AttitudeEstimatorTester
+    AttitudeEstimatorTester();
+
+    //! Destroy object AttitudeEstimatorTester
+    ~AttitudeEstimatorTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! Test the first sample aligns roll and pitch to gravity at any magnitude
+    void test_alignment();
+
+    //! Test a constant angular rate about z integrates to the expected yaw with either filter
+    void test_yaw_integration();
+
+    //! Test a changed gravity direction pulls roll and pitch in with either filter
+    void test_accelerometer_correction();
+
+    //! Test the Mahony integral gain removes the attitude error of an angular rate bias
+    void test_rate_bias_integral();
+
+    //! Test samples that are not after the previous one, or long after it, are not integrated
+    void test_sample_gaps();
+
+    //! Test telemetry, the filter parameter, and realignment by command
+    void test_telemetry_and_commands();
+
+    //! Time the per-sample path of each filter through the component and check it fits the 1 kHz budget
+    void test_benchmark();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Send one sample, advancing the sample time by us first
+    void send_sample(const F32 rotation[3], const F32 acceleration[3], U32 us);
+
+    //! Acceleration measured at rest at a roll and pitch (degrees), with a magnitude (G)
+    static void gravity(F32 roll, F32 pitch, F32 magnitude, F32 acceleration[3]);
+
+    //! Select a filter and its gains
+    void set_filter(AttitudeFilter filter, F32 proportional, F32 integral, F32 beta);
+
+    //! Difference of two angles (degrees) wrapped to -180 to 180
+    static F32 angle_difference(F32 angle, F32 expected);
+
+    //! Handler implementation for from_attitudeOut
+    void from_attitudeOut_handler(FwIndexType portNum,             //!< The port number
+                                  const Fw::Time& time,            //!< Time of the sample the estimate was updated with
+                                  const MpuImu::Attitude& attitude  //!< The estimate
+                                  ) final;
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    AttitudeEstimator component;
+
+    //! Time of the last sample sent
+    Fw::Time sampleTime;
+
+    //! Newest estimate emitted, kept here rather than in a history such that the benchmark does not allocate
+    Attitude attitude;
+
+    //! Time of the newest estimate emitted
+    Fw::Time attitudeTime;
+
+    //! Number of estimates emitted
+    U32 attitudeCount = 0;
+};
+
+}  // namespace MpuImu
+
+#endif
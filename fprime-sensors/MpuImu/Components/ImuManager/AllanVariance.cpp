@@ -0,0 +1,126 @@
+// ======================================================================
+// \title  AllanVariance.cpp
+// \author mstarch
+// \brief  cpp file for the streaming overlapping Allan variance of MPU6050 samples
+// ======================================================================
+
+#include "fprime-sensors/MpuImu/Components/ImuManager/AllanVariance.hpp"
+#include "Fw/Types/Assert.hpp"
+
+namespace MpuImu {
+
+AllanVariance ::AllanVariance() : m_decimation(1) {
+    this->reset();
+}
+
+void AllanVariance ::reset() {
+    this->restart();
+    for (U32 octave = 0; octave < OCTAVES; octave++) {
+        this->m_terms[octave] = 0;
+        for (U32 channel = 0; channel < CHANNELS; channel++) {
+            this->m_sums[octave][channel] = 0.0;
+        }
+    }
+}
+
+void AllanVariance ::restart() {
+    this->m_pending = 0;
+    this->m_started = false;
+    this->m_index = 0;
+    this->m_filled = 0;
+    for (U32 channel = 0; channel < CHANNELS; channel++) {
+        this->m_pendingSum[channel] = 0.0;
+        this->m_offset[channel] = 0.0;
+        this->m_integral[channel] = 0.0;
+    }
+}
+
+void AllanVariance ::set_decimation(U16 decimation) {
+    const U16 samples = (decimation == 0) ? 1 : decimation;
+    if (samples != this->m_decimation) {
+        this->m_decimation = samples;
+        this->reset();
+    }
+}
+
+U16 AllanVariance ::decimation() const {
+    return this->m_decimation;
+}
+
+void AllanVariance ::add(const F32 sample[CHANNELS]) {
+    FW_ASSERT(sample != nullptr);
+    for (U32 channel = 0; channel < CHANNELS; channel++) {
+        this->m_pendingSum[channel] += static_cast<F64>(sample[channel]);
+    }
+    this->m_pending++;
+    if (this->m_pending < this->m_decimation) {
+        return;
+    }
+    F64 point[CHANNELS];
+    const F64 scale = 1.0 / static_cast<F64>(this->m_decimation);
+    for (U32 channel = 0; channel < CHANNELS; channel++) {
+        point[channel] = this->m_pendingSum[channel] * scale;
+        this->m_pendingSum[channel] = 0.0;
+    }
+    this->m_pending = 0;
+    this->add_point(point);
+}
+
+void AllanVariance ::add_point(const F64 point[CHANNELS]) {
+    if (!this->m_started) {
+        // The integral starts at zero before the first point
+        for (U32 channel = 0; channel < CHANNELS; channel++) {
+            this->m_offset[channel] = point[channel];
+            this->m_history[0][channel] = 0.0;
+        }
+        this->m_started = true;
+        this->m_filled = 1;
+    }
+    this->m_index++;
+    for (U32 channel = 0; channel < CHANNELS; channel++) {
+        this->m_integral[channel] += point[channel] - this->m_offset[channel];
+    }
+
+    // Integrals up to HISTORY points back are held, the oldest in the slot this point is about to take
+    const U32 mask = HISTORY - 1;
+    for (U32 octave = 0; octave < OCTAVES; octave++) {
+        const U32 cluster = 1U << octave;
+        if (this->m_filled < (2 * cluster)) {
+            break;
+        }
+        const F64* middle = this->m_history[(this->m_index - cluster) & mask];
+        const F64* first = this->m_history[(this->m_index - (2 * cluster)) & mask];
+        for (U32 channel = 0; channel < CHANNELS; channel++) {
+            const F64 difference = this->m_integral[channel] - (2.0 * middle[channel]) + first[channel];
+            this->m_sums[octave][channel] += difference * difference;
+        }
+        // Saturate rather than wrap, the estimate has long since converged
+        if (this->m_terms[octave] < 0xFFFFFFFF) {
+            this->m_terms[octave]++;
+        }
+    }
+    for (U32 channel = 0; channel < CHANNELS; channel++) {
+        this->m_history[this->m_index & mask][channel] = this->m_integral[channel];
+    }
+    if (this->m_filled < HISTORY) {
+        this->m_filled++;
+    }
+}
+
+U32 AllanVariance ::terms(U32 octave) const {
+    FW_ASSERT(octave < OCTAVES, static_cast<FwAssertArgType>(octave));
+    return this->m_terms[octave];
+}
+
+F64 AllanVariance ::variance(U32 octave, U32 channel) const {
+    FW_ASSERT(octave < OCTAVES, static_cast<FwAssertArgType>(octave));
+    FW_ASSERT(channel < CHANNELS, static_cast<FwAssertArgType>(channel));
+    if (this->m_terms[octave] == 0) {
+        return 0.0;
+    }
+    // Each term is m times the difference of two adjacent cluster averages of m points
+    const F64 cluster = static_cast<F64>(1U << octave);
+    return this->m_sums[octave][channel] / (2.0 * cluster * cluster * static_cast<F64>(this->m_terms[octave]));
+}
+
+}  // namespace MpuImu
@@ -0,0 +1,75 @@
+// ======================================================================
+// \title  AllanVariance.hpp
+// \author mstarch
+// \brief  hpp file for the streaming overlapping Allan variance of MPU6050 samples
+// ======================================================================
+
+#ifndef MpuImu_AllanVariance_HPP
+#define MpuImu_AllanVariance_HPP
+
+#include "Fw/FPrimeBasicTypes.hpp"
+
+namespace MpuImu {
+
+//! Accumulates the overlapping Allan variance of accelerometer and gyroscope samples at octave-spaced cluster times
+//!
+//! Samples are first averaged over the decimation into points, then summed into a running integral. The difference of
+//! two adjacent cluster averages of m points is the second difference of the integral at lags m and 2m, so keeping the
+//! last 2^OCTAVES integrals is enough to add the term of every octave starting at each point, overlapping clusters
+//! included, in constant time. The integral is taken relative to the first point since the last restart so it stays
+//! small over long runs; the offset cancels in the second difference.
+class AllanVariance {
+  public:
+    //! Channels of a sample: accelerations (G) then angular rates (degrees per second), each x, y, z
+    static constexpr U32 CHANNELS = 6;
+
+    //! Cluster times accumulated, of 1, 2, 4, ... 2^(OCTAVES - 1) points
+    static constexpr U32 OCTAVES = 10;
+
+    //! Integrals kept, reaching back the two clusters of the longest octave
+    static constexpr U32 HISTORY = 1U << OCTAVES;
+
+    //! Construct an empty accumulator averaging no samples into a point
+    AllanVariance();
+
+    //! Discard every term, keeping the decimation
+    void reset();
+
+    //! Start a new sequence after a gap in the samples, keeping the terms accumulated so far
+    void restart();
+
+    //! Set the samples averaged into each point, one when zero, discarding every term when it changes
+    void set_decimation(U16 decimation);
+
+    //! Samples averaged into each point
+    U16 decimation() const;
+
+    //! Accumulate a sample of CHANNELS values
+    void add(const F32 sample[CHANNELS]);
+
+    //! Terms accumulated at an octave, the clusters of 2^octave points compared
+    U32 terms(U32 octave) const;
+
+    //! Allan variance of a channel at the cluster time of 2^octave points, zero without terms
+    F64 variance(U32 octave, U32 channel) const;
+
+  private:
+    //! Accumulate a point, the average of decimation samples
+    void add_point(const F64 point[CHANNELS]);
+
+    U16 m_decimation;                     //!< Samples averaged into each point
+    U32 m_pending;                        //!< Samples summed toward the next point
+    F64 m_pendingSum[CHANNELS];           //!< Sum of the samples toward the next point by channel
+    bool m_started;                       //!< Whether a point was accumulated since the last restart
+    F64 m_offset[CHANNELS];               //!< First point since the last restart by channel
+    U32 m_index;                          //!< Points accumulated since the last restart, wrapping
+    U32 m_filled;                         //!< Integrals held since the last restart, up to HISTORY
+    F64 m_history[HISTORY][CHANNELS];     //!< Integrals of the last HISTORY points, indexed by point modulo HISTORY
+    F64 m_integral[CHANNELS];             //!< Integral of the points since the last restart by channel
+    U32 m_terms[OCTAVES];                 //!< Terms accumulated by octave
+    F64 m_sums[OCTAVES][CHANNELS];        //!< Sum of squared second differences by octave and channel
+};
+
+}  // namespace MpuImu
+
+#endif
@@ -0,0 +1,57 @@
+// ======================================================================
+// \title  BiasEstimator.cpp
+// \author mstarch
+// \brief  cpp file for the running mean and variance of stationary MPU6050 samples
+// ======================================================================
+
+#include "fprime-sensors/MpuImu/Components/ImuManager/BiasEstimator.hpp"
+#include "Fw/Types/Assert.hpp"
+
+namespace MpuImu {
+
+BiasEstimator ::BiasEstimator() {
+    this->reset();
+}
+
+void BiasEstimator ::reset() {
+    this->m_count = 0;
+    for (U32 channel = 0; channel < CHANNELS; channel++) {
+        this->m_mean[channel] = 0.0;
+        this->m_squaredError[channel] = 0.0;
+    }
+}
+
+void BiasEstimator ::add(const F32 sample[CHANNELS]) {
+    FW_ASSERT(sample != nullptr);
+    // Saturate rather than wrap, a window this long has long since converged
+    if (this->m_count == 0xFFFFFFFF) {
+        return;
+    }
+    this->m_count++;
+    const F64 count = static_cast<F64>(this->m_count);
+    for (U32 channel = 0; channel < CHANNELS; channel++) {
+        const F64 value = static_cast<F64>(sample[channel]);
+        const F64 delta = value - this->m_mean[channel];
+        this->m_mean[channel] += delta / count;
+        this->m_squaredError[channel] += delta * (value - this->m_mean[channel]);
+    }
+}
+
+U32 BiasEstimator ::count() const {
+    return this->m_count;
+}
+
+F64 BiasEstimator ::mean(U32 channel) const {
+    FW_ASSERT(channel < CHANNELS, static_cast<FwAssertArgType>(channel));
+    return this->m_mean[channel];
+}
+
+F64 BiasEstimator ::variance(U32 channel) const {
+    FW_ASSERT(channel < CHANNELS, static_cast<FwAssertArgType>(channel));
+    if (this->m_count < 2) {
+        return 0.0;
+    }
+    return this->m_squaredError[channel] / static_cast<F64>(this->m_count - 1);
+}
+
+}  // namespace MpuImu
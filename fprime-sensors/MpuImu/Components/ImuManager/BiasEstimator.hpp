@@ -0,0 +1,51 @@
+// ======================================================================
+// \title  BiasEstimator.hpp
+// \author mstarch
+// \brief  hpp file for the running mean and variance of stationary MPU6050 samples
+// ======================================================================
+
+#ifndef MpuImu_BiasEstimator_HPP
+#define MpuImu_BiasEstimator_HPP
+
+#include "Fw/FPrimeBasicTypes.hpp"
+
+namespace MpuImu {
+
+//! Accumulates the running mean and variance of accelerometer and gyroscope samples with Welford's algorithm
+//!
+//! Each sample updates the mean by its difference from the current mean and the sum of squared differences by the
+//! product of its differences from the old and new means. Unlike summing the samples and their squares, the variance
+//! does not cancel catastrophically when the mean is large against the noise, as it is for the 1 G accelerometer axis.
+//! State is held in F64 so a window of millions of samples loses no precision.
+class BiasEstimator {
+  public:
+    //! Channels of a sample: accelerations (G) then angular rates (degrees per second), each x, y, z
+    static constexpr U32 CHANNELS = 6;
+
+    //! Construct an empty estimator
+    BiasEstimator();
+
+    //! Discard every sample
+    void reset();
+
+    //! Accumulate a sample of CHANNELS values
+    void add(const F32 sample[CHANNELS]);
+
+    //! Number of samples accumulated
+    U32 count() const;
+
+    //! Mean of a channel, zero when empty
+    F64 mean(U32 channel) const;
+
+    //! Sample variance of a channel, zero with fewer than two samples
+    F64 variance(U32 channel) const;
+
+  private:
+    U32 m_count;                   //!< Samples accumulated
+    F64 m_mean[CHANNELS];          //!< Running mean by channel
+    F64 m_squaredError[CHANNELS];  //!< Running sum of squared differences from the mean by channel
+};
+
+}  // namespace MpuImu
+
+#endif
@@ -0,0 +1,108 @@
+// ======================================================================
+// \title  DeltaIntegrator.cpp
+// \author mstarch
+// \brief  cpp file for the coning and sculling compensated integration of MPU6050 samples
+// ======================================================================
+
+#include "fprime-sensors/MpuImu/Components/ImuManager/DeltaIntegrator.hpp"
+#include "Fw/Types/Assert.hpp"
+
+namespace MpuImu {
+
+DeltaIntegrator ::DeltaIntegrator() {
+    this->reset();
+}
+
+void DeltaIntegrator ::reset() {
+    this->next_interval();
+    this->m_previousValid = false;
+    for (U32 axis = 0; axis < 3; axis++) {
+        this->m_previousAngle[axis] = 0.0;
+        this->m_previousVelocity[axis] = 0.0;
+    }
+}
+
+void DeltaIntegrator ::next_interval() {
+    this->m_samples = 0;
+    this->m_durationUs = 0;
+    for (U32 axis = 0; axis < 3; axis++) {
+        this->m_angle[axis] = 0.0;
+        this->m_velocity[axis] = 0.0;
+        this->m_coning[axis] = 0.0;
+        this->m_sculling[axis] = 0.0;
+    }
+}
+
+void DeltaIntegrator ::add(const F32 rotation[3], const F32 acceleration[3], U32 periodUs) {
+    FW_ASSERT(rotation != nullptr);
+    FW_ASSERT(acceleration != nullptr);
+    const F64 dt = static_cast<F64>(periodUs) * 1.0e-6;
+    F64 angle[3];
+    F64 velocity[3];
+    for (U32 axis = 0; axis < 3; axis++) {
+        angle[axis] = static_cast<F64>(rotation[axis]) * RADIANS_PER_DEGREE * dt;
+        velocity[axis] = static_cast<F64>(acceleration[axis]) * STANDARD_GRAVITY * dt;
+    }
+
+    // Sums to the previous sample plus a sixth of its increment, the second order term of the two-sample fit. Without
+    // a previous sample the term is dropped, degrading the first sample to the one-sample correction.
+    const F64 previousWeight = this->m_previousValid ? (1.0 / 6.0) : 0.0;
+    F64 angleSum[3];
+    F64 velocitySum[3];
+    for (U32 axis = 0; axis < 3; axis++) {
+        angleSum[axis] = this->m_angle[axis] + (previousWeight * this->m_previousAngle[axis]);
+        velocitySum[axis] = this->m_velocity[axis] + (previousWeight * this->m_previousVelocity[axis]);
+    }
+    add_cross(angleSum, angle, 0.5, this->m_coning);
+    add_cross(angleSum, velocity, 0.5, this->m_sculling);
+    add_cross(velocitySum, angle, 0.5, this->m_sculling);
+
+    for (U32 axis = 0; axis < 3; axis++) {
+        this->m_angle[axis] += angle[axis];
+        this->m_velocity[axis] += velocity[axis];
+        this->m_previousAngle[axis] = angle[axis];
+        this->m_previousVelocity[axis] = velocity[axis];
+    }
+    this->m_previousValid = true;
+    // Saturate rather than wrap, no output interval is this long
+    if (this->m_samples < 0xFFFFFFFF) {
+        this->m_samples++;
+    }
+    this->m_durationUs = ((0xFFFFFFFF - this->m_durationUs) < periodUs) ? 0xFFFFFFFF : (this->m_durationUs + periodUs);
+}
+
+U32 DeltaIntegrator ::samples() const {
+    return this->m_samples;
+}
+
+U32 DeltaIntegrator ::duration_us() const {
+    return this->m_durationUs;
+}
+
+void DeltaIntegrator ::delta_angle(F32 angle[3]) const {
+    FW_ASSERT(angle != nullptr);
+    for (U32 axis = 0; axis < 3; axis++) {
+        angle[axis] = static_cast<F32>(this->m_angle[axis] + this->m_coning[axis]);
+    }
+}
+
+void DeltaIntegrator ::delta_velocity(F32 velocity[3]) const {
+    FW_ASSERT(velocity != nullptr);
+    // Rotate the velocity sum, taken in the rotating body frame, back to the frame at the start of the interval
+    F64 result[3];
+    for (U32 axis = 0; axis < 3; axis++) {
+        result[axis] = this->m_velocity[axis] + this->m_sculling[axis];
+    }
+    add_cross(this->m_angle, this->m_velocity, 0.5, result);
+    for (U32 axis = 0; axis < 3; axis++) {
+        velocity[axis] = static_cast<F32>(result[axis]);
+    }
+}
+
+void DeltaIntegrator ::add_cross(const F64 a[3], const F64 b[3], F64 scale, F64 result[3]) {
+    result[0] += scale * ((a[1] * b[2]) - (a[2] * b[1]));
+    result[1] += scale * ((a[2] * b[0]) - (a[0] * b[2]));
+    result[2] += scale * ((a[0] * b[1]) - (a[1] * b[0]));
+}
+
+}  // namespace MpuImu
@@ -0,0 +1,74 @@
+// ======================================================================
+// \title  DeltaIntegrator.hpp
+// \author mstarch
+// \brief  hpp file for the coning and sculling compensated integration of MPU6050 samples
+// ======================================================================
+
+#ifndef MpuImu_DeltaIntegrator_HPP
+#define MpuImu_DeltaIntegrator_HPP
+
+#include "Fw/FPrimeBasicTypes.hpp"
+
+namespace MpuImu {
+
+//! Integrates angular rate and acceleration samples into angle and velocity increments over an output interval
+//!
+//! Summing the per-sample increments is exact only when the rotation axis is fixed over the interval. Coning, an
+//! axis that itself rotates, leaves a rotation the sum misses, and sculling, a rotation in phase with an acceleration,
+//! rectifies into a velocity the sum misses, both growing with vibration. Each sample adds the two-sample recursive
+//! corrections of Savage (Strapdown Analytics, 7.1.1), using the increments of the previous sample even across
+//! intervals, and the velocity is rotated into the body frame at the start of the interval. State is held in F64 so a
+//! long interval at a high rate loses no precision.
+class DeltaIntegrator {
+  public:
+    //! Radians in a degree
+    static constexpr F64 RADIANS_PER_DEGREE = 0.017453292519943295;
+
+    //! Standard gravity (meters per second squared in a G)
+    static constexpr F64 STANDARD_GRAVITY = 9.80665;
+
+    //! Construct an empty integrator
+    DeltaIntegrator();
+
+    //! Discard the interval and the previous sample, as after a gap in the samples
+    void reset();
+
+    //! Start a new interval, keeping the previous sample for the corrections of the next
+    void next_interval();
+
+    //! Integrate a sample held over a period
+    void add(const F32 rotation[3],      //!< Angular rate by axis (degrees per second)
+             const F32 acceleration[3],  //!< Acceleration by axis (G)
+             U32 periodUs                //!< Time the sample covers (µs)
+    );
+
+    //! Number of samples integrated in the interval
+    U32 samples() const;
+
+    //! Time the samples of the interval cover (µs)
+    U32 duration_us() const;
+
+    //! Rotation vector over the interval with the coning correction (radians)
+    void delta_angle(F32 angle[3]) const;
+
+    //! Velocity increment over the interval with the rotation and sculling corrections (meters per second)
+    void delta_velocity(F32 velocity[3]) const;
+
+  private:
+    //! Cross product a x b added to result, scaled
+    static void add_cross(const F64 a[3], const F64 b[3], F64 scale, F64 result[3]);
+
+    U32 m_samples;               //!< Samples integrated in the interval
+    U32 m_durationUs;            //!< Time the samples of the interval cover (µs)
+    bool m_previousValid;        //!< Whether the previous sample increments are valid
+    F64 m_angle[3];              //!< Sum of the angle increments of the interval (radians)
+    F64 m_velocity[3];           //!< Sum of the velocity increments of the interval (meters per second)
+    F64 m_coning[3];             //!< Coning correction of the interval (radians)
+    F64 m_sculling[3];           //!< Sculling correction of the interval (meters per second)
+    F64 m_previousAngle[3];      //!< Angle increment of the previous sample (radians)
+    F64 m_previousVelocity[3];   //!< Velocity increment of the previous sample (meters per second)
+};
+
+}  // namespace MpuImu
+
+#endif
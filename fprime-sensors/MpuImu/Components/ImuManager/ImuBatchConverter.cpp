@@ -0,0 +1,248 @@
+// ======================================================================
+// \title  ImuBatchConverter.cpp
+// \author mstarch
+// \brief  cpp file for the batch unpack and scale kernel of raw MPU6050 records
+// ======================================================================
+
+#include "fprime-sensors/MpuImu/Components/ImuManager/ImuBatchConverter.hpp"
+#include "Fw/Types/Assert.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define MPU_IMU_BATCH_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define MPU_IMU_BATCH_NEON 1
+#endif
+
+namespace MpuImu {
+
+namespace {
+//! Records converted by one pass of the SIMD kernel
+constexpr U32 SIMD_BLOCK = 4;
+
+//! Bytes loaded per record by the SIMD kernel, past the end of a record
+constexpr U32 SIMD_LOAD = 16;
+
+//! Word offset of the gyroscope in a record
+inline U32 rotation_word(ImuBatchConverter::RecordFormat format) {
+    return (format == ImuBatchConverter::REGISTER_RECORD) ? 4 : 3;
+}
+
+//! Big-endian I16 at a byte pointer
+inline I16 load_word(const U8* bytes) {
+    return static_cast<I16>(static_cast<U16>((static_cast<U16>(bytes[0]) << 8) | bytes[1]));
+}
+
+#if defined(MPU_IMU_BATCH_SSE2)
+//! Swap the bytes of each 16-bit lane
+inline __m128i swap_bytes(__m128i value) {
+    return _mm_or_si128(_mm_slli_epi16(value, 8), _mm_srli_epi16(value, 8));
+}
+
+//! Sign-extend and convert the low four 16-bit lanes
+inline __m128 low_words(__m128i value) {
+    return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(value, value), 16));
+}
+
+//! Sign-extend and convert the high four 16-bit lanes
+inline __m128 high_words(__m128i value) {
+    return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(value, value), 16));
+}
+#elif defined(MPU_IMU_BATCH_NEON)
+//! Load a record and swap the bytes of each 16-bit word
+inline int16x8_t load_record(const U8* bytes) {
+    return vreinterpretq_s16_u8(vrev16q_u8(vld1q_u8(bytes)));
+}
+
+//! Sign-extend and convert the low four 16-bit lanes
+inline float32x4_t low_words(int32x4_t value) {
+    return vcvtq_f32_s32(vmovl_s16(vget_low_s16(vreinterpretq_s16_s32(value))));
+}
+
+//! Sign-extend and convert the high four 16-bit lanes
+inline float32x4_t high_words(int32x4_t value) {
+    return vcvtq_f32_s32(vmovl_s16(vget_high_s16(vreinterpretq_s16_s32(value))));
+}
+#endif
+}  // namespace
+
+#if defined(MPU_IMU_BATCH_SSE2) || defined(MPU_IMU_BATCH_NEON)
+const bool ImuBatchConverter::SIMD_AVAILABLE = true;
+#else
+const bool ImuBatchConverter::SIMD_AVAILABLE = false;
+#endif
+
+ImuBatchConverter ::ImuBatchConverter()
+    : m_accelerationScale(acceleration_scale(AccelerationRange::RANGE_2G)),
+      m_rotationScale(rotation_scale(GyroscopeRange::RANGE_250DEG)) {
+    for (U32 axis = 0; axis < 3; axis++) {
+        this->m_accelerationBias[axis] = 0.0f;
+        this->m_rotationBias[axis] = 0.0f;
+    }
+    this->update_offsets();
+}
+
+void ImuBatchConverter ::configure(AccelerationRange accelerationRange, GyroscopeRange gyroscopeRange) {
+    this->m_accelerationScale = acceleration_scale(accelerationRange);
+    this->m_rotationScale = rotation_scale(gyroscopeRange);
+    this->update_offsets();
+}
+
+void ImuBatchConverter ::set_bias(const F32 acceleration[3], const F32 rotation[3]) {
+    FW_ASSERT((acceleration != nullptr) && (rotation != nullptr));
+    for (U32 axis = 0; axis < 3; axis++) {
+        this->m_accelerationBias[axis] = acceleration[axis];
+        this->m_rotationBias[axis] = rotation[axis];
+    }
+    this->update_offsets();
+}
+
+void ImuBatchConverter ::update_offsets() {
+    // A zero bias is a zero offset, leaving the conversion identical to the unbiased one
+    for (U32 axis = 0; axis < 3; axis++) {
+        this->m_accelerationOffset[axis] = this->m_accelerationBias[axis] / this->m_accelerationScale;
+        this->m_rotationOffset[axis] = this->m_rotationBias[axis] / this->m_rotationScale;
+    }
+}
+
+F32 ImuBatchConverter ::acceleration_scale(AccelerationRange range) {
+    return 1.0f / static_cast<F32>(range.e);
+}
+
+F32 ImuBatchConverter ::rotation_scale(GyroscopeRange range) {
+    // Range values are counts per tenth of a degree per second
+    return 10.0f / static_cast<F32>(range.e);
+}
+
+F32 ImuBatchConverter ::temperature_from_raw(I16 raw) {
+    return (static_cast<F32>(raw) / TEMPERATURE_SCALAR) + TEMPERATURE_OFFSET;
+}
+
+void ImuBatchConverter ::convert_scalar(const U8* records,
+                                        U32 count,
+                                        RecordFormat format,
+                                        const ImuBatchArrays& out) const {
+    this->convert_records(records, 0, count, format, out);
+}
+
+void ImuBatchConverter ::convert(const U8* records, U32 count, RecordFormat format, const ImuBatchArrays& out) const {
+    FW_ASSERT((format == REGISTER_RECORD) || (format == FIFO_RECORD), static_cast<FwAssertArgType>(format));
+    const U32 stride = static_cast<U32>(format);
+    U32 i = 0;
+#if defined(MPU_IMU_BATCH_SSE2) || defined(MPU_IMU_BATCH_NEON)
+    FW_ASSERT((count == 0) || (records != nullptr));
+    const U32 rotation = rotation_word(format);
+    const bool temperature = (format == REGISTER_RECORD);
+#if defined(MPU_IMU_BATCH_SSE2)
+    const __m128 accelerationScale = _mm_set1_ps(this->m_accelerationScale);
+    const __m128 rotationScale = _mm_set1_ps(this->m_rotationScale);
+    const __m128 temperatureScalar = _mm_set1_ps(TEMPERATURE_SCALAR);
+    const __m128 temperatureOffset = _mm_set1_ps(TEMPERATURE_OFFSET);
+    const __m128 accelerationOffset[3] = {_mm_set1_ps(this->m_accelerationOffset[0]),
+                                          _mm_set1_ps(this->m_accelerationOffset[1]),
+                                          _mm_set1_ps(this->m_accelerationOffset[2])};
+    const __m128 rotationOffset[3] = {_mm_set1_ps(this->m_rotationOffset[0]), _mm_set1_ps(this->m_rotationOffset[1]),
+                                      _mm_set1_ps(this->m_rotationOffset[2])};
+#else
+    const float32x4_t accelerationScale = vdupq_n_f32(this->m_accelerationScale);
+    const float32x4_t rotationScale = vdupq_n_f32(this->m_rotationScale);
+    const float32x4_t temperatureScalar = vdupq_n_f32(TEMPERATURE_SCALAR);
+    const float32x4_t temperatureOffset = vdupq_n_f32(TEMPERATURE_OFFSET);
+    const float32x4_t accelerationOffset[3] = {vdupq_n_f32(this->m_accelerationOffset[0]),
+                                               vdupq_n_f32(this->m_accelerationOffset[1]),
+                                               vdupq_n_f32(this->m_accelerationOffset[2])};
+    const float32x4_t rotationOffset[3] = {vdupq_n_f32(this->m_rotationOffset[0]),
+                                           vdupq_n_f32(this->m_rotationOffset[1]),
+                                           vdupq_n_f32(this->m_rotationOffset[2])};
+#endif
+    // Each record is loaded as 16 bytes, so a block is only converted when its last load stays inside the batch
+    for (; (static_cast<U64>(i + SIMD_BLOCK - 1) * stride) + SIMD_LOAD <= static_cast<U64>(count) * stride;
+         i += SIMD_BLOCK) {
+        const U8* block = records + (i * stride);
+#if defined(MPU_IMU_BATCH_SSE2)
+        const __m128i r0 = swap_bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block)));
+        const __m128i r1 = swap_bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + stride)));
+        const __m128i r2 = swap_bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + (2 * stride))));
+        const __m128i r3 = swap_bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + (3 * stride))));
+        // Transpose four records of eight words into eight words of four records, two words per register
+        const __m128i t0 = _mm_unpacklo_epi16(r0, r1);
+        const __m128i t1 = _mm_unpacklo_epi16(r2, r3);
+        const __m128i t2 = _mm_unpackhi_epi16(r0, r1);
+        const __m128i t3 = _mm_unpackhi_epi16(r2, r3);
+        const __m128i pairs[4] = {_mm_unpacklo_epi32(t0, t1), _mm_unpackhi_epi32(t0, t1), _mm_unpacklo_epi32(t2, t3),
+                                  _mm_unpackhi_epi32(t2, t3)};
+        __m128 words[7];
+        for (U32 pair = 0; pair < 4; pair++) {
+            words[2 * pair] = low_words(pairs[pair]);
+            if (pair < 3) {
+                words[(2 * pair) + 1] = high_words(pairs[pair]);
+            }
+        }
+        for (U32 axis = 0; axis < 3; axis++) {
+            _mm_storeu_ps(&out.acceleration[axis][i],
+                          _mm_mul_ps(_mm_sub_ps(words[axis], accelerationOffset[axis]), accelerationScale));
+            _mm_storeu_ps(&out.rotation[axis][i],
+                          _mm_mul_ps(_mm_sub_ps(words[rotation + axis], rotationOffset[axis]), rotationScale));
+        }
+        if (temperature) {
+            _mm_storeu_ps(&out.temperature[i], _mm_add_ps(_mm_div_ps(words[3], temperatureScalar), temperatureOffset));
+        }
+#else
+        const int16x8_t r0 = load_record(block);
+        const int16x8_t r1 = load_record(block + stride);
+        const int16x8_t r2 = load_record(block + (2 * stride));
+        const int16x8_t r3 = load_record(block + (3 * stride));
+        // Transpose four records of eight words into eight words of four records, two words per register
+        const int16x8x2_t t01 = vzipq_s16(r0, r1);
+        const int16x8x2_t t23 = vzipq_s16(r2, r3);
+        const int32x4x2_t low = vzipq_s32(vreinterpretq_s32_s16(t01.val[0]), vreinterpretq_s32_s16(t23.val[0]));
+        const int32x4x2_t high = vzipq_s32(vreinterpretq_s32_s16(t01.val[1]), vreinterpretq_s32_s16(t23.val[1]));
+        const int32x4_t pairs[4] = {low.val[0], low.val[1], high.val[0], high.val[1]};
+        float32x4_t words[7];
+        for (U32 pair = 0; pair < 4; pair++) {
+            words[2 * pair] = low_words(pairs[pair]);
+            if (pair < 3) {
+                words[(2 * pair) + 1] = high_words(pairs[pair]);
+            }
+        }
+        for (U32 axis = 0; axis < 3; axis++) {
+            vst1q_f32(&out.acceleration[axis][i],
+                      vmulq_f32(vsubq_f32(words[axis], accelerationOffset[axis]), accelerationScale));
+            vst1q_f32(&out.rotation[axis][i],
+                      vmulq_f32(vsubq_f32(words[rotation + axis], rotationOffset[axis]), rotationScale));
+        }
+        if (temperature) {
+            vst1q_f32(&out.temperature[i], vaddq_f32(vdivq_f32(words[3], temperatureScalar), temperatureOffset));
+        }
+#endif
+    }
+#endif
+    this->convert_records(records, i, count, format, out);
+}
+
+void ImuBatchConverter ::convert_records(const U8* records,
+                                         U32 first,
+                                         U32 count,
+                                         RecordFormat format,
+                                         const ImuBatchArrays& out) const {
+    FW_ASSERT((format == REGISTER_RECORD) || (format == FIFO_RECORD), static_cast<FwAssertArgType>(format));
+    const U32 stride = static_cast<U32>(format);
+    const U32 rotation = rotation_word(format) * sizeof(I16);
+    for (U32 i = first; i < count; i++) {
+        const U8* record = records + (i * stride);
+        for (U32 axis = 0; axis < 3; axis++) {
+            out.acceleration[axis][i] =
+                (static_cast<F32>(load_word(record + (axis * sizeof(I16)))) - this->m_accelerationOffset[axis]) *
+                this->m_accelerationScale;
+            out.rotation[axis][i] = (static_cast<F32>(load_word(record + rotation + (axis * sizeof(I16)))) -
+                                     this->m_rotationOffset[axis]) *
+                                    this->m_rotationScale;
+        }
+        if (format == REGISTER_RECORD) {
+            out.temperature[i] = temperature_from_raw(load_word(record + (3 * sizeof(I16))));
+        }
+    }
+}
+
+}  // namespace MpuImu
@@ -0,0 +1,86 @@
+// ======================================================================
+// \title  ImuBatchConverter.hpp
+// \author mstarch
+// \brief  hpp file for the batch unpack and scale kernel of raw MPU6050 records
+// ======================================================================
+
+#ifndef MpuImu_ImuBatchConverter_HPP
+#define MpuImu_ImuBatchConverter_HPP
+
+#include "Fw/FPrimeBasicTypes.hpp"
+#include "fprime-sensors/MpuImu/Components/ImuManager/ImuTypes.hpp"
+#include "fprime-sensors/MpuImu/Types/AccelerationRangeEnumAc.hpp"
+#include "fprime-sensors/MpuImu/Types/GyroscopeRangeEnumAc.hpp"
+
+namespace MpuImu {
+
+//! Structure-of-arrays destination of a batch conversion, each array holding at least the batch count
+struct ImuBatchArrays {
+    F32* acceleration[3];  //!< Accelerations (G) by axis
+    F32* rotation[3];      //!< Angular rates (degrees per second) by axis
+    F32* temperature;      //!< Temperatures (degrees Celsius), not written for FIFO records
+};
+
+//! Converts batches of big-endian MPU6050 records into structure-of-arrays F32 samples
+//!
+//! Records are either the 14-byte data register block (accelerometer, temperature, gyroscope) or the 12-byte FIFO
+//! frame (accelerometer, gyroscope). Accelerometer and gyroscope counts are scaled by reciprocals computed once per
+//! configuration. A bias set on the converter is held as an offset in counts of the configured range, so removing it
+//! costs a subtraction before the scale. Blocks of four records are byte swapped, transposed, converted, offset, and
+//! scaled with SSE2 or AArch64 NEON where available; the remaining records, and every record on other targets, take
+//! the scalar path. Both paths perform the same IEEE operations and produce identical results.
+class ImuBatchConverter {
+  public:
+    //! Record layouts, valued by their length in bytes
+    enum RecordFormat : U8 {
+        REGISTER_RECORD = DATA_LENGTH,    //!< Data registers from 0x3B, with temperature
+        FIFO_RECORD = FIFO_FRAME_LENGTH,    //!< FIFO frame of accelerometer then gyroscope
+    };
+
+    //! Whether convert uses a SIMD kernel on this target
+    static const bool SIMD_AVAILABLE;
+
+    //! Construct a converter for the reset ranges, 2 G and 250 degrees per second
+    ImuBatchConverter();
+
+    //! Precompute the scale factors of a pair of ranges, keeping the bias
+    void configure(AccelerationRange accelerationRange, GyroscopeRange gyroscopeRange);
+
+    //! Set the bias removed from every converted sample, keeping the ranges
+    void set_bias(const F32 acceleration[3],  //!< Acceleration bias by axis (G)
+                  const F32 rotation[3]       //!< Angular rate bias by axis (degrees per second)
+    );
+
+    //! Convert count records, using the SIMD kernel where available
+    void convert(const U8* records, U32 count, RecordFormat format, const ImuBatchArrays& out) const;
+
+    //! Convert count records one at a time
+    void convert_scalar(const U8* records, U32 count, RecordFormat format, const ImuBatchArrays& out) const;
+
+    //! G per count of an accelerometer range
+    static F32 acceleration_scale(AccelerationRange range);
+
+    //! Degrees per second per count of a gyroscope range
+    static F32 rotation_scale(GyroscopeRange range);
+
+    //! Degrees Celsius of a raw temperature
+    static F32 temperature_from_raw(I16 raw);
+
+  private:
+    //! Convert records from first to count one at a time
+    void convert_records(const U8* records, U32 first, U32 count, RecordFormat format, const ImuBatchArrays& out) const;
+
+    //! Recompute the count offsets of the bias at the configured scales
+    void update_offsets();
+
+    F32 m_accelerationScale;      //!< G per count
+    F32 m_rotationScale;          //!< Degrees per second per count
+    F32 m_accelerationBias[3];    //!< Acceleration bias by axis (G)
+    F32 m_rotationBias[3];        //!< Angular rate bias by axis (degrees per second)
+    F32 m_accelerationOffset[3];  //!< Acceleration bias by axis in counts of the configured range
+    F32 m_rotationOffset[3];      //!< Angular rate bias by axis in counts of the configured range
+};
+
+}  // namespace MpuImu
+
+#endif
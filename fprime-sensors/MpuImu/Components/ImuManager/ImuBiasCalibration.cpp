@@ -0,0 +1,252 @@
+// ======================================================================
+// \title  ImuBiasCalibration.cpp
+// \author mstarch
+// \brief  cpp file for ImuManager bias calibration and bias file helper implementations
+// ======================================================================
+
+#include "fprime-sensors/MpuImu/Components/ImuManager/ImuManager.hpp"
+#include <cmath>
+#include "Os/File.hpp"
+#include "Utils/Hash/Hash.hpp"
+
+namespace MpuImu {
+
+// Bias file record layout, see BIAS_RECORD_SIZE
+static constexpr U32 RECORD_MARKER_OFFSET = 0;
+static constexpr U32 RECORD_CRC_OFFSET = 1 + (6 * sizeof(F32));
+static_assert(RECORD_CRC_OFFSET + sizeof(U32) == BIAS_RECORD_SIZE, "Bias record layout does not fill the record");
+
+// CRC-32 of the bytes of a bias record ahead of its CRC, with the framework hash (IEEE 802.3 CRC-32)
+static U32 record_crc(const U8* record) {
+    Utils::Hash hash;
+    hash.init();
+    hash.update(record, RECORD_CRC_OFFSET);
+    U32 crc = 0;
+    hash.final(crc);
+    return crc;
+}
+
+bool ImuManager ::estimate_bias(const BiasEstimator& estimator,
+                                F32 accelerationNoiseLimit,
+                                F32 rotationNoiseLimit,
+                                F32 accelerationBias[3],
+                                F32 rotationBias[3],
+                                ImuBiasRejection& reason) {
+    if (estimator.count() < BIAS_MIN_SAMPLES) {
+        reason = ImuBiasRejection::TOO_FEW_SAMPLES;
+        return false;
+    }
+    // A moving device varies by more than the sensor noise on some channel
+    const F64 accelerationVarianceLimit = static_cast<F64>(accelerationNoiseLimit) * accelerationNoiseLimit;
+    const F64 rotationVarianceLimit = static_cast<F64>(rotationNoiseLimit) * rotationNoiseLimit;
+    for (U32 axis = 0; axis < 3; axis++) {
+        if (!(estimator.variance(axis) <= accelerationVarianceLimit) ||
+            !(estimator.variance(3 + axis) <= rotationVarianceLimit)) {
+            reason = ImuBiasRejection::MOTION;
+            return false;
+        }
+    }
+
+    // Gravity is on the axis reading the most acceleration, whichever way up the device is mounted
+    U32 vertical = 0;
+    for (U32 axis = 1; axis < 3; axis++) {
+        if (std::fabs(estimator.mean(axis)) > std::fabs(estimator.mean(vertical))) {
+            vertical = axis;
+        }
+    }
+    F32 acceleration[3];
+    F32 rotation[3];
+    for (U32 axis = 0; axis < 3; axis++) {
+        const F64 gravity = (axis != vertical) ? 0.0 : ((estimator.mean(axis) < 0.0) ? -1.0 : 1.0);
+        acceleration[axis] = accelerationBias[axis] + static_cast<F32>(estimator.mean(axis) - gravity);
+        rotation[axis] = rotationBias[axis] + static_cast<F32>(estimator.mean(3 + axis));
+        // A tilted mount also shows up here, as gravity on the horizontal axes
+        if (!(std::fabs(acceleration[axis]) <= BIAS_MAX_ACCELERATION) ||
+            !(std::fabs(rotation[axis]) <= BIAS_MAX_ROTATION)) {
+            reason = ImuBiasRejection::OUT_OF_RANGE;
+            return false;
+        }
+    }
+    for (U32 axis = 0; axis < 3; axis++) {
+        accelerationBias[axis] = acceleration[axis];
+        rotationBias[axis] = rotation[axis];
+    }
+    return true;
+}
+
+I16 ImuManager ::gyro_offset_counts(F32 rotationBias) {
+    // The registers are added to the gyroscope output, so they hold the negated bias
+    const F32 counts = -rotationBias * GYRO_OFFSET_COUNTS_PER_DPS;
+    if (!(counts > -32768.0f)) {
+        return -32768;
+    }
+    if (counts >= 32767.0f) {
+        return 32767;
+    }
+    return static_cast<I16>(std::lround(counts));
+}
+
+void ImuManager ::accumulate_bias(FwIndexType device, const ImuData& imuData) {
+    if (!this->m_biasActive) {
+        return;
+    }
+    const F32 sample[BiasEstimator::CHANNELS] = {
+        imuData.get_acceleration().get_x(), imuData.get_acceleration().get_y(), imuData.get_acceleration().get_z(),
+        imuData.get_rotation().get_x(),     imuData.get_rotation().get_y(),     imuData.get_rotation().get_z()};
+    this->m_devices[device].estimator.add(sample);
+}
+
+void ImuManager ::finish_bias_calibration() {
+    this->m_biasActive = false;
+    Fw::ParamValid paramValid;
+    const F32 accelerationNoiseLimit = this->paramGet_BIAS_ACCELERATION_NOISE_LIMIT(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    const F32 rotationNoiseLimit = this->paramGet_BIAS_ROTATION_NOISE_LIMIT(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+
+    bool accepted = true;
+    bool calibrated = false;
+    for (FwIndexType device = 0; device < MAX_DEVICES; device++) {
+        Device& state = this->m_devices[device];
+        if (!state.managed) {
+            continue;
+        }
+        ImuBiasRejection reason = ImuBiasRejection::TOO_FEW_SAMPLES;
+        if (!estimate_bias(state.estimator, accelerationNoiseLimit, rotationNoiseLimit, state.accelerationBias,
+                           state.rotationBias, reason)) {
+            this->log_WARNING_HI_BiasCalibrationRejected(static_cast<U8>(device), reason);
+            accepted = false;
+            continue;
+        }
+        state.biasValid = true;
+        calibrated = true;
+        this->log_ACTIVITY_HI_BiasCalibrated(
+            static_cast<U8>(device),
+            FprimeSensors::GeometricVector3(state.accelerationBias[0], state.accelerationBias[1],
+                                            state.accelerationBias[2]),
+            FprimeSensors::GeometricVector3(state.rotationBias[0], state.rotationBias[1], state.rotationBias[2]));
+        // Offset registers are rewritten by reconfiguring, until then samples keep the previous offsets
+        if (state.hardwareOffsets) {
+            this->send_signal(device, MpuImu_ImuStateMachine::Signal::reconfigure);
+        } else {
+            this->apply_bias(device);
+        }
+    }
+    if (calibrated) {
+        this->report_bias();
+        this->store_bias_file();
+    }
+    this->cmdResponse_out(this->m_biasOpCode, this->m_biasCmdSeq,
+                          accepted ? Fw::CmdResponse::OK : Fw::CmdResponse::EXECUTION_ERROR);
+}
+
+void ImuManager ::apply_bias(FwIndexType device) {
+    FW_ASSERT((device >= 0) && (device < MAX_DEVICES), static_cast<FwAssertArgType>(device));
+    Device& state = this->m_devices[device];
+    // Samples arrive without the angular rate bias when the offset registers hold it
+    const F32 noRotation[3] = {0.0f, 0.0f, 0.0f};
+    state.converter.set_bias(state.accelerationBias, state.hardwareOffsets ? noRotation : state.rotationBias);
+}
+
+void ImuManager ::report_bias() {
+    const Device& state = this->m_devices[0];
+    this->tlmWrite_AccelerationBias(FprimeSensors::GeometricVector3(
+        state.accelerationBias[0], state.accelerationBias[1], state.accelerationBias[2]));
+    this->tlmWrite_RotationBias(
+        FprimeSensors::GeometricVector3(state.rotationBias[0], state.rotationBias[1], state.rotationBias[2]));
+}
+
+void ImuManager ::load_bias_file() {
+    Os::File file;
+    Os::File::Status status = file.open(this->m_biasPath.toChar(), Os::File::OPEN_READ);
+    if (status == Os::File::DOESNT_EXIST) {
+        return;  // Never calibrated, the file is written by the first calibration
+    }
+    U8 contents[MAX_DEVICES * BIAS_RECORD_SIZE];
+    FwSizeType size = sizeof(contents);
+    if (status == Os::File::OP_OK) {
+        status = file.read(contents, size);
+        file.close();
+    }
+    if ((status != Os::File::OP_OK) || (size != sizeof(contents))) {
+        this->log_WARNING_LO_BiasFileReadFailure(static_cast<I32>(status));
+        return;
+    }
+
+    U8 loaded = 0;
+    for (FwIndexType device = 0; device < MAX_DEVICES; device++) {
+        U8* record = &contents[device * BIAS_RECORD_SIZE];
+        if (record[RECORD_MARKER_OFFSET] == 0) {
+            continue;  // Device was never calibrated
+        }
+        const U32 crc = (static_cast<U32>(record[RECORD_CRC_OFFSET]) << 24) |
+                        (static_cast<U32>(record[RECORD_CRC_OFFSET + 1]) << 16) |
+                        (static_cast<U32>(record[RECORD_CRC_OFFSET + 2]) << 8) |
+                        static_cast<U32>(record[RECORD_CRC_OFFSET + 3]);
+        if ((record[RECORD_MARKER_OFFSET] != BIAS_RECORD_VALID) || (crc != record_crc(record))) {
+            this->log_WARNING_LO_BiasFileInvalid(static_cast<U8>(device));
+            continue;
+        }
+
+        Device& state = this->m_devices[device];
+        Fw::Buffer buffer(record, RECORD_CRC_OFFSET);
+        auto deserializer = buffer.getDeserializer();
+        U8 marker = 0;
+        deserializer.deserialize(marker);
+        for (U32 axis = 0; axis < 3; axis++) {
+            deserializer.deserialize(state.accelerationBias[axis]);
+        }
+        for (U32 axis = 0; axis < 3; axis++) {
+            deserializer.deserialize(state.rotationBias[axis]);
+        }
+        state.biasValid = true;
+        this->apply_bias(device);
+        loaded++;
+    }
+    this->log_ACTIVITY_LO_BiasFileLoaded(loaded);
+    this->report_bias();
+}
+
+void ImuManager ::store_bias_file() {
+    if (!this->m_biasFileEnabled) {
+        return;
+    }
+    U8 contents[MAX_DEVICES * BIAS_RECORD_SIZE] = {0};
+    for (FwIndexType device = 0; device < MAX_DEVICES; device++) {
+        const Device& state = this->m_devices[device];
+        if (!state.biasValid) {
+            continue;  // Left as an empty record
+        }
+        U8* record = &contents[device * BIAS_RECORD_SIZE];
+        Fw::Buffer buffer(record, RECORD_CRC_OFFSET);
+        auto serializer = buffer.getSerializer();
+        serializer.serialize(BIAS_RECORD_VALID);
+        for (U32 axis = 0; axis < 3; axis++) {
+            serializer.serialize(state.accelerationBias[axis]);
+        }
+        for (U32 axis = 0; axis < 3; axis++) {
+            serializer.serialize(state.rotationBias[axis]);
+        }
+        const U32 crc = record_crc(record);
+        record[RECORD_CRC_OFFSET] = static_cast<U8>(crc >> 24);
+        record[RECORD_CRC_OFFSET + 1] = static_cast<U8>(crc >> 16);
+        record[RECORD_CRC_OFFSET + 2] = static_cast<U8>(crc >> 8);
+        record[RECORD_CRC_OFFSET + 3] = static_cast<U8>(crc);
+    }
+
+    Os::File file;
+    Os::File::Status status = file.open(this->m_biasPath.toChar(), Os::File::OPEN_CREATE, Os::File::OVERWRITE);
+    if (status == Os::File::OP_OK) {
+        FwSizeType size = sizeof(contents);
+        status = file.write(contents, size);
+        file.close();
+        if ((status == Os::File::OP_OK) && (size != sizeof(contents))) {
+            status = Os::File::BAD_SIZE;
+        }
+    }
+    if (status != Os::File::OP_OK) {
+        this->log_WARNING_LO_BiasFileWriteFailure(static_cast<I32>(status));
+    }
+}
+
+}  // namespace MpuImu
@@ -5,85 +5,322 @@
 // ======================================================================
 
 #include "fprime-sensors/MpuImu/Components/ImuManager/ImuManager.hpp"
+#include <algorithm>
+#include <cmath>
 #include "fprime-sensors/MpuImu/Components/ImuManager/ImuTypes.hpp"
 
 namespace MpuImu {
 
-Drv::I2cStatus ImuManager ::reset() {
+Drv::I2cStatus ImuManager ::reset(FwIndexType device) {
     // Attempt to write the reset data
     U8 reset_sequence[] = {POWER_MGMT_REGISTER, RESET_VALUE};
     Fw::Buffer writeBuffer(reset_sequence, sizeof(reset_sequence));
     Fw::Buffer readBuffer;
-    return this->bus_write(writeBuffer, readBuffer);
+    return this->bus_write(device, writeBuffer, readBuffer);
 }
 
-Drv::I2cStatus ImuManager ::read_reset(U8& value) {
+Drv::I2cStatus ImuManager ::read_reset(FwIndexType device, U8& value) {
     U8 registerAddress = POWER_MGMT_REGISTER;
     Fw::Buffer writeBuffer(&registerAddress, sizeof(registerAddress));
     Fw::Buffer readBuffer(&value, sizeof(value));
-    return this->bus_write(writeBuffer, readBuffer);
+    return this->bus_write(device, writeBuffer, readBuffer);
 }
 
-Drv::I2cStatus ImuManager ::enable() {
-    U8 power_on_sequence[] = {POWER_MGMT_REGISTER, POWER_ON_VALUE};
-    Fw::Buffer writeBuffer(power_on_sequence, sizeof(power_on_sequence));
-    Fw::Buffer readBuffer;
-    return this->bus_write(writeBuffer, readBuffer);
+Drv::I2cStatus ImuManager ::enable(FwIndexType device) {
+    // Every other register holds its reset value, so only the power management register is written
+    this->m_devices[device].registers.set(POWER_MGMT_REGISTER, POWER_ON_VALUE);
+    return this->write_registers(device);
 }
 
-Drv::I2cStatus ImuManager ::configure_device() {
+Drv::I2cStatus ImuManager ::configure_device(FwIndexType device) {
     Fw::ParamValid paramValid;
-    Drv::I2cStatus status = Drv::I2cStatus::I2C_OK;
-    // Read accelerometer parameter and configure
+    Device& state = this->m_devices[device];
+    // Read the range parameters into the configuration registers, the conversion uses the same ranges
     {
         const AccelerationRange accelerationRange = this->paramGet_ACCELEROMETER_RANGE(paramValid);
         FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
-
-        U8 accel_config_sequence[] = {ACCEL_CONFIG_REGISTER, this->accelerometer_range_to_register(accelerationRange)};
-        Fw::Buffer writeBuffer(accel_config_sequence, sizeof(accel_config_sequence));
-        Fw::Buffer readBuffer;
-        status = this->bus_write(writeBuffer, readBuffer);
-        if (status != Drv::I2cStatus::I2C_OK) {
-            return status;
+        const GyroscopeRange gyroscopeRange = this->paramGet_GYROSCOPE_RANGE(paramValid);
+        FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+        state.registers.set(ACCEL_CONFIG_REGISTER, this->accelerometer_range_to_register(accelerationRange));
+        state.registers.set(GYRO_CONFIG_REGISTER, this->gyroscope_range_to_register(gyroscopeRange));
+        state.converter.configure(accelerationRange, gyroscopeRange);
+    }
+    // Remove the gyroscope bias in the offset registers, or clear offsets written before the parameter was disabled
+    {
+        const bool hardwareOffsets = this->paramGet_BIAS_HARDWARE_OFFSETS(paramValid);
+        FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+        // X, Y, and Z offsets are contiguous big-endian registers
+        for (U32 axis = 0; axis < 3; axis++) {
+            const I16 offset = hardwareOffsets ? gyro_offset_counts(state.rotationBias[axis]) : 0;
+            const U8 registerAddress = static_cast<U8>(GYRO_OFFSET_REGISTER + (2 * axis));
+            state.registers.set(registerAddress, static_cast<U8>(static_cast<U16>(offset) >> 8));
+            state.registers.set(static_cast<U8>(registerAddress + 1), static_cast<U8>(static_cast<U16>(offset)));
         }
+        state.hardwareOffsets = hardwareOffsets;
+        this->apply_bias(device);
     }
-    // Read gyroscope parameter and configure
+    // Read sample rate divider and filter bandwidth parameters into their registers
     {
-        const GyroscopeRange gyroscopeRange = this->paramGet_GYROSCOPE_RANGE(paramValid);
+        const U8 divider = this->paramGet_SAMPLE_RATE_DIVIDER(paramValid);
+        FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+        const DlpfBandwidth bandwidth = this->paramGet_DLPF_BANDWIDTH(paramValid);
+        FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+        state.registers.set(SAMPLE_RATE_DIVIDER_REGISTER, divider);
+        state.registers.set(DLPF_CONFIG_REGISTER, static_cast<U8>(bandwidth.e));
+        state.samplePeriodUs = sample_period_us(divider, bandwidth);
+    }
+    // Read the delta output period parameter and restart the output interval at the new configuration
+    {
+        const U16 period = this->paramGet_DELTA_OUTPUT_PERIOD(paramValid);
         FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
-        U8 gyro_config_sequence[] = {GYRO_CONFIG_REGISTER, this->gyroscope_range_to_register(gyroscopeRange)};
-        Fw::Buffer writeBuffer(gyro_config_sequence, sizeof(gyro_config_sequence));
+        state.deltaPeriodUs = static_cast<U32>(period) * 1000;
+        state.integrator.reset();
+        state.lastReadValid = false;
+    }
+    // Statistics of the primary device restart at the new ranges and sample rate
+    if (device == 0) {
+        this->m_statistics.reset();
+        this->m_allan.reset();
+        this->m_allanSpacingUs = 0;
+        this->m_allanSpacings = 0;
+    }
+    // The first tick after a configuration starts the register verification interval
+    state.verifyPeriodUs = 0;
+    // Read acquisition mode parameter, then write every register the configuration changed
+    const AcquisitionMode mode = this->paramGet_ACQUISITION_MODE(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    return this->configure_acquisition(device, mode);
+}
+
+Drv::I2cStatus ImuManager ::configure_acquisition(FwIndexType device, AcquisitionMode mode) {
+    Device& state = this->m_devices[device];
+    const bool fifo = (mode == AcquisitionMode::FIFO);
+    const bool interrupt = (mode == AcquisitionMode::INTERRUPT);
+    // Registers of the modes not selected return to their reset values, disabling the FIFO or interrupt
+    state.registers.set(FIFO_ENABLE_REGISTER, fifo ? FIFO_ENABLE_ACCEL_GYRO : 0x00);
+    state.registers.set(USER_CONTROL_REGISTER, fifo ? USER_CONTROL_FIFO_ENABLE : 0x00);
+    state.registers.set(INTERRUPT_PIN_CONFIG_REGISTER, interrupt ? INTERRUPT_PIN_CONFIG_READ_CLEAR : 0x00);
+    state.registers.set(INTERRUPT_ENABLE_REGISTER, interrupt ? INTERRUPT_ENABLE_DATA_READY : 0x00);
+
+    // The FIFO restarts empty at the new configuration, otherwise only the changed registers are written
+    const Drv::I2cStatus status = fifo ? this->reset_fifo(device) : this->write_registers(device);
+    if (status == Drv::I2cStatus::I2C_OK) {
+        state.mode = mode;
+        if (interrupt) {
+            state.lastDataReady = this->getTime();
+        }
+    }
+    return status;
+}
+
+Drv::I2cStatus ImuManager ::reset_fifo(FwIndexType device) {
+    // The FIFO reset only takes effect while the FIFO is disabled, so reset and enable are separate writes. The reset
+    // bit clears itself, leaving the FIFO disabled.
+    Drv::I2cStatus status = this->write_register(device, USER_CONTROL_REGISTER, USER_CONTROL_FIFO_RESET);
+    if (status != Drv::I2cStatus::I2C_OK) {
+        return status;
+    }
+    this->m_devices[device].registers.confirm_value(USER_CONTROL_REGISTER, 0x00);
+    return this->write_registers(device);
+}
+
+Drv::I2cStatus ImuManager ::write_registers(FwIndexType device) {
+    RegisterShadow& registers = this->m_devices[device].registers;
+    U8 first = 0;
+    U32 count = 0;
+    // Each run of adjacent changed registers is one auto-increment transaction, lowest address first
+    for (U32 start = RegisterShadow::FIRST_REGISTER; registers.next_run(start, first, count); start = first + count) {
+        U8 run_sequence[1 + RegisterShadow::MAX_RUN];
+        run_sequence[0] = first;
+        for (U32 i = 0; i < count; i++) {
+            run_sequence[1 + i] = registers.desired(static_cast<U8>(first + i));
+        }
+        Fw::Buffer writeBuffer(run_sequence, 1 + count);
         Fw::Buffer readBuffer;
-        status = this->bus_write(writeBuffer, readBuffer);
+        const Drv::I2cStatus status = this->bus_write(device, writeBuffer, readBuffer);
         if (status != Drv::I2cStatus::I2C_OK) {
+            registers.forget(first, count);
             return status;
         }
+        registers.confirm(first, count);
     }
-    return status;
+    return Drv::I2cStatus::I2C_OK;
+}
+
+Drv::I2cStatus ImuManager ::verify_registers(FwIndexType device) {
+    Device& state = this->m_devices[device];
+    // The whole block is one burst, which clears INT_STATUS (0x3A) within it. Nothing reads INT_STATUS: the unlatched
+    // data-ready line is a pulse that has already fired, and FIFO overflows are found from FIFO_COUNT.
+    U8 block[RegisterShadow::BLOCK_SIZE];
+    U8 registerAddress = RegisterShadow::FIRST_REGISTER;
+    Fw::Buffer writeBuffer(&registerAddress, 1);
+    Fw::Buffer readBuffer(block, sizeof(block));
+    const Drv::I2cStatus status = this->bus_write(device, writeBuffer, readBuffer);
+    if (status != Drv::I2cStatus::I2C_OK) {
+        return status;
+    }
+    U8 first = 0;
+    const U32 differing = state.registers.verify(block, first);
+    if (differing == 0) {
+        return Drv::I2cStatus::I2C_OK;
+    }
+    // A brown-out or a corrupted write changed the configuration, so samples since may be missing or misconverted
+    this->m_registerMismatches++;
+    this->log_WARNING_HI_RegisterMismatch(state.address, first, block[first - RegisterShadow::FIRST_REGISTER],
+                                          state.registers.desired(first), differing);
+    this->tlmWrite_RegisterMismatches(this->m_registerMismatches);
+    state.integrator.reset();
+    state.lastReadValid = false;
+    if (device == 0) {
+        this->m_allan.restart();
+    }
+    // Rewrite only the differing registers, restarting a FIFO that may hold frames of the changed configuration
+    return (state.mode == AcquisitionMode::FIFO) ? this->reset_fifo(device) : this->write_registers(device);
 }
 
-Drv::I2cStatus ImuManager ::read(ImuData& imuData) {
+bool ImuManager ::verify_due(FwIndexType device) {
+    Device& state = this->m_devices[device];
+    const Fw::Time now = this->getTime();
+    const bool started = (state.verifyPeriodUs != 0);
+    if (started && (elapsed_us(state.verifyStart, now) < state.verifyPeriodUs)) {
+        return false;
+    }
+    // Start the next interval, or check again next tick while disabled
+    Fw::ParamValid paramValid;
+    const U16 period = this->paramGet_REGISTER_VERIFY_PERIOD(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    state.verifyPeriodUs = static_cast<U32>(period) * 1000;
+    state.verifyStart = now;
+    return started;
+}
+
+Drv::I2cStatus ImuManager ::write_register(FwIndexType device, U8 registerAddress, U8 value) {
+    U8 register_sequence[] = {registerAddress, value};
+    Fw::Buffer writeBuffer(register_sequence, sizeof(register_sequence));
+    Fw::Buffer readBuffer;
+    return this->bus_write(device, writeBuffer, readBuffer);
+}
+
+Drv::I2cStatus ImuManager ::read(FwIndexType device, ImuData& imuData) {
     U8 data[DATA_LENGTH];
     U8 registerAddress = DATA_BASE_REGISTER;
 
     Fw::Buffer writeBuffer(&registerAddress, 1);
     Fw::Buffer readBuffer(data, DATA_LENGTH);
     // If bus write fails, state machine is reset, so just return
-    Drv::I2cStatus status = this->bus_write(writeBuffer, readBuffer);
+    Drv::I2cStatus status = this->bus_write(device, writeBuffer, readBuffer);
     if (status != Drv::I2cStatus::I2C_OK) {
         return status;
     }
-    RawImuData raw = this->deserialize_raw_data(readBuffer);
+    // The data registers are a single record of the batch converter, which removes the bias
+    F32 acceleration[3];
+    F32 rotation[3];
+    F32 temperature;
+    const ImuBatchArrays arrays = {{&acceleration[0], &acceleration[1], &acceleration[2]},
+                                   {&rotation[0], &rotation[1], &rotation[2]},
+                                   &temperature};
+    this->m_devices[device].converter.convert(data, 1, ImuBatchConverter::REGISTER_RECORD, arrays);
+    imuData.get_acceleration().set_x(acceleration[0]);
+    imuData.get_acceleration().set_y(acceleration[1]);
+    imuData.get_acceleration().set_z(acceleration[2]);
+    imuData.get_rotation().set_x(rotation[0]);
+    imuData.get_rotation().set_y(rotation[1]);
+    imuData.get_rotation().set_z(rotation[2]);
+    imuData.set_temperature(temperature);
+    return status;
+}
 
-    // This code will read the currently scaled parameters
-    Fw::ParamValid paramValid;
-    const AccelerationRange accelerationRange = this->paramGet_ACCELEROMETER_RANGE(paramValid);
-    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
-    const GyroscopeRange gyroscopeRange = this->paramGet_GYROSCOPE_RANGE(paramValid);
-    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+Drv::I2cStatus ImuManager ::read_fifo(FwIndexType device, ImuData& imuData, Fw::Time& time, U32& samples) {
+    samples = 0;
+    U16 count = 0;
+    {
+        U8 countData[sizeof(U16)];
+        U8 registerAddress = FIFO_COUNT_REGISTER;
+        Fw::Buffer writeBuffer(&registerAddress, 1);
+        Fw::Buffer readBuffer(countData, sizeof(countData));
+        Drv::I2cStatus status = this->bus_write(device, writeBuffer, readBuffer);
+        if (status != Drv::I2cStatus::I2C_OK) {
+            return status;
+        }
+        readBuffer.getDeserializer().deserialize(count);
+    }
+    // The newest counted frame was taken within one sample period of the count, earlier frames are a period apart
+    time = this->getTime();
 
-    imuData = this->convert_raw_data(raw, accelerationRange, gyroscopeRange);
-    return status;
+    // A full FIFO has dropped samples and may have overwritten part of a frame, losing the frame alignment
+    if (count >= FIFO_SIZE) {
+        Drv::I2cStatus status = this->reset_fifo(device);
+        // The dropped samples would be missing from the output interval and break the Allan variance sequence
+        this->m_devices[device].integrator.reset();
+        if (device == 0) {
+            this->m_allan.restart();
+        }
+        if (status == Drv::I2cStatus::I2C_OK) {
+            this->m_fifoOverflows++;
+            this->log_WARNING_LO_FifoOverflow(this->m_fifoOverflows);
+            this->tlmWrite_FifoOverflows(this->m_fifoOverflows);
+        }
+        return status;
+    }
+
+    // Drain whole frames only, a frame still being written is left for the next tick
+    const U32 frames = count / FIFO_FRAME_LENGTH;
+    FW_ASSERT(frames <= FIFO_MAX_FRAMES, static_cast<FwAssertArgType>(frames));
+    if (frames == 0) {
+        return Drv::I2cStatus::I2C_OK;
+    }
+    {
+        U8 registerAddress = FIFO_DATA_REGISTER;
+        Fw::Buffer writeBuffer(&registerAddress, 1);
+        Fw::Buffer readBuffer(this->m_fifoBuffer, frames * FIFO_FRAME_LENGTH);
+        Drv::I2cStatus status = this->bus_write(device, writeBuffer, readBuffer);
+        if (status != Drv::I2cStatus::I2C_OK) {
+            return status;
+        }
+    }
+
+    // Temperature is not in the FIFO and changes slowly, so one read covers the whole burst
+    I16 temperature = 0;
+    {
+        U8 temperatureData[TEMPERATURE_LENGTH];
+        U8 registerAddress = TEMPERATURE_REGISTER;
+        Fw::Buffer writeBuffer(&registerAddress, 1);
+        Fw::Buffer readBuffer(temperatureData, sizeof(temperatureData));
+        Drv::I2cStatus status = this->bus_write(device, writeBuffer, readBuffer);
+        if (status != Drv::I2cStatus::I2C_OK) {
+            return status;
+        }
+        readBuffer.getDeserializer().deserialize(temperature);
+    }
+
+    // Unpack, remove the bias, and scale the whole burst at once, then emit it sample by sample
+    const ImuBatchArrays arrays = {
+        {this->m_fifoAcceleration[0], this->m_fifoAcceleration[1], this->m_fifoAcceleration[2]},
+        {this->m_fifoRotation[0], this->m_fifoRotation[1], this->m_fifoRotation[2]},
+        nullptr};
+    this->m_devices[device].converter.convert(this->m_fifoBuffer, frames, ImuBatchConverter::FIFO_RECORD, arrays);
+    imuData.set_temperature(ImuBatchConverter::temperature_from_raw(temperature));
+
+    const bool connected = this->isConnected_dataOut_OutputPort(device);
+    const U32 periodUs = this->m_devices[device].samplePeriodUs;
+    for (U32 i = 0; i < frames; i++) {
+        imuData.get_acceleration().set_x(this->m_fifoAcceleration[0][i]);
+        imuData.get_acceleration().set_y(this->m_fifoAcceleration[1][i]);
+        imuData.get_acceleration().set_z(this->m_fifoAcceleration[2][i]);
+        imuData.get_rotation().set_x(this->m_fifoRotation[0][i]);
+        imuData.get_rotation().set_y(this->m_fifoRotation[1][i]);
+        imuData.get_rotation().set_z(this->m_fifoRotation[2][i]);
+        this->accumulate_bias(device, imuData);
+        this->accumulate_statistics(device, imuData, periodUs);
+        const Fw::Time sampleTime = sample_time(time, (frames - 1 - i) * periodUs);
+        if (connected) {
+            this->dataOut_out(device, sampleTime, imuData);
+        }
+        // FIFO samples are a sample period apart whenever they were drained
+        this->integrate_delta(device, sampleTime, imuData, periodUs);
+    }
+    samples = frames;
+    return Drv::I2cStatus::I2C_OK;
 }
 
 RawImuData ImuManager ::deserialize_raw_data(Fw::Buffer& buffer) {
@@ -102,21 +339,149 @@ RawImuData ImuManager ::deserialize_raw_data(Fw::Buffer& buffer) {
 ImuData ImuManager ::convert_raw_data(const RawImuData& raw,
                                       const AccelerationRange& accelerationRange,
                                       const GyroscopeRange& gyroscopeRange) {
-    // Set the values of the IMU data by multiplying by conversion factors
+    // Set the values of the IMU data by multiplying by conversion factors, the same operations as the batch converter
+    const F32 accelerationScale = ImuBatchConverter::acceleration_scale(accelerationRange);
+    const F32 rotationScale = ImuBatchConverter::rotation_scale(gyroscopeRange);
     MpuImu::ImuData imuData;
-    imuData.get_acceleration().set_x(static_cast<F32>(raw.acceleration[0]) * 1.0f /
-                                     static_cast<F32>(accelerationRange));
-    imuData.get_acceleration().set_y(static_cast<F32>(raw.acceleration[1]) * 1.0f /
-                                     static_cast<F32>(accelerationRange));
-    imuData.get_acceleration().set_z(static_cast<F32>(raw.acceleration[2]) * 1.0f /
-                                     static_cast<F32>(accelerationRange));
-    imuData.set_temperature((static_cast<F32>(raw.temperature) / TEMPERATURE_SCALAR) + TEMPERATURE_OFFSET);
-    imuData.get_rotation().set_x(static_cast<F32>(raw.gyroscope[0]) * 10.0f / static_cast<F32>(gyroscopeRange));
-    imuData.get_rotation().set_y(static_cast<F32>(raw.gyroscope[1]) * 10.0f / static_cast<F32>(gyroscopeRange));
-    imuData.get_rotation().set_z(static_cast<F32>(raw.gyroscope[2]) * 10.0f / static_cast<F32>(gyroscopeRange));
+    imuData.get_acceleration().set_x(static_cast<F32>(raw.acceleration[0]) * accelerationScale);
+    imuData.get_acceleration().set_y(static_cast<F32>(raw.acceleration[1]) * accelerationScale);
+    imuData.get_acceleration().set_z(static_cast<F32>(raw.acceleration[2]) * accelerationScale);
+    imuData.set_temperature(ImuBatchConverter::temperature_from_raw(raw.temperature));
+    imuData.get_rotation().set_x(static_cast<F32>(raw.gyroscope[0]) * rotationScale);
+    imuData.get_rotation().set_y(static_cast<F32>(raw.gyroscope[1]) * rotationScale);
+    imuData.get_rotation().set_z(static_cast<F32>(raw.gyroscope[2]) * rotationScale);
     return imuData;
 }
 
+U32 ImuManager ::sample_period_us(U8 divider, DlpfBandwidth bandwidth) {
+    const U32 outputPeriod =
+        (bandwidth == DlpfBandwidth::BANDWIDTH_260HZ) ? GYRO_OUTPUT_PERIOD_DLPF_OFF_US : GYRO_OUTPUT_PERIOD_DLPF_ON_US;
+    return outputPeriod * (static_cast<U32>(divider) + 1);
+}
+
+Fw::Time ImuManager ::sample_time(const Fw::Time& newest, U32 ageUs) {
+    const U64 newestUs = (static_cast<U64>(newest.getSeconds()) * 1000000) + newest.getUSeconds();
+    const U64 sampleUs = (newestUs > ageUs) ? (newestUs - ageUs) : 0;
+    return Fw::Time(newest.getTimeBase(), newest.getContext(), static_cast<U32>(sampleUs / 1000000),
+                    static_cast<U32>(sampleUs % 1000000));
+}
+
+void ImuManager ::integrate_delta(FwIndexType device, const Fw::Time& time, const ImuData& imuData, U32 periodUs) {
+    Device& state = this->m_devices[device];
+    if (state.deltaPeriodUs == 0) {
+        return;
+    }
+    // A long gap holds a stale sample over time it does not describe, start again from the next. Reads come a tick or
+    // a sample period apart, and one delivered late by scheduling jitter is still integrated.
+    const U32 sampleGapUs = DELTA_GAP_PERIODS * state.samplePeriodUs;
+    const U32 maxGapUs = (sampleGapUs > DELTA_MAX_GAP_US) ? sampleGapUs : DELTA_MAX_GAP_US;
+    if ((periodUs == 0) || (periodUs > maxGapUs)) {
+        state.integrator.reset();
+        return;
+    }
+    const F32 rotation[3] = {imuData.get_rotation().get_x(), imuData.get_rotation().get_y(),
+                             imuData.get_rotation().get_z()};
+    const F32 acceleration[3] = {imuData.get_acceleration().get_x(), imuData.get_acceleration().get_y(),
+                                 imuData.get_acceleration().get_z()};
+    state.integrator.add(rotation, acceleration, periodUs);
+    if (state.integrator.duration_us() < state.deltaPeriodUs) {
+        return;
+    }
+    F32 angle[3];
+    F32 velocity[3];
+    state.integrator.delta_angle(angle);
+    state.integrator.delta_velocity(velocity);
+    state.delta = ImuDelta(FprimeSensors::GeometricVector3(angle[0], angle[1], angle[2]),
+                           FprimeSensors::GeometricVector3(velocity[0], velocity[1], velocity[2]),
+                           state.integrator.duration_us(), state.integrator.samples());
+    state.deltaTime = time;
+    state.deltaFresh = true;
+    state.integrator.next_interval();
+    if (this->isConnected_deltaOut_OutputPort(device)) {
+        this->deltaOut_out(device, time, state.delta);
+    }
+}
+
+U32 ImuManager ::data_ready_timeout_us(FwIndexType device) const {
+    const U64 timeout = static_cast<U64>(this->m_devices[device].samplePeriodUs) * DATA_READY_TIMEOUT_PERIODS;
+    return (timeout < DATA_READY_TIMEOUT_MIN_US) ? DATA_READY_TIMEOUT_MIN_US : static_cast<U32>(timeout);
+}
+
+ImuData ImuManager ::vote_median(const ImuData* samples, FwIndexType count) {
+    FW_ASSERT((count > 0) && (count <= MAX_DEVICES), static_cast<FwAssertArgType>(count));
+    F32 channels[7][MAX_DEVICES];
+    for (FwIndexType i = 0; i < count; i++) {
+        channels[0][i] = samples[i].get_acceleration().get_x();
+        channels[1][i] = samples[i].get_acceleration().get_y();
+        channels[2][i] = samples[i].get_acceleration().get_z();
+        channels[3][i] = samples[i].get_rotation().get_x();
+        channels[4][i] = samples[i].get_rotation().get_y();
+        channels[5][i] = samples[i].get_rotation().get_z();
+        channels[6][i] = samples[i].get_temperature();
+    }
+    F32 medians[7];
+    for (U32 channel = 0; channel < 7; channel++) {
+        // Insertion sort, there are only a handful of devices
+        F32* values = channels[channel];
+        for (FwIndexType i = 1; i < count; i++) {
+            const F32 value = values[i];
+            FwIndexType j = i;
+            for (; (j > 0) && (values[j - 1] > value); j--) {
+                values[j] = values[j - 1];
+            }
+            values[j] = value;
+        }
+        const FwIndexType middle = count / 2;
+        medians[channel] = ((count % 2) == 1) ? values[middle] : ((values[middle - 1] + values[middle]) * 0.5f);
+    }
+    ImuData voted;
+    voted.get_acceleration().set_x(medians[0]);
+    voted.get_acceleration().set_y(medians[1]);
+    voted.get_acceleration().set_z(medians[2]);
+    voted.get_rotation().set_x(medians[3]);
+    voted.get_rotation().set_y(medians[4]);
+    voted.get_rotation().set_z(medians[5]);
+    voted.set_temperature(medians[6]);
+    return voted;
+}
+
+void ImuManager ::vote_errors(const ImuData* samples,
+                              FwIndexType count,
+                              const ImuData& voted,
+                              F32& accelerationError,
+                              F32& rotationError) {
+    accelerationError = 0.0f;
+    rotationError = 0.0f;
+    for (FwIndexType i = 0; i < count; i++) {
+        const F32 acceleration[3] = {samples[i].get_acceleration().get_x() - voted.get_acceleration().get_x(),
+                                     samples[i].get_acceleration().get_y() - voted.get_acceleration().get_y(),
+                                     samples[i].get_acceleration().get_z() - voted.get_acceleration().get_z()};
+        const F32 rotation[3] = {samples[i].get_rotation().get_x() - voted.get_rotation().get_x(),
+                                 samples[i].get_rotation().get_y() - voted.get_rotation().get_y(),
+                                 samples[i].get_rotation().get_z() - voted.get_rotation().get_z()};
+        for (U32 axis = 0; axis < 3; axis++) {
+            accelerationError = std::max(accelerationError, std::fabs(acceleration[axis]));
+            rotationError = std::max(rotationError, std::fabs(rotation[axis]));
+        }
+    }
+}
+
+FwIndexType ImuManager ::device_index(SmId smId) {
+    FwIndexType device = 0;
+    switch (smId) {
+        case SmId::imuStateMachine:
+            device = 0;
+            break;
+        case SmId::secondaryImuStateMachine:
+            device = 1;
+            break;
+        default:
+            FW_ASSERT(0, static_cast<FwAssertArgType>(smId));
+            break;
+    }
+    return device;
+}
+
 U8 ImuManager ::accelerometer_range_to_register(AccelerationRange range) {
     U8 registerValue = 0;
     switch (range.e) {
@@ -12,12 +12,59 @@ namespace MpuImu {
 // Component construction and destruction
 // ----------------------------------------------------------------------
 
-ImuManager ::ImuManager(const char* const compName) : ImuManagerComponentBase(compName), m_address(DEVICE_DEFAULT_ADDRESS) {}
+ImuManager ::ImuManager(const char* const compName)
+    : ImuManagerComponentBase(compName),
+      m_fifoOverflows(0),
+      m_voteDisagreements(0),
+      m_registerMismatches(0),
+      m_queueHighWaterMark(0),
+      m_synchronousRead(false),
+      m_biasActive(false),
+      m_biasOpCode(0),
+      m_biasCmdSeq(0),
+      m_biasDurationUs(0),
+      m_biasFileEnabled(false),
+      m_biasFileLoaded(false),
+      m_allanEnabled(false),
+      m_allanSpacingUs(0),
+      m_allanSpacings(0),
+      m_statisticsWindowUs(0) {
+    for (FwIndexType device = 0; device < MAX_DEVICES; device++) {
+        this->m_devices[device].address = (device == 0) ? DEVICE_DEFAULT_ADDRESS : DEVICE_SECONDARY_ADDRESS;
+        this->m_devices[device].managed = (device == 0);
+        this->m_devices[device].samplePeriodUs = GYRO_OUTPUT_PERIOD_DLPF_OFF_US;
+        this->m_devices[device].mode = AcquisitionMode::REGISTER;
+        this->m_devices[device].fresh = false;
+        for (U32 axis = 0; axis < 3; axis++) {
+            this->m_devices[device].accelerationBias[axis] = 0.0f;
+            this->m_devices[device].rotationBias[axis] = 0.0f;
+        }
+        this->m_devices[device].biasValid = false;
+        this->m_devices[device].hardwareOffsets = false;
+        this->m_devices[device].deltaPeriodUs = 0;
+        this->m_devices[device].lastReadValid = false;
+        this->m_devices[device].deltaFresh = false;
+        this->m_devices[device].verifyPeriodUs = 0;
+    }
+}
 
 ImuManager ::~ImuManager() {}
 
-void ImuManager ::configure(U8 device_address) {
-    this->m_address = device_address;
+void ImuManager ::configure(U8 device_address, const char* biasFilePath) {
+    this->m_devices[0].address = device_address;
+    // Biases are read on the first run such that load failures can be reported
+    this->m_biasFileEnabled = (biasFilePath != nullptr);
+    this->m_biasFileLoaded = false;
+    if (this->m_biasFileEnabled) {
+        this->m_biasPath = biasFilePath;
+    }
+}
+
+void ImuManager ::configure(U8 primary_address, U8 secondary_address, const char* biasFilePath) {
+    FW_ASSERT(primary_address != secondary_address, static_cast<FwAssertArgType>(primary_address));
+    this->configure(primary_address, biasFilePath);
+    this->m_devices[1].address = secondary_address;
+    this->m_devices[1].managed = true;
 }
 
 void ImuManager ::parameterUpdated(FwPrmIdType id) {
@@ -29,7 +76,7 @@ void ImuManager ::parameterUpdated(FwPrmIdType id) {
             // NOTE: isValid is always VALID in parameterUpdated as it was just properly set
             FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
             this->log_ACTIVITY_HI_AccelerometerRangeUpdated(range);
-            this->imuStateMachine_sendSignal_reconfigure();
+            this->send_signal_all(MpuImu_ImuStateMachine::Signal::reconfigure);
             break;
         }
         case PARAMID_GYROSCOPE_RANGE: {
@@ -38,7 +85,77 @@ void ImuManager ::parameterUpdated(FwPrmIdType id) {
             // NOTE: isValid is always VALID in parameterUpdated as it was just properly set
             FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
             this->log_ACTIVITY_HI_GyroscopeRangeUpdated(range);
-            this->imuStateMachine_sendSignal_reconfigure();
+            this->send_signal_all(MpuImu_ImuStateMachine::Signal::reconfigure);
+            break;
+        }
+        case PARAMID_ACQUISITION_MODE: {
+            // Read back the parameter value
+            const AcquisitionMode mode = this->paramGet_ACQUISITION_MODE(isValid);
+            // NOTE: isValid is always VALID in parameterUpdated as it was just properly set
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_AcquisitionModeUpdated(mode);
+            this->send_signal_all(MpuImu_ImuStateMachine::Signal::reconfigure);
+            break;
+        }
+        case PARAMID_SAMPLE_RATE_DIVIDER: {
+            // Read back the parameter value
+            const U8 divider = this->paramGet_SAMPLE_RATE_DIVIDER(isValid);
+            // NOTE: isValid is always VALID in parameterUpdated as it was just properly set
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_SampleRateDividerUpdated(divider);
+            this->send_signal_all(MpuImu_ImuStateMachine::Signal::reconfigure);
+            break;
+        }
+        case PARAMID_DLPF_BANDWIDTH: {
+            // Read back the parameter value
+            const DlpfBandwidth bandwidth = this->paramGet_DLPF_BANDWIDTH(isValid);
+            // NOTE: isValid is always VALID in parameterUpdated as it was just properly set
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_DlpfBandwidthUpdated(bandwidth);
+            this->send_signal_all(MpuImu_ImuStateMachine::Signal::reconfigure);
+            break;
+        }
+        case PARAMID_BIAS_HARDWARE_OFFSETS: {
+            // Read back the parameter value
+            const bool enabled = this->paramGet_BIAS_HARDWARE_OFFSETS(isValid);
+            // NOTE: isValid is always VALID in parameterUpdated as it was just properly set
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_BiasHardwareOffsetsUpdated(enabled);
+            this->send_signal_all(MpuImu_ImuStateMachine::Signal::reconfigure);
+            break;
+        }
+        case PARAMID_DELTA_OUTPUT_PERIOD: {
+            // Read back the parameter value
+            const U16 period = this->paramGet_DELTA_OUTPUT_PERIOD(isValid);
+            // NOTE: isValid is always VALID in parameterUpdated as it was just properly set
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_DeltaOutputPeriodUpdated(period);
+            this->send_signal_all(MpuImu_ImuStateMachine::Signal::reconfigure);
+            break;
+        }
+        case PARAMID_VOTE_ACCELERATION_TOLERANCE:
+        case PARAMID_VOTE_ROTATION_TOLERANCE:
+        case PARAMID_BIAS_ACCELERATION_NOISE_LIMIT:
+        case PARAMID_BIAS_ROTATION_NOISE_LIMIT:
+            // Read each time they are used, nothing to reconfigure
+            break;
+        case PARAMID_STATISTICS_WINDOW:
+        case PARAMID_ALLAN_ENABLED:
+        case PARAMID_ALLAN_DECIMATION:
+            // Read at the start of each statistics window
+            break;
+        case PARAMID_REGISTER_VERIFY_PERIOD:
+            // Read at the start of each register verification interval
+            break;
+        case PARAMID_SYNCHRONOUS_READ: {
+            // Kept in a member rather than read back on each tick and data-ready interrupt. Set on the caller's
+            // thread, so it is written under the guard that run and dataReady read it under.
+            const bool synchronousRead = this->paramGet_SYNCHRONOUS_READ(isValid);
+            // NOTE: isValid is always VALID in parameterUpdated as it was just properly set
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->lock();
+            this->m_synchronousRead = synchronousRead;
+            this->unLock();
             break;
         }
         default:
@@ -47,12 +164,49 @@ void ImuManager ::parameterUpdated(FwPrmIdType id) {
     }
 }
 
+void ImuManager ::parametersLoaded() {
+    Fw::ParamValid isValid = Fw::ParamValid::INVALID;
+    const bool synchronousRead = this->paramGet_SYNCHRONOUS_READ(isValid);
+    FW_ASSERT(isValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(isValid));
+    this->lock();
+    this->m_synchronousRead = synchronousRead;
+    this->unLock();
+}
+
 // ----------------------------------------------------------------------
 // Handler implementations for typed input ports
 // ----------------------------------------------------------------------
 
 void ImuManager ::run_handler(FwIndexType portNum, U32 context) {
-    this->imuStateMachine_sendSignal_tick();
+    // Stored biases are applied before the devices are first configured
+    if (this->m_biasFileEnabled && !this->m_biasFileLoaded) {
+        this->m_biasFileLoaded = true;
+        this->load_bias_file();
+    }
+    // Every device is ticked before dispatching, so their reads are interleaved within the tick
+    for (FwIndexType device = 0; device < MAX_DEVICES; device++) {
+        if (this->m_devices[device].managed) {
+            this->deliver_signal(device, MpuImu_ImuStateMachine::Signal::tick, this->m_synchronousRead);
+        }
+    }
+    this->dispatchCurrentMessages();
+    if (this->m_biasActive && (elapsed_us(this->m_biasStart, this->getTime()) >= this->m_biasDurationUs)) {
+        this->finish_bias_calibration();
+    }
+    this->update_statistics();
+    if (this->m_devices[1].managed) {
+        this->vote();
+    }
+    this->update_queue_high_water_mark();
+}
+
+void ImuManager ::dataReady_handler(FwIndexType portNum, Os::RawTime& cycleStart) {
+    FW_ASSERT((portNum >= 0) && (portNum < MAX_DEVICES), static_cast<FwAssertArgType>(portNum));
+    if (!this->m_devices[portNum].managed) {
+        return;
+    }
+    // Dispatch immediately rather than on the next tick, the port is guarded against run
+    this->deliver_signal(portNum, MpuImu_ImuStateMachine::Signal::dataReady, this->m_synchronousRead);
     this->dispatchCurrentMessages();
 }
 
@@ -61,92 +215,316 @@ void ImuManager ::run_handler(FwIndexType portNum, U32 context) {
 // ----------------------------------------------------------------------
 
 void ImuManager ::RESET_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
-    // Reuse error call to force a reset
-    this->imuStateMachine_sendSignal_error();
+    // Reuse error call to force a reset of every device
+    this->send_signal_all(MpuImu_ImuStateMachine::Signal::error);
     this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
 }
 
+void ImuManager ::CALIBRATE_BIAS_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, U32 duration) {
+    if ((duration == 0) || (duration > BIAS_MAX_DURATION_MS)) {
+        this->log_WARNING_LO_BiasCalibrationInvalid(duration);
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+        return;
+    }
+    if (this->m_biasActive) {
+        this->log_WARNING_LO_BiasCalibrationBusy();
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::BUSY);
+        return;
+    }
+    for (FwIndexType device = 0; device < MAX_DEVICES; device++) {
+        this->m_devices[device].estimator.reset();
+    }
+    // The command completes when the window closes, on the first tick after it has elapsed
+    this->m_biasOpCode = opCode;
+    this->m_biasCmdSeq = cmdSeq;
+    this->m_biasStart = this->getTime();
+    this->m_biasDurationUs = duration * 1000;
+    this->m_biasActive = true;
+    this->log_ACTIVITY_HI_BiasCalibrationStarted(duration);
+}
+
 // ----------------------------------------------------------------------
 // Implementations for internal state machine actions
 // ----------------------------------------------------------------------
 
 void ImuManager ::MpuImu_ImuStateMachine_action_doReset(SmId smId, MpuImu_ImuStateMachine::Signal signal) {
-    // This function is implemented only for the specific instance "imuStateMachine"
-    FW_ASSERT(smId == SmId::imuStateMachine);
-    Drv::I2cStatus status = this->reset();
+    const FwIndexType device = device_index(smId);
+    Drv::I2cStatus status = this->reset(device);
     // Transition to RESET state on failure
     if (status != Drv::I2cStatus::I2C_OK) {
-        this->log_WARNING_HI_I2cError(this->m_address, status);
-        this->imuStateMachine_sendSignal_error();
+        this->log_WARNING_HI_I2cError(this->m_devices[device].address, status);
+        this->send_signal(device, MpuImu_ImuStateMachine::Signal::error);
     } else {
-        this->imuStateMachine_sendSignal_success();
+        // The reset returns every register to its reset value, disabling the FIFO and interrupts and clearing the
+        // gyroscope offsets
+        this->m_devices[device].registers.reset();
+        this->m_devices[device].mode = AcquisitionMode::REGISTER;
+        this->m_devices[device].hardwareOffsets = false;
+        // Samples lost across the reset would be missing from the output interval
+        this->m_devices[device].integrator.reset();
+        this->m_devices[device].lastReadValid = false;
+        if (device == 0) {
+            this->m_allan.restart();
+        }
+        this->send_signal(device, MpuImu_ImuStateMachine::Signal::success);
     }
 }
 
 void ImuManager ::MpuImu_ImuStateMachine_action_checkReset(SmId smId, MpuImu_ImuStateMachine::Signal signal) {
-    // This function is implemented only for the specific instance "imuStateMachine"
-    FW_ASSERT(smId == SmId::imuStateMachine);
+    const FwIndexType device = device_index(smId);
     U8 reset_val = 0;
-    Drv::I2cStatus status = this->read_reset(reset_val);
+    Drv::I2cStatus status = this->read_reset(device, reset_val);
     // When reset is complete, the reset bit will be 0
     if ((status != Drv::I2cStatus::I2C_OK)) {
-        this->log_WARNING_HI_I2cError(this->m_address, status);
-        this->imuStateMachine_sendSignal_error();
+        this->log_WARNING_HI_I2cError(this->m_devices[device].address, status);
+        this->send_signal(device, MpuImu_ImuStateMachine::Signal::error);
     } else if ((reset_val & RESET_VALUE) == 0) {
-        this->imuStateMachine_sendSignal_success();
+        this->send_signal(device, MpuImu_ImuStateMachine::Signal::success);
     }
 }
 
 void ImuManager ::MpuImu_ImuStateMachine_action_doEnable(SmId smId, MpuImu_ImuStateMachine::Signal signal) {
-    // This function is implemented only for the specific instance "imuStateMachine"
-    FW_ASSERT(smId == SmId::imuStateMachine);
-    Drv::I2cStatus status = this->enable();
+    const FwIndexType device = device_index(smId);
+    Drv::I2cStatus status = this->enable(device);
     if (status != Drv::I2cStatus::I2C_OK) {
-        this->log_WARNING_HI_I2cError(this->m_address, status);
-        this->imuStateMachine_sendSignal_error();
+        this->log_WARNING_HI_I2cError(this->m_devices[device].address, status);
+        this->send_signal(device, MpuImu_ImuStateMachine::Signal::error);
     } else {
-        this->imuStateMachine_sendSignal_success();
+        this->send_signal(device, MpuImu_ImuStateMachine::Signal::success);
     }
 }
 
 void ImuManager ::MpuImu_ImuStateMachine_action_doConfigure(SmId smId, MpuImu_ImuStateMachine::Signal signal) {
-    // This function is implemented only for the specific instance "imuStateMachine"
-    FW_ASSERT(smId == SmId::imuStateMachine);
-    Drv::I2cStatus status = this->configure_device();
+    const FwIndexType device = device_index(smId);
+    Drv::I2cStatus status = this->configure_device(device);
     if (status != Drv::I2cStatus::I2C_OK) {
-        this->log_WARNING_HI_I2cError(this->m_address, status);
-        this->imuStateMachine_sendSignal_error();
+        this->log_WARNING_HI_I2cError(this->m_devices[device].address, status);
+        this->send_signal(device, MpuImu_ImuStateMachine::Signal::error);
     } else {
-        this->imuStateMachine_sendSignal_success();
+        // Both devices share the sample rate parameters, the channel reports the primary like Reading
+        if (device == 0) {
+            this->tlmWrite_SampleRate(1.0e6f / static_cast<F32>(this->m_devices[device].samplePeriodUs));
+        }
+        this->send_signal(device, MpuImu_ImuStateMachine::Signal::success);
     }
 }
 
 void ImuManager ::MpuImu_ImuStateMachine_action_doRead(SmId smId, MpuImu_ImuStateMachine::Signal signal) {
-    // This function is implemented only for the specific instance "imuStateMachine"
-    FW_ASSERT(smId == SmId::imuStateMachine);
+    this->read_device(device_index(smId), signal);
+}
+
+void ImuManager ::read_device(FwIndexType device, MpuImu_ImuStateMachine::Signal signal) {
+    Device& state = this->m_devices[device];
     ImuData imuData;
-    Drv::I2cStatus status = this->read(imuData);
-    if (status != Drv::I2cStatus::I2C_OK) {
-        this->log_WARNING_HI_I2cError(this->m_address, status);
-        this->imuStateMachine_sendSignal_error();
+    // The configuration registers are read back once per verification interval, ahead of that tick's read
+    if ((signal == MpuImu_ImuStateMachine::Signal::tick) && this->verify_due(device)) {
+        Drv::I2cStatus status = this->verify_registers(device);
+        if (status != Drv::I2cStatus::I2C_OK) {
+            this->log_WARNING_HI_I2cError(state.address, status);
+            this->send_signal(device, MpuImu_ImuStateMachine::Signal::error);
+            return;
+        }
+    }
+    if (state.mode == AcquisitionMode::INTERRUPT) {
+        const Fw::Time now = this->getTime();
+        if (signal == MpuImu_ImuStateMachine::Signal::tick) {
+            // Samples are read on data-ready interrupts, the tick only checks they are still arriving
+            const U32 elapsed = elapsed_us(state.lastDataReady, now);
+            if (elapsed > this->data_ready_timeout_us(device)) {
+                this->log_WARNING_HI_DataReadyTimeout(elapsed / 1000);
+                this->send_signal(device, MpuImu_ImuStateMachine::Signal::error);
+            }
+            return;
+        }
+        state.lastDataReady = now;
+    } else if (signal == MpuImu_ImuStateMachine::Signal::dataReady) {
+        // Interrupts are only enabled in INTERRUPT mode, an edge raised before leaving it is ignored
+        return;
+    }
+    Fw::Time time;
+    if (state.mode == AcquisitionMode::FIFO) {
+        U32 samples = 0;
+        Drv::I2cStatus status = this->read_fifo(device, imuData, time, samples);
+        if (status != Drv::I2cStatus::I2C_OK) {
+            this->log_WARNING_HI_I2cError(state.address, status);
+            this->send_signal(device, MpuImu_ImuStateMachine::Signal::error);
+            return;
+        }
+        if (device == 0) {
+            this->tlmWrite_FifoSamples(samples);
+        }
+        if (samples == 0) {
+            return;
+        }
     } else {
-        this->tlmWrite_Reading(imuData);
+        time = this->getTime();
+        Drv::I2cStatus status = this->read(device, imuData);
+        if (status != Drv::I2cStatus::I2C_OK) {
+            this->log_WARNING_HI_I2cError(state.address, status);
+            this->send_signal(device, MpuImu_ImuStateMachine::Signal::error);
+            return;
+        }
+        // An interrupt signals each sample, a register read covers the time since the previous read
+        U32 periodUs = state.samplePeriodUs;
+        if (state.mode == AcquisitionMode::REGISTER) {
+            periodUs = state.lastReadValid ? elapsed_us(state.lastRead, time) : 0;
+            state.lastRead = time;
+            state.lastReadValid = true;
+        }
+        this->accumulate_bias(device, imuData);
+        this->accumulate_statistics(device, imuData, periodUs);
+        if (this->isConnected_dataOut_OutputPort(device)) {
+            this->dataOut_out(device, time, imuData);
+        }
+        this->integrate_delta(device, time, imuData, periodUs);
     }
+    state.sample = imuData;
+    state.fresh = true;
+    if (device == 0) {
+        this->tlmWrite_Reading(imuData, time);
+        if (state.deltaFresh) {
+            this->tlmWrite_DeltaIncrement(state.delta, state.deltaTime);
+        }
+    } else {
+        this->tlmWrite_SecondaryReading(imuData, time);
+    }
+    state.deltaFresh = false;
 }
 
 // ----------------------------------------------------------------------
 // Implementations for outgoing port calls
 // ----------------------------------------------------------------------
 
-Drv::I2cStatus ImuManager ::bus_write(Fw::Buffer& writeBuffer, Fw::Buffer& readBuffer) {
+Drv::I2cStatus ImuManager ::bus_write(FwIndexType device, Fw::Buffer& writeBuffer, Fw::Buffer& readBuffer) {
     Drv::I2cStatus status;
     FW_ASSERT(writeBuffer.isValid());
+    FW_ASSERT((device >= 0) && (device < MAX_DEVICES), static_cast<FwAssertArgType>(device));
+    const U8 address = this->m_devices[device].address;
     if (readBuffer.isValid()) {
-        status = this->busWriteRead_out(0, this->m_address, writeBuffer, readBuffer);
+        status = this->busWriteRead_out(0, address, writeBuffer, readBuffer);
     } else {
-        status = this->busWrite_out(0, this->m_address, writeBuffer);
+        status = this->busWrite_out(0, address, writeBuffer);
     }
     return status;
 }
 
+void ImuManager ::send_signal(FwIndexType device, MpuImu_ImuStateMachine::Signal signal) {
+    FW_ASSERT((device >= 0) && (device < MAX_DEVICES), static_cast<FwAssertArgType>(device));
+    const bool primary = (device == 0);
+    switch (signal) {
+        case MpuImu_ImuStateMachine::Signal::tick:
+            if (primary) {
+                this->imuStateMachine_sendSignal_tick();
+            } else {
+                this->secondaryImuStateMachine_sendSignal_tick();
+            }
+            break;
+        case MpuImu_ImuStateMachine::Signal::reconfigure:
+            if (primary) {
+                this->imuStateMachine_sendSignal_reconfigure();
+            } else {
+                this->secondaryImuStateMachine_sendSignal_reconfigure();
+            }
+            break;
+        case MpuImu_ImuStateMachine::Signal::dataReady:
+            if (primary) {
+                this->imuStateMachine_sendSignal_dataReady();
+            } else {
+                this->secondaryImuStateMachine_sendSignal_dataReady();
+            }
+            break;
+        case MpuImu_ImuStateMachine::Signal::success:
+            if (primary) {
+                this->imuStateMachine_sendSignal_success();
+            } else {
+                this->secondaryImuStateMachine_sendSignal_success();
+            }
+            break;
+        case MpuImu_ImuStateMachine::Signal::error:
+            if (primary) {
+                this->imuStateMachine_sendSignal_error();
+            } else {
+                this->secondaryImuStateMachine_sendSignal_error();
+            }
+            break;
+        default:
+            FW_ASSERT(0, static_cast<FwAssertArgType>(signal));
+            break;
+    }
+}
+
+void ImuManager ::send_signal_all(MpuImu_ImuStateMachine::Signal signal) {
+    for (FwIndexType device = 0; device < MAX_DEVICES; device++) {
+        if (this->m_devices[device].managed) {
+            this->send_signal(device, signal);
+        }
+    }
+}
+
+void ImuManager ::deliver_signal(FwIndexType device, MpuImu_ImuStateMachine::Signal signal, bool synchronous) {
+    if (synchronous) {
+        // Transitions and commands queued earlier are taken first, so the read sees the state they leave the device in
+        this->dispatchCurrentMessages();
+        const MpuImu_ImuStateMachine::State current =
+            (device == 0) ? this->imuStateMachine_getState() : this->secondaryImuStateMachine_getState();
+        // A signal posted while dispatching stays ahead of the read in the queue
+        if ((current == MpuImu_ImuStateMachine::State::RUN) && (this->m_queue.getMessagesAvailable() == 0)) {
+            this->read_device(device, signal);
+            return;
+        }
+    }
+    this->send_signal(device, signal);
+}
+
+void ImuManager ::update_queue_high_water_mark() {
+    const FwSizeType highWaterMark = this->m_queue.getMessageHighWaterMark();
+    if (highWaterMark > this->m_queueHighWaterMark) {
+        this->m_queueHighWaterMark = highWaterMark;
+        this->tlmWrite_QueueHighWaterMark(static_cast<U32>(highWaterMark));
+    }
+}
+
+void ImuManager ::vote() {
+    ImuData samples[MAX_DEVICES];
+    FwIndexType count = 0;
+    for (FwIndexType device = 0; device < MAX_DEVICES; device++) {
+        Device& state = this->m_devices[device];
+        if (state.managed && state.fresh) {
+            samples[count++] = state.sample;
+            state.fresh = false;
+        }
+    }
+    // A device that is resetting, or has stopped producing samples, drops out of the vote
+    if (count == 0) {
+        this->tlmWrite_VoteStatus(ImuVoteStatus::NO_DATA);
+        return;
+    }
+    const Fw::Time time = this->getTime();
+    const ImuData voted = vote_median(samples, count);
+    ImuVoteStatus status = ImuVoteStatus::SINGLE;
+    if (count > 1) {
+        Fw::ParamValid paramValid;
+        const F32 accelerationTolerance = this->paramGet_VOTE_ACCELERATION_TOLERANCE(paramValid);
+        FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+        const F32 rotationTolerance = this->paramGet_VOTE_ROTATION_TOLERANCE(paramValid);
+        FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+        F32 accelerationError = 0.0f;
+        F32 rotationError = 0.0f;
+        vote_errors(samples, count, voted, accelerationError, rotationError);
+        status = ImuVoteStatus::CONSISTENT;
+        if ((accelerationError > accelerationTolerance) || (rotationError > rotationTolerance)) {
+            status = ImuVoteStatus::DISAGREE;
+            this->m_voteDisagreements++;
+            this->log_WARNING_HI_VoteDisagreement(accelerationError, rotationError);
+            this->tlmWrite_VoteDisagreements(this->m_voteDisagreements);
+        }
+    }
+    // With two devices the median cannot outvote a faulty one, so a disagreement emits nothing
+    if ((status != ImuVoteStatus::DISAGREE) && this->isConnected_votedOut_OutputPort(0)) {
+        this->votedOut_out(0, time, voted);
+    }
+    this->tlmWrite_VotedReading(voted, time);
+    this->tlmWrite_VoteStatus(status);
+}
+
 }  // namespace MpuImu
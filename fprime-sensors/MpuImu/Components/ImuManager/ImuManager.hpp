@@ -7,8 +7,16 @@
 #ifndef MpuImu_ImuManager_HPP
 #define MpuImu_ImuManager_HPP
 
+#include "Fw/Types/FileNameString.hpp"
+#include "fprime-sensors/MpuImu/Components/ImuManager/AllanVariance.hpp"
+#include "fprime-sensors/MpuImu/Components/ImuManager/BiasEstimator.hpp"
+#include "fprime-sensors/MpuImu/Components/ImuManager/DeltaIntegrator.hpp"
+#include "fprime-sensors/MpuImu/Components/ImuManager/ImuBatchConverter.hpp"
 #include "fprime-sensors/MpuImu/Components/ImuManager/ImuManagerComponentAc.hpp"
 #include "fprime-sensors/MpuImu/Components/ImuManager/ImuTypes.hpp"
+#include "fprime-sensors/MpuImu/Components/ImuManager/RegisterShadow.hpp"
+#include "fprime-sensors/MpuImu/Components/ImuManager/WindowStatistics.hpp"
+#include "fprime-sensors/MpuImu/Types/ElapsedTime.hpp"
 
 namespace MpuImu {
 
@@ -26,8 +34,18 @@ class ImuManager final : public ImuManagerComponentBase {
     //! Destroy ImuManager object
     ~ImuManager();
 
-    //! Configure the device address
-    void configure(U8 device_address=DEVICE_DEFAULT_ADDRESS);
+    //! Configure the device address, managing a single device
+    //!
+    //! When biasFilePath is supplied, calibrated biases are persisted to that file and restored on the first run.
+    void configure(U8 device_address = DEVICE_DEFAULT_ADDRESS,
+                   const char* biasFilePath = nullptr  //!< Bias file, nullptr to keep biases in memory only
+    );
+
+    //! Configure the addresses of two devices on the same bus, managing both and voting between their readings
+    void configure(U8 primary_address,
+                   U8 secondary_address,
+                   const char* biasFilePath = nullptr  //!< Bias file, nullptr to keep biases in memory only
+    );
 
   private:
     // ----------------------------------------------------------------------
@@ -39,12 +57,23 @@ class ImuManager final : public ImuManagerComponentBase {
     void parameterUpdated(FwPrmIdType id  //!< The parameter ID
                           ) override;
 
+    //! Read back the parameters used on every tick and interrupt
+    //!
+    void parametersLoaded() override;
+
     //! Handler implementation for run
     //!
     //! Scheduling port for reading from IMU and writing to telemetry
     void run_handler(FwIndexType portNum,  //!< The port number
                      U32 context           //!< The call order
                      ) override;
+
+    //! Handler implementation for dataReady
+    //!
+    //! Data-ready interrupt edge indexed by device, reading the IMU in INTERRUPT mode as soon as a sample is available
+    void dataReady_handler(FwIndexType portNum,     //!< The port number, the device index
+                           Os::RawTime& cycleStart  //!< Time of the edge
+                           ) override;
   private:
     // ----------------------------------------------------------------------
     // Handler implementations for commands
@@ -57,6 +86,15 @@ class ImuManager final : public ImuManagerComponentBase {
                           U32 cmdSeq            //!< The command sequence number
                           ) override;
 
+    //! Handler implementation for command CALIBRATE_BIAS
+    //!
+    //! Command to estimate the accelerometer and gyroscope bias of every managed device while the vehicle is still,
+    //! completing once the window has elapsed
+    void CALIBRATE_BIAS_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                   U32 cmdSeq,           //!< The command sequence number
+                                   U32 duration          //!< Accumulation window (ms)
+                                   ) override;
+
     // ----------------------------------------------------------------------
     // Implementations for internal state machine actions
     // ----------------------------------------------------------------------
@@ -111,29 +149,204 @@ class ImuManager final : public ImuManagerComponentBase {
     //! Gyroscope range to register value
     static U8 gyroscope_range_to_register(GyroscopeRange range);
 
+    //! Sample period for a sample rate divider and filter bandwidth (µs)
+    static U32 sample_period_us(U8 divider, DlpfBandwidth bandwidth);
+
+    //! Time of a sample taken ageUs before the newest sample, clamped to the start of the time base
+    static Fw::Time sample_time(const Fw::Time& newest, U32 ageUs);
+
+    //! Median of count readings by channel, the mean of the middle two for an even count
+    static ImuData vote_median(const ImuData* samples, FwIndexType count);
+
+    //! Largest acceleration and angular rate difference of count readings from a voted reading
+    static void vote_errors(const ImuData* samples,
+                            FwIndexType count,
+                            const ImuData& voted,
+                            F32& accelerationError,  //!< Largest acceleration difference (G)
+                            F32& rotationError       //!< Largest angular rate difference (degrees per second)
+    );
+
+    //! Device driven by a state machine instance
+    static FwIndexType device_index(SmId smId);
+
+    //! Estimate the bias from a stationary window, updating the bias in place when the window is accepted
+    //!
+    //! Samples are read with the current bias removed, so their mean is the residual bias added to it. The
+    //! accelerometer is expected to read 1 G on the axis closest to vertical and nothing on the others.
+    static bool estimate_bias(const BiasEstimator& estimator,
+                              F32 accelerationNoiseLimit,  //!< Largest acceleration standard deviation (G)
+                              F32 rotationNoiseLimit,      //!< Largest angular rate standard deviation (deg/s)
+                              F32 accelerationBias[3],     //!< Acceleration bias by axis, updated when accepted (G)
+                              F32 rotationBias[3],         //!< Angular rate bias by axis, updated when accepted (deg/s)
+                              ImuBiasRejection& reason     //!< Why the window was rejected, when it is
+    );
+
+    //! Gyroscope offset register value removing an angular rate bias, saturating at the register range
+    static I16 gyro_offset_counts(F32 rotationBias);
+
+    //! Send a signal to the state machine of a device
+    void send_signal(FwIndexType device, MpuImu_ImuStateMachine::Signal signal);
+
+    //! Send a signal to the state machine of every managed device
+    void send_signal_all(MpuImu_ImuStateMachine::Signal signal);
+
+    //! Deliver a tick or data-ready signal to a device. When synchronous, a device in RUN with nothing queued is read
+    //! at once in the calling handler, otherwise the signal goes through the queue.
+    void deliver_signal(FwIndexType device, MpuImu_ImuStateMachine::Signal signal, bool synchronous);
+
+    //! Read a device in RUN on a tick or data-ready signal
+    void read_device(FwIndexType device, MpuImu_ImuStateMachine::Signal signal);
+
+    //! Report the queue high water mark when it rises
+    void update_queue_high_water_mark();
+
+    //! Vote between the readings of the managed devices since the last vote, emitting the median when they agree
+    void vote();
+
+    //! Accumulate a sample into the bias calibration window of a device, when a calibration is in progress
+    void accumulate_bias(FwIndexType device, const ImuData& imuData);
+
+    //! Integrate a sample held over a period, emitting the increments when the output interval is complete. A period
+    //! of zero, or longer than DELTA_MAX_GAP_US and DELTA_GAP_PERIODS sample periods, restarts the integration without
+    //! the sample.
+    void integrate_delta(FwIndexType device, const Fw::Time& time, const ImuData& imuData, U32 periodUs);
+
+    //! Statistics of three channels of a window, from the first
+    static ImuVectorStatistics vector_statistics(const WindowStatistics& statistics, U32 first);
+
+    //! Accumulate a sample of the primary device into the statistics window and the Allan variance, with the time
+    //! since the previous sample, zero when unknown
+    void accumulate_statistics(FwIndexType device, const ImuData& imuData, U32 spacingUs);
+
+    //! Report the statistics window once it has elapsed, then start the next with the current parameters
+    void update_statistics();
+
+    //! Report the statistics of the window and the Allan deviation
+    void report_statistics();
+
+    //! Estimate the bias of every managed device from the elapsed window, apply and store the accepted ones, and
+    //! complete the command
+    void finish_bias_calibration();
+
+    //! Remove the bias of a device in the conversion, leaving the angular rate bias to the offset registers when they
+    //! hold it
+    void apply_bias(FwIndexType device);
+
+    //! Report the bias of the primary device in telemetry
+    void report_bias();
+
+    //! Load stored biases, applying every valid record
+    void load_bias_file();
+
+    //! Persist the bias of every device
+    void store_bias_file();
+
+    //! Time without a data-ready interrupt after which the device is reset (µs)
+    U32 data_ready_timeout_us(FwIndexType device) const;
+
     //! Resets the IMU
-    Drv::I2cStatus reset();
+    Drv::I2cStatus reset(FwIndexType device);
 
     //! Read the reset register value
-    Drv::I2cStatus read_reset(U8& value);
+    Drv::I2cStatus read_reset(FwIndexType device, U8& value);
 
     //! Enable on the IMU
-    Drv::I2cStatus enable();
+    Drv::I2cStatus enable(FwIndexType device);
 
     //! Configure the IMU's accelerometer and gyroscope
-    Drv::I2cStatus configure_device();
+    Drv::I2cStatus configure_device(FwIndexType device);
+
+    //! Enter an acquisition mode, enabling the FIFO or data-ready interrupt and disabling those of other modes, then
+    //! write every configuration register that changed
+    Drv::I2cStatus configure_acquisition(FwIndexType device, AcquisitionMode mode);
+
+    //! Discard the FIFO contents and restart it aligned to a frame boundary
+    Drv::I2cStatus reset_fifo(FwIndexType device);
 
     //! Read IMU data
-    Drv::I2cStatus read(ImuData& imuData);
+    Drv::I2cStatus read(FwIndexType device, ImuData& imuData);
+
+    //! Drain every whole frame from the FIFO, emitting each sample timestamped back from the newest at the sample
+    //! period, and returning the newest
+    Drv::I2cStatus read_fifo(FwIndexType device,  //!< The device to drain
+                             ImuData& imuData,    //!< Newest sample, untouched when none were drained
+                             Fw::Time& time,      //!< Time of the newest sample
+                             U32& samples         //!< Number of samples drained
+    );
+
+    //! Write a single register
+    Drv::I2cStatus write_register(FwIndexType device, U8 registerAddress, U8 value);
+
+    //! Write every configuration register whose value on the device differs or is unknown
+    Drv::I2cStatus write_registers(FwIndexType device);
+
+    //! Read the configuration registers back, rewriting any that differ
+    Drv::I2cStatus verify_registers(FwIndexType device);
+
+    //! Whether the register verification interval elapsed, starting the next
+    bool verify_due(FwIndexType device);
 
     //! Write to the I2C bus and handle errors
-    Drv::I2cStatus bus_write(Fw::Buffer& writeBuffer, Fw::Buffer& readBuffer);
+    Drv::I2cStatus bus_write(FwIndexType device, Fw::Buffer& writeBuffer, Fw::Buffer& readBuffer);
 
     //! Deserializes raw data from the bus
     RawImuData deserialize_raw_data(Fw::Buffer& buffer);
 
   private:
-    U8 m_address;
+    //! State of one managed device
+    struct Device {
+        U8 address;                   //!< I2C address
+        bool managed;                 //!< Whether the device is driven, the secondary only once configured
+        U32 samplePeriodUs;           //!< Sample period configured on the device (µs)
+        AcquisitionMode mode;         //!< Acquisition mode configured on the device since the last reset
+        Fw::Time lastDataReady;       //!< Time of the last data-ready interrupt, or of entering INTERRUPT mode
+        bool fresh;                   //!< Whether sample was read since the last vote
+        ImuData sample;               //!< Newest sample read
+        ImuBatchConverter converter;  //!< Converts samples at the configured ranges, removing the bias
+        F32 accelerationBias[3];      //!< Acceleration bias by axis (G)
+        F32 rotationBias[3];          //!< Angular rate bias by axis (degrees per second)
+        bool biasValid;               //!< Whether the bias was calibrated or loaded from the bias file
+        bool hardwareOffsets;         //!< Whether the offset registers hold the angular rate bias since the last reset
+        BiasEstimator estimator;      //!< Samples of the bias calibration window
+        DeltaIntegrator integrator;   //!< Increments of the current output interval
+        U32 deltaPeriodUs;            //!< Output interval of the increments (µs), zero when disabled
+        Fw::Time lastRead;            //!< Time of the previous register read, the start of the period of the next
+        bool lastReadValid;           //!< Whether a register read was made since the last reset or configuration
+        ImuDelta delta;               //!< Increments of the newest output interval
+        Fw::Time deltaTime;           //!< Time of the last sample of the newest output interval
+        bool deltaFresh;              //!< Whether an output interval ended during the current read
+        RegisterShadow registers;     //!< Configuration registers the device should hold and is known to hold
+        U32 verifyPeriodUs;           //!< Interval between register verifications (µs), zero when disabled
+        Fw::Time verifyStart;         //!< Time the current register verification interval started
+    };
+
+    Device m_devices[MAX_DEVICES];    //!< Managed devices, the primary first
+    U32 m_fifoOverflows;              //!< FIFO overflows since startup, of all devices
+    U32 m_voteDisagreements;          //!< Votes the device readings disagreed on since startup
+    U32 m_registerMismatches;         //!< Register verifications that found a device changed since startup
+    FwSizeType m_queueHighWaterMark;  //!< Largest number of messages queued at once, as last reported
+    bool m_synchronousRead;           //!< Whether devices in RUN are read in the handlers, from SYNCHRONOUS_READ
+    U8 m_fifoBuffer[FIFO_MAX_FRAMES * FIFO_FRAME_LENGTH];  //!< Whole frames of a single FIFO burst
+    F32 m_fifoAcceleration[3][FIFO_MAX_FRAMES];            //!< Converted accelerations of a FIFO burst by axis (G)
+    F32 m_fifoRotation[3][FIFO_MAX_FRAMES];                //!< Converted angular rates of a FIFO burst by axis (deg/s)
+
+    bool m_biasActive;          //!< Whether a bias calibration window is open
+    FwOpcodeType m_biasOpCode;  //!< Opcode of the bias calibration command, answered when the window closes
+    U32 m_biasCmdSeq;           //!< Sequence number of the bias calibration command
+    Fw::Time m_biasStart;       //!< Time the bias calibration window opened
+    U32 m_biasDurationUs;       //!< Length of the bias calibration window (µs)
+
+    bool m_biasFileEnabled;         //!< Whether biases are persisted to a file
+    bool m_biasFileLoaded;          //!< Whether the bias file has been loaded
+    Fw::FileNameString m_biasPath;  //!< Path of the bias file
+
+    WindowStatistics m_statistics;  //!< Samples of the primary device in the current statistics window
+    AllanVariance m_allan;          //!< Allan variance of the primary device samples, 48 KiB of integrals
+    bool m_allanEnabled;            //!< Whether samples are accumulated into the Allan variance
+    U64 m_allanSpacingUs;           //!< Sum of the known times between Allan variance samples (µs)
+    U32 m_allanSpacings;            //!< Number of known times between Allan variance samples
+    U32 m_statisticsWindowUs;       //!< Length of the current statistics window (µs), zero when disabled
+    Fw::Time m_statisticsStart;     //!< Time the current statistics window started
 };
 
 }  // namespace MpuImu
@@ -0,0 +1,110 @@
+// ======================================================================
+// \title  ImuStatistics.cpp
+// \author mstarch
+// \brief  cpp file for ImuManager sample statistics and Allan variance helper implementations
+// ======================================================================
+
+#include "fprime-sensors/MpuImu/Components/ImuManager/ImuManager.hpp"
+#include <cmath>
+
+namespace MpuImu {
+
+static_assert(ImuAllanOctaves::SIZE == AllanVariance::OCTAVES, "Allan deviation telemetry does not hold every octave");
+static_assert(WindowStatistics::CHANNELS == 6, "Statistics channels are not an acceleration and an angular rate");
+static_assert(AllanVariance::CHANNELS == 6, "Allan variance channels are not an acceleration and an angular rate");
+
+ImuVectorStatistics ImuManager ::vector_statistics(const WindowStatistics& statistics, U32 first) {
+    const U32 x = first;
+    const U32 y = first + 1;
+    const U32 z = first + 2;
+    return ImuVectorStatistics(
+        FprimeSensors::GeometricVector3(statistics.minimum(x), statistics.minimum(y), statistics.minimum(z)),
+        FprimeSensors::GeometricVector3(statistics.maximum(x), statistics.maximum(y), statistics.maximum(z)),
+        FprimeSensors::GeometricVector3(static_cast<F32>(statistics.mean(x)), static_cast<F32>(statistics.mean(y)),
+                                        static_cast<F32>(statistics.mean(z))),
+        FprimeSensors::GeometricVector3(static_cast<F32>(statistics.rms(x)), static_cast<F32>(statistics.rms(y)),
+                                        static_cast<F32>(statistics.rms(z))),
+        FprimeSensors::GeometricVector3(static_cast<F32>(statistics.variance(x)),
+                                        static_cast<F32>(statistics.variance(y)),
+                                        static_cast<F32>(statistics.variance(z))),
+        statistics.count());
+}
+
+void ImuManager ::accumulate_statistics(FwIndexType device, const ImuData& imuData, U32 spacingUs) {
+    if ((device != 0) || (this->m_statisticsWindowUs == 0)) {
+        return;
+    }
+    const F32 sample[WindowStatistics::CHANNELS] = {
+        imuData.get_acceleration().get_x(), imuData.get_acceleration().get_y(), imuData.get_acceleration().get_z(),
+        imuData.get_rotation().get_x(),     imuData.get_rotation().get_y(),     imuData.get_rotation().get_z()};
+    this->m_statistics.add(sample);
+    if (this->m_allanEnabled) {
+        this->m_allan.add(sample);
+        if (spacingUs > 0) {
+            this->m_allanSpacingUs += spacingUs;
+            this->m_allanSpacings++;
+        }
+    }
+}
+
+void ImuManager ::update_statistics() {
+    const Fw::Time now = this->getTime();
+    const bool started = (this->m_statisticsWindowUs != 0);
+    if (started && (elapsed_us(this->m_statisticsStart, now) < this->m_statisticsWindowUs)) {
+        return;
+    }
+    if (started) {
+        this->report_statistics();
+    }
+
+    // Start the next window, or check again next tick while disabled
+    Fw::ParamValid paramValid;
+    const U16 window = this->paramGet_STATISTICS_WINDOW(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    const bool allanEnabled = this->paramGet_ALLAN_ENABLED(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    const U16 decimation = this->paramGet_ALLAN_DECIMATION(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+
+    this->m_statisticsWindowUs = static_cast<U32>(window) * 1000;
+    this->m_statisticsStart = now;
+    this->m_statistics.reset();
+    // The Allan variance accumulates across windows while enabled, and starts again when enabled
+    this->m_allanEnabled = allanEnabled && (window != 0);
+    if (!this->m_allanEnabled) {
+        this->m_allan.reset();
+        this->m_allanSpacingUs = 0;
+        this->m_allanSpacings = 0;
+    }
+    this->m_allan.set_decimation(decimation);
+}
+
+void ImuManager ::report_statistics() {
+    if (this->m_statistics.count() > 0) {
+        this->tlmWrite_AccelerationStatistics(vector_statistics(this->m_statistics, 0));
+        this->tlmWrite_RotationStatistics(vector_statistics(this->m_statistics, 3));
+    }
+    if (this->m_allanEnabled) {
+        ImuAllanOctaves acceleration;
+        ImuAllanOctaves rotation;
+        for (U32 octave = 0; octave < AllanVariance::OCTAVES; octave++) {
+            F32 deviation[AllanVariance::CHANNELS];
+            for (U32 channel = 0; channel < AllanVariance::CHANNELS; channel++) {
+                deviation[channel] = static_cast<F32>(std::sqrt(this->m_allan.variance(octave, channel)));
+            }
+            acceleration[octave] = FprimeSensors::GeometricVector3(deviation[0], deviation[1], deviation[2]);
+            rotation[octave] = FprimeSensors::GeometricVector3(deviation[3], deviation[4], deviation[5]);
+        }
+        // Samples are a sample period apart in FIFO and INTERRUPT acquisition, but a tick apart in REGISTER
+        // acquisition, so the point spacing is the mean measured between the samples
+        U32 spacingUs = this->m_devices[0].samplePeriodUs;
+        if (this->m_allanSpacings > 0) {
+            const U64 spacings = this->m_allanSpacings;
+            spacingUs = static_cast<U32>((this->m_allanSpacingUs + (spacings / 2)) / spacings);
+        }
+        const U32 clusterTime = spacingUs * this->m_allan.decimation();
+        this->tlmWrite_AllanDeviation(ImuAllanDeviation(clusterTime, acceleration, rotation));
+    }
+}
+
+}  // namespace MpuImu
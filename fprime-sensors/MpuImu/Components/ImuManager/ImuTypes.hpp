@@ -12,9 +12,14 @@ namespace MpuImu {
     static constexpr U8 DATA_LENGTH = (6 + 1) * sizeof(U16);  // 6 DoF + temperature
     static constexpr U8 DATA_BASE_REGISTER = 0x3B;
     static constexpr U8 DEVICE_DEFAULT_ADDRESS = 0x68;
+    static constexpr U8 DEVICE_SECONDARY_ADDRESS = 0x69;  // AD0 pulled high
+
+    // Devices a single manager drives on one bus, each with its own state machine, dataOut and dataReady port
+    static constexpr FwIndexType MAX_DEVICES = 2;
     static constexpr U8 POWER_MGMT_REGISTER = 0x6B;
     static constexpr U8 RESET_VALUE = 0x80;
     static constexpr U8 POWER_ON_VALUE = 0x00;
+    static constexpr U8 POWER_MGMT_SLEEP = 0x40;  // Power management after a reset, every other register resets to zero
     static constexpr U8 GYRO_CONFIG_REGISTER = 0x1B;
     static constexpr U8 ACCEL_CONFIG_REGISTER = 0x1C;
 
@@ -27,9 +32,66 @@ namespace MpuImu {
     static constexpr U8 GYRO_CONFIG_500DEG = 0x08;
     static constexpr U8 GYRO_CONFIG_1000DEG = 0x10;
     static constexpr U8 GYRO_CONFIG_2000DEG = 0x18;
+    static constexpr U8 TEMPERATURE_REGISTER = 0x41;
+    static constexpr U8 TEMPERATURE_LENGTH = sizeof(U16);
     static constexpr F32 TEMPERATURE_SCALAR = 340.0f;
     static constexpr F32 TEMPERATURE_OFFSET = 36.53f;
 
+    // Sample rate divider, followed by the CONFIG register holding the digital low-pass filter configuration. The
+    // sample rate is the gyroscope output rate, 8 kHz with the filter off and 1 kHz otherwise, over 1 + divider.
+    static constexpr U8 SAMPLE_RATE_DIVIDER_REGISTER = 0x19;
+    static constexpr U8 DLPF_CONFIG_REGISTER = 0x1A;
+    static constexpr U32 GYRO_OUTPUT_PERIOD_DLPF_OFF_US = 125;
+    static constexpr U32 GYRO_OUTPUT_PERIOD_DLPF_ON_US = 1000;
+
+    // Interrupt configuration, contiguous registers. The data-ready interrupt is a 50 µs active high pulse and the
+    // status is cleared by any read.
+    static constexpr U8 INTERRUPT_PIN_CONFIG_REGISTER = 0x37;
+    static constexpr U8 INTERRUPT_PIN_CONFIG_READ_CLEAR = 0x10;
+    static constexpr U8 INTERRUPT_ENABLE_REGISTER = 0x38;
+    static constexpr U8 INTERRUPT_ENABLE_DATA_READY = 0x01;
+
+    // A missing data-ready interrupt resets the device after this many sample periods, and no sooner than the minimum
+    static constexpr U32 DATA_READY_TIMEOUT_PERIODS = 10;
+    static constexpr U32 DATA_READY_TIMEOUT_MIN_US = 100000;
+
+    // FIFO configuration and access. The FIFO holds accelerometer then gyroscope frames, in register order, without
+    // the temperature.
+    static constexpr U8 FIFO_ENABLE_REGISTER = 0x23;
+    static constexpr U8 FIFO_ENABLE_ACCEL_GYRO = 0x78;
+    static constexpr U8 USER_CONTROL_REGISTER = 0x6A;
+    static constexpr U8 USER_CONTROL_FIFO_ENABLE = 0x40;
+    static constexpr U8 USER_CONTROL_FIFO_RESET = 0x04;
+    static constexpr U8 FIFO_COUNT_REGISTER = 0x72;
+    static constexpr U8 FIFO_DATA_REGISTER = 0x74;
+    static constexpr U16 FIFO_SIZE = 1024;
+    static constexpr U8 FIFO_FRAME_LENGTH = 6 * sizeof(U16);  // 6 DoF
+    static constexpr U16 FIFO_MAX_FRAMES = FIFO_SIZE / FIFO_FRAME_LENGTH;
+
+    // Gyroscope offset registers, X, Y, then Z high and low bytes, subtracted from the gyroscope output in counts of the
+    // 1000 degrees per second range whatever the configured range. They are zero after a reset. The accelerometer
+    // offset registers hold the factory trim, so the accelerometer bias is only removed in the conversion.
+    static constexpr U8 GYRO_OFFSET_REGISTER = 0x13;
+    static constexpr F32 GYRO_OFFSET_COUNTS_PER_DPS = 32.8f;
+
+    // Bias calibration limits. The window holds at least BIAS_MIN_SAMPLES samples and lasts at most
+    // BIAS_MAX_DURATION_MS. A bias beyond the MPU6050 zero offset tolerance, 80 mG and 20 deg/s, with margin, is a
+    // tilted or faulty device rather than a bias.
+    static constexpr U32 BIAS_MIN_SAMPLES = 10;
+    static constexpr U32 BIAS_MAX_DURATION_MS = 600000;
+    static constexpr F32 BIAS_MAX_ACCELERATION = 0.2f;
+    static constexpr F32 BIAS_MAX_ROTATION = 30.0f;
+
+    // Bias file record: valid marker, acceleration then angular rate bias as big-endian F32, big-endian CRC-32 of the
+    // preceding bytes. A zero marker is a device that was never calibrated.
+    static constexpr U8 BIAS_RECORD_VALID = 0xB1;
+    static constexpr U32 BIAS_RECORD_SIZE = 1 + (6 * sizeof(F32)) + sizeof(U32);
+
+    // Longest period a single sample is integrated over before the gap restarts the delta output interval (µs), with
+    // margin over the tick of a 10 Hz rate group. Devices sampling slower allow DELTA_GAP_PERIODS sample periods.
+    static constexpr U32 DELTA_MAX_GAP_US = 250000;
+    static constexpr U32 DELTA_GAP_PERIODS = 3;
+
     //! RawImuData: basic structure of imu data as read from the device
     struct RawImuData {
         I16 acceleration[3];
@@ -0,0 +1,118 @@
+// ======================================================================
+// \title  RegisterShadow.cpp
+// \author mstarch
+// \brief  cpp file for the shadow of the MPU6050 configuration registers
+// ======================================================================
+
+#include "fprime-sensors/MpuImu/Components/ImuManager/RegisterShadow.hpp"
+#include "Fw/Types/Assert.hpp"
+
+namespace MpuImu {
+
+RegisterShadow ::RegisterShadow() {
+    for (U32 i = 0; i < BLOCK_SIZE; i++) {
+        const U8 registerAddress = static_cast<U8>(FIRST_REGISTER + i);
+        this->m_desired[i] = reset_value(registerAddress);
+        this->m_confirmed[i] = reset_value(registerAddress);
+        this->m_known[i] = false;
+    }
+}
+
+bool RegisterShadow ::tracked(U8 registerAddress) {
+    // Gyroscope offsets, SMPLRT_DIV, CONFIG, GYRO_CONFIG, and ACCEL_CONFIG are contiguous
+    return ((registerAddress >= GYRO_OFFSET_REGISTER) && (registerAddress <= ACCEL_CONFIG_REGISTER)) ||
+           (registerAddress == FIFO_ENABLE_REGISTER) || (registerAddress == INTERRUPT_PIN_CONFIG_REGISTER) ||
+           (registerAddress == INTERRUPT_ENABLE_REGISTER) || (registerAddress == USER_CONTROL_REGISTER) ||
+           (registerAddress == POWER_MGMT_REGISTER);
+}
+
+U8 RegisterShadow ::reset_value(U8 registerAddress) {
+    return (registerAddress == POWER_MGMT_REGISTER) ? POWER_MGMT_SLEEP : 0x00;
+}
+
+void RegisterShadow ::reset() {
+    for (U32 i = 0; i < BLOCK_SIZE; i++) {
+        const U8 registerAddress = static_cast<U8>(FIRST_REGISTER + i);
+        this->m_desired[i] = reset_value(registerAddress);
+        this->m_confirmed[i] = reset_value(registerAddress);
+        this->m_known[i] = true;
+    }
+}
+
+void RegisterShadow ::set(U8 registerAddress, U8 value) {
+    this->m_desired[index(registerAddress)] = value;
+}
+
+U8 RegisterShadow ::desired(U8 registerAddress) const {
+    return this->m_desired[index(registerAddress)];
+}
+
+bool RegisterShadow ::dirty(U8 registerAddress) const {
+    const U32 i = index(registerAddress);
+    return !this->m_known[i] || (this->m_confirmed[i] != this->m_desired[i]);
+}
+
+bool RegisterShadow ::next_run(U32 start, U8& first, U32& count) const {
+    count = 0;
+    for (U32 registerAddress = (start < FIRST_REGISTER) ? FIRST_REGISTER : start; registerAddress <= LAST_REGISTER;
+         registerAddress++) {
+        const U8 address = static_cast<U8>(registerAddress);
+        const bool dirty = tracked(address) && this->dirty(address);
+        if (dirty) {
+            if (count == 0) {
+                first = address;
+            }
+            count++;
+        } else if (count > 0) {
+            break;
+        }
+    }
+    FW_ASSERT(count <= MAX_RUN, static_cast<FwAssertArgType>(count));
+    return (count > 0);
+}
+
+void RegisterShadow ::confirm(U8 first, U32 count) {
+    for (U32 offset = 0; offset < count; offset++) {
+        const U32 i = index(static_cast<U8>(first + offset));
+        this->m_confirmed[i] = this->m_desired[i];
+        this->m_known[i] = true;
+    }
+}
+
+void RegisterShadow ::confirm_value(U8 registerAddress, U8 value) {
+    const U32 i = index(registerAddress);
+    this->m_confirmed[i] = value;
+    this->m_known[i] = true;
+}
+
+void RegisterShadow ::forget(U8 first, U32 count) {
+    for (U32 offset = 0; offset < count; offset++) {
+        this->m_known[index(static_cast<U8>(first + offset))] = false;
+    }
+}
+
+U32 RegisterShadow ::verify(const U8 block[BLOCK_SIZE], U8& first) {
+    U32 differing = 0;
+    for (U32 i = 0; i < BLOCK_SIZE; i++) {
+        const U8 registerAddress = static_cast<U8>(FIRST_REGISTER + i);
+        if (!tracked(registerAddress)) {
+            continue;
+        }
+        this->m_confirmed[i] = block[i];
+        this->m_known[i] = true;
+        if (block[i] != this->m_desired[i]) {
+            if (differing == 0) {
+                first = registerAddress;
+            }
+            differing++;
+        }
+    }
+    return differing;
+}
+
+U32 RegisterShadow ::index(U8 registerAddress) {
+    FW_ASSERT(tracked(registerAddress), static_cast<FwAssertArgType>(registerAddress));
+    return static_cast<U32>(registerAddress - FIRST_REGISTER);
+}
+
+}  // namespace MpuImu
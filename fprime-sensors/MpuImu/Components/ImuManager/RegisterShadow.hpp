@@ -0,0 +1,90 @@
+// ======================================================================
+// \title  RegisterShadow.hpp
+// \author mstarch
+// \brief  hpp file for the shadow of the MPU6050 configuration registers
+// ======================================================================
+
+#ifndef MpuImu_RegisterShadow_HPP
+#define MpuImu_RegisterShadow_HPP
+
+#include "Fw/FPrimeBasicTypes.hpp"
+#include "fprime-sensors/MpuImu/Components/ImuManager/ImuTypes.hpp"
+
+namespace MpuImu {
+
+//! Shadows the configuration registers of a device, the value each should hold and the value it is known to hold
+//!
+//! Registers are addressed in a block from the gyroscope offsets to the power management register, of which only the
+//! registers the manager configures are tracked. A tracked register is dirty when its value on the device is unknown or
+//! differs from the one it should hold. Adjacent dirty registers form a run, written in one auto-increment
+//! transaction, so a reconfiguration only costs the registers that changed. Reading the whole block back confirms
+//! every tracked register at once.
+class RegisterShadow {
+  public:
+    //! First register of the block, the high byte of the x gyroscope offset
+    static constexpr U8 FIRST_REGISTER = GYRO_OFFSET_REGISTER;
+
+    //! Last register of the block, the power management register
+    static constexpr U8 LAST_REGISTER = POWER_MGMT_REGISTER;
+
+    //! Registers in the block, the length of a verification read
+    static constexpr U32 BLOCK_SIZE = LAST_REGISTER - FIRST_REGISTER + 1;
+
+    //! Longest run of adjacent tracked registers, the gyroscope offsets through ACCEL_CONFIG
+    static constexpr U32 MAX_RUN = 10;
+
+    //! Construct a shadow holding the reset values, none of them known to be on the device
+    RegisterShadow();
+
+    //! Whether a register is configured by the manager and tracked
+    static bool tracked(U8 registerAddress);
+
+    //! Value of a register after a device reset, zero for all but the power management register
+    static U8 reset_value(U8 registerAddress);
+
+    //! The device was reset, every tracked register should hold and holds its reset value
+    void reset();
+
+    //! Set the value a tracked register should hold
+    void set(U8 registerAddress, U8 value);
+
+    //! Value a tracked register should hold
+    U8 desired(U8 registerAddress) const;
+
+    //! Whether a tracked register is unknown or differs from the value it should hold
+    bool dirty(U8 registerAddress) const;
+
+    //! Find the first run of adjacent dirty registers at or after start, returning false when there is none
+    bool next_run(U32 start,   //!< Register to search from
+                  U8& first,   //!< First register of the run
+                  U32& count   //!< Registers in the run, at most MAX_RUN
+    ) const;
+
+    //! A run was written, its registers hold the values they should
+    void confirm(U8 first, U32 count);
+
+    //! A register was written outside of a run and is known to hold value
+    void confirm_value(U8 registerAddress, U8 value);
+
+    //! A write of a run failed, the values its registers hold are unknown
+    void forget(U8 first, U32 count);
+
+    //! Take the values read from the whole block as the ones the device holds
+    //!
+    //! \return the number of tracked registers differing from the values they should hold, which are then dirty
+    U32 verify(const U8 block[BLOCK_SIZE],  //!< Block read from FIRST_REGISTER
+               U8& first                    //!< First differing register, when any differ
+    );
+
+  private:
+    //! Index of a tracked register in the block
+    static U32 index(U8 registerAddress);
+
+    U8 m_desired[BLOCK_SIZE];    //!< Value each register should hold
+    U8 m_confirmed[BLOCK_SIZE];  //!< Value each register is known to hold
+    bool m_known[BLOCK_SIZE];    //!< Whether the value each register holds is known
+};
+
+}  // namespace MpuImu
+
+#endif
@@ -0,0 +1,96 @@
+// ======================================================================
+// \title  WindowStatistics.cpp
+// \author mstarch
+// \brief  cpp file for the windowed minimum, maximum, mean, RMS, and variance of MPU6050 samples
+// ======================================================================
+
+#include "fprime-sensors/MpuImu/Components/ImuManager/WindowStatistics.hpp"
+#include <cmath>
+#include "Fw/Types/Assert.hpp"
+
+namespace MpuImu {
+
+WindowStatistics ::WindowStatistics() {
+    this->reset();
+}
+
+void WindowStatistics ::reset() {
+    this->m_count = 0;
+    for (U32 channel = 0; channel < CHANNELS; channel++) {
+        this->m_minimum[channel] = 0.0f;
+        this->m_maximum[channel] = 0.0f;
+        this->m_shift[channel] = 0.0;
+        this->m_sum[channel] = 0.0;
+        this->m_squares[channel] = 0.0;
+    }
+}
+
+void WindowStatistics ::add(const F32 sample[CHANNELS]) {
+    FW_ASSERT(sample != nullptr);
+    // Saturate rather than wrap, no window is this long
+    if (this->m_count == 0xFFFFFFFF) {
+        return;
+    }
+    if (this->m_count == 0) {
+        for (U32 channel = 0; channel < CHANNELS; channel++) {
+            this->m_minimum[channel] = sample[channel];
+            this->m_maximum[channel] = sample[channel];
+            this->m_shift[channel] = static_cast<F64>(sample[channel]);
+        }
+    }
+    this->m_count++;
+    for (U32 channel = 0; channel < CHANNELS; channel++) {
+        const F32 value = sample[channel];
+        this->m_minimum[channel] = (value < this->m_minimum[channel]) ? value : this->m_minimum[channel];
+        this->m_maximum[channel] = (value > this->m_maximum[channel]) ? value : this->m_maximum[channel];
+        const F64 delta = static_cast<F64>(value) - this->m_shift[channel];
+        this->m_sum[channel] += delta;
+        this->m_squares[channel] += delta * delta;
+    }
+}
+
+U32 WindowStatistics ::count() const {
+    return this->m_count;
+}
+
+F32 WindowStatistics ::minimum(U32 channel) const {
+    FW_ASSERT(channel < CHANNELS, static_cast<FwAssertArgType>(channel));
+    return this->m_minimum[channel];
+}
+
+F32 WindowStatistics ::maximum(U32 channel) const {
+    FW_ASSERT(channel < CHANNELS, static_cast<FwAssertArgType>(channel));
+    return this->m_maximum[channel];
+}
+
+F64 WindowStatistics ::mean(U32 channel) const {
+    FW_ASSERT(channel < CHANNELS, static_cast<FwAssertArgType>(channel));
+    if (this->m_count == 0) {
+        return 0.0;
+    }
+    return this->m_shift[channel] + (this->m_sum[channel] / static_cast<F64>(this->m_count));
+}
+
+F64 WindowStatistics ::rms(U32 channel) const {
+    FW_ASSERT(channel < CHANNELS, static_cast<FwAssertArgType>(channel));
+    if (this->m_count == 0) {
+        return 0.0;
+    }
+    // Sum of squares of the values, expanded around the shift
+    const F64 count = static_cast<F64>(this->m_count);
+    const F64 shift = this->m_shift[channel];
+    const F64 squares = this->m_squares[channel] + (2.0 * shift * this->m_sum[channel]) + (count * shift * shift);
+    return std::sqrt(((squares > 0.0) ? squares : 0.0) / count);
+}
+
+F64 WindowStatistics ::variance(U32 channel) const {
+    FW_ASSERT(channel < CHANNELS, static_cast<FwAssertArgType>(channel));
+    if (this->m_count < 2) {
+        return 0.0;
+    }
+    const F64 count = static_cast<F64>(this->m_count);
+    const F64 squaredError = this->m_squares[channel] - ((this->m_sum[channel] * this->m_sum[channel]) / count);
+    return ((squaredError > 0.0) ? squaredError : 0.0) / (count - 1.0);
+}
+
+}  // namespace MpuImu
@@ -0,0 +1,62 @@
+// ======================================================================
+// \title  WindowStatistics.hpp
+// \author mstarch
+// \brief  hpp file for the windowed minimum, maximum, mean, RMS, and variance of MPU6050 samples
+// ======================================================================
+
+#ifndef MpuImu_WindowStatistics_HPP
+#define MpuImu_WindowStatistics_HPP
+
+#include "Fw/FPrimeBasicTypes.hpp"
+
+namespace MpuImu {
+
+//! Accumulates the minimum, maximum, mean, RMS, and variance of accelerometer and gyroscope samples over a window
+//!
+//! Each sample updates the extremes and the sums of its difference, and squared difference, from the first sample of
+//! the window. Shifting by a sample keeps the sums small against the 1 G accelerometer axis, so the variance does not
+//! cancel, without the division Welford's algorithm takes on every sample. Statistics are read once per window.
+class WindowStatistics {
+  public:
+    //! Channels of a sample: accelerations (G) then angular rates (degrees per second), each x, y, z
+    static constexpr U32 CHANNELS = 6;
+
+    //! Construct an empty window
+    WindowStatistics();
+
+    //! Discard every sample
+    void reset();
+
+    //! Accumulate a sample of CHANNELS values
+    void add(const F32 sample[CHANNELS]);
+
+    //! Number of samples accumulated
+    U32 count() const;
+
+    //! Smallest value of a channel, zero when empty
+    F32 minimum(U32 channel) const;
+
+    //! Largest value of a channel, zero when empty
+    F32 maximum(U32 channel) const;
+
+    //! Mean of a channel, zero when empty
+    F64 mean(U32 channel) const;
+
+    //! Root mean square of a channel, zero when empty
+    F64 rms(U32 channel) const;
+
+    //! Sample variance of a channel, zero with fewer than two samples
+    F64 variance(U32 channel) const;
+
+  private:
+    U32 m_count;              //!< Samples accumulated
+    F32 m_minimum[CHANNELS];  //!< Smallest value by channel
+    F32 m_maximum[CHANNELS];  //!< Largest value by channel
+    F64 m_shift[CHANNELS];    //!< First sample of the window by channel
+    F64 m_sum[CHANNELS];      //!< Sum of differences from the shift by channel
+    F64 m_squares[CHANNELS];  //!< Sum of squared differences from the shift by channel
+};
+
+}  // namespace MpuImu
+
+#endif
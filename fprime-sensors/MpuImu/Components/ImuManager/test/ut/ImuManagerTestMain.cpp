@@ -4,6 +4,8 @@
 // \brief  cpp file for ImuManager component test main function
 // ======================================================================
 
+#include <chrono>
+#include <cstdio>
 #include "ImuManagerTester.hpp"
 #include "STest/Pick/Pick.hpp"
 #include "STest/Random/Random.hpp"
@@ -26,7 +28,7 @@ TEST_F(ImuManagerTester, NominalParameterChange) {
     ASSERT_EVENTS_AccelerometerRangeUpdated(0, this->accelerationRange);
     ASSERT_EVENTS_GyroscopeRangeUpdated_SIZE(1);
     ASSERT_EVENTS_GyroscopeRangeUpdated(0, this->gyroscopeRange);
-    this->state = ImuManagerTester::State::CONFIGURE_ACCELEROMETER;
+    this->expect_configure();
     this->reconfigure_sequence();
     this->nominal_run_sequence();
 }
@@ -42,6 +44,519 @@ TEST_F(ImuManagerTester, FailureRate) {
     }
 }
 
+TEST_F(ImuManagerTester, NominalFifo) {
+    this->nominal_boot_sequence();
+    this->reconfigure_sequence();
+    this->nominal_run_sequence();
+    this->pick_acceleration_range();
+    this->pick_gyroscope_range();
+    this->set_acquisition_mode(AcquisitionMode::FIFO);
+    this->expect_configure();
+    this->fifo_configure_sequence();
+    this->fifo_run_sequence();
+    // Exactly full of whole frames still drains
+    this->fifoCount = FIFO_MAX_FRAMES * FIFO_FRAME_LENGTH;
+    this->fifo_tick();
+}
+
+TEST_F(ImuManagerTester, FifoOverflow) {
+    this->nominal_boot_sequence();
+    this->set_acquisition_mode(AcquisitionMode::FIFO);
+    this->fifo_configure_sequence();
+    for (U32 overflows = 1; overflows <= 3; overflows++) {
+        // A full FIFO is reset and restarted rather than drained
+        this->fifoCount = static_cast<U16>(STest::Pick::lowerUpper(FIFO_SIZE, 0xFFFF));
+        this->tick();
+        ASSERT_from_busWriteRead_SIZE(1);
+        ASSERT_from_busWrite_SIZE(2);
+        ASSERT_EVENTS_FifoOverflow_SIZE(1);
+        ASSERT_EVENTS_FifoOverflow(0, overflows);
+        ASSERT_TLM_FifoOverflows_SIZE(1);
+        ASSERT_TLM_FifoOverflows(0, overflows);
+        ASSERT_TLM_FifoSamples_SIZE(1);
+        ASSERT_TLM_FifoSamples(0, 0);
+        ASSERT_TLM_Reading_SIZE(0);
+        this->verify_state_and_clear(ImuManagerTester::State::FIFO_COUNT);
+        // Draining resumes on the next tick
+        this->fifo_run_sequence();
+    }
+}
+
+TEST_F(ImuManagerTester, FifoToRegister) {
+    this->nominal_boot_sequence();
+    this->set_acquisition_mode(AcquisitionMode::FIFO);
+    this->fifo_configure_sequence();
+    this->fifo_run_sequence();
+    this->set_acquisition_mode(AcquisitionMode::REGISTER);
+    this->expect_configure();
+    // Only the FIFO enables change, and they are not adjacent
+    this->tick();
+    ASSERT_from_busWrite_SIZE(2);
+    ASSERT_FALSE(this->fifo_enabled());
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+    this->nominal_run_sequence();
+}
+
+TEST_F(ImuManagerTester, NominalSampleRate) {
+    this->nominal_boot_sequence();
+    this->pick_sample_rate();
+    this->set_acquisition_mode(AcquisitionMode::FIFO);
+    this->fifo_configure_sequence();
+    this->fifo_run_sequence();
+    // Changing the rate reconfigures, keeping the FIFO enabled
+    this->pick_sample_rate();
+    this->expect_configure();
+    this->fifo_configure_sequence();
+    this->fifo_run_sequence();
+    // Samples read in register mode carry the time of the read
+    this->set_acquisition_mode(AcquisitionMode::REGISTER);
+    this->expect_configure();
+    this->tick();
+    ASSERT_from_busWrite_SIZE(2);
+    this->verify_sample_rate();
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+    this->pick_time();
+    this->nominal_run_sequence();
+}
+
+TEST_F(ImuManagerTester, NominalDataReady) {
+    this->nominal_boot_sequence();
+    this->set_acquisition_mode(AcquisitionMode::INTERRUPT);
+    this->interrupt_configure_sequence();
+    this->interrupt_run_sequence();
+    // An edge behind a reconfiguration is ignored outside of RUN
+    this->pick_acceleration_range();
+    this->clearHistory();
+    this->data_ready();
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+    this->expect_configure();
+    this->interrupt_configure_sequence();
+    this->interrupt_run_sequence();
+}
+
+TEST_F(ImuManagerTester, DataReadyTimeout) {
+    this->nominal_boot_sequence();
+    this->set_acquisition_mode(AcquisitionMode::INTERRUPT);
+    this->interrupt_configure_sequence();
+    this->interrupt_run_sequence();
+    // Without edges for longer than the timeout the device is reset
+    this->advance_time(DATA_READY_TIMEOUT_MIN_US + 1);
+    this->tick();
+    ASSERT_EVENTS_DataReadyTimeout_SIZE(1);
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+    this->state = ImuManagerTester::State::RESET;
+    this->tick();
+    this->verify_state_and_clear(ImuManagerTester::State::WAIT_RESET);
+    ASSERT_FALSE(this->interrupt_enabled());
+}
+
+TEST_F(ImuManagerTester, InterruptToRegister) {
+    this->nominal_boot_sequence();
+    this->set_acquisition_mode(AcquisitionMode::INTERRUPT);
+    this->interrupt_configure_sequence();
+    this->interrupt_run_sequence();
+    this->set_acquisition_mode(AcquisitionMode::REGISTER);
+    this->expect_configure();
+    // Only the adjacent interrupt registers change
+    this->tick();
+    ASSERT_from_busWrite_SIZE(1);
+    ASSERT_FALSE(this->interrupt_enabled());
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+    // Edges left over from INTERRUPT mode are ignored
+    this->data_ready();
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+    this->nominal_run_sequence();
+}
+
+TEST_F(ImuManagerTester, FifoBurstBenchmark) {
+    this->nominal_boot_sequence();
+    this->reconfigure_sequence();
+
+    // One sample per tick from the data registers
+    this->busTransactions = 0;
+    this->busBytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (U32 i = 0; i < FIFO_BENCHMARK_TICKS; i++) {
+        this->tick();
+        this->clearHistory();
+    }
+    const F64 registerUs =
+        std::chrono::duration<F64, std::micro>(std::chrono::steady_clock::now() - start).count();
+    const F64 registerTransactions = static_cast<F64>(this->busTransactions) / FIFO_BENCHMARK_TICKS;
+    const F64 registerBytes = static_cast<F64>(this->busBytes) / FIFO_BENCHMARK_TICKS;
+    ASSERT_EQ(this->state, ImuManagerTester::State::RUN);
+
+    // 1 kHz samples drained by a rate group just fast enough not to overflow the FIFO
+    this->set_acquisition_mode(AcquisitionMode::FIFO);
+    this->expect_configure();
+    this->fifo_configure_sequence();
+    this->fifoCount = FIFO_MAX_FRAMES * FIFO_FRAME_LENGTH;
+    this->busTransactions = 0;
+    this->busBytes = 0;
+    start = std::chrono::steady_clock::now();
+    for (U32 i = 0; i < FIFO_BENCHMARK_TICKS; i++) {
+        this->tick();
+        this->clearHistory();
+    }
+    const F64 fifoUs = std::chrono::duration<F64, std::micro>(std::chrono::steady_clock::now() - start).count();
+    const U32 fifoSamplesOut = FIFO_BENCHMARK_TICKS * FIFO_MAX_FRAMES;
+    ASSERT_EQ(this->state, ImuManagerTester::State::FIFO_COUNT);
+    const F64 fifoTransactions = static_cast<F64>(this->busTransactions) / fifoSamplesOut;
+    const F64 fifoBytes = static_cast<F64>(this->busBytes) / fifoSamplesOut;
+
+    ::printf("[ BENCHMARK ] Register: %.3f transactions, %.1f bus bytes, %.3f us per sample\n", registerTransactions,
+             registerBytes, registerUs / FIFO_BENCHMARK_TICKS);
+    ::printf("[ BENCHMARK ] FIFO:     %.3f transactions, %.1f bus bytes, %.3f us per sample (%u samples per tick)\n",
+             fifoTransactions, fifoBytes, fifoUs / fifoSamplesOut, static_cast<unsigned int>(FIFO_MAX_FRAMES));
+    ASSERT_LT(fifoTransactions * 20.0, registerTransactions);
+    ASSERT_LT(fifoBytes, registerBytes);
+}
+
+TEST_F(ImuManagerTester, NominalDualDevice) {
+    this->dual_boot_sequence();
+    this->pick_acceleration_range();
+    this->pick_gyroscope_range();
+    // Both devices hold the same registers, and the ranges are adjacent so either device writes them at once
+    this->expect_configure();
+    this->secondaryState = this->state;
+    const bool changed = (this->state == ImuManagerTester::State::CONFIGURE);
+    this->tick();
+    ASSERT_from_busWrite_SIZE(changed ? 2 : 0);
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+    U32 randomValue = STest::Pick::lowerUpper(1, 20);
+    for (U32 i = 0; i < randomValue; i++) {
+        this->pick_time();
+        // Identical readings, then readings a few counts apart, are consistent
+        this->dual_run_sequence(0, ImuVoteStatus::CONSISTENT);
+        this->dual_run_sequence(static_cast<I16>(STest::Pick::lowerUpper(1, 100)), ImuVoteStatus::CONSISTENT);
+    }
+}
+
+TEST_F(ImuManagerTester, DualDeviceDisagreement) {
+    this->dual_boot_sequence();
+    this->dual_run_sequence(0, ImuVoteStatus::CONSISTENT);
+    // At least 0.24 G apart at any range, so each reading is over 0.1 G from the median. The disagreement event is
+    // throttled after five.
+    U32 randomValue = STest::Pick::lowerUpper(1, 5);
+    for (U32 i = 0; i < randomValue; i++) {
+        const I16 offset = static_cast<I16>(STest::Pick::lowerUpper(4000, 8000));
+        this->dual_run_sequence(STest::Pick::lowerUpper(0, 1) ? offset : static_cast<I16>(-offset),
+                                ImuVoteStatus::DISAGREE);
+    }
+    this->dual_run_sequence(0, ImuVoteStatus::CONSISTENT);
+}
+
+TEST_F(ImuManagerTester, DualDeviceFailure) {
+    this->dual_boot_sequence();
+    this->dual_run_sequence(0, ImuVoteStatus::CONSISTENT);
+
+    // The secondary stops acknowledging and drops out of the vote, leaving the primary to pass through
+    this->failedAddress = DEVICE_SECONDARY_ADDRESS;
+    U32 randomValue = STest::Pick::lowerUpper(1, 20);
+    for (U32 i = 0; i < randomValue; i++) {
+        this->tick();
+        ASSERT_EQ(this->fromPortHistory_busWriteRead->at(0).addr, DEVICE_DEFAULT_ADDRESS);
+        ASSERT_TLM_Reading_SIZE(1);
+        ASSERT_TLM_Reading(0, this->imuData);
+        ASSERT_TLM_SecondaryReading_SIZE(0);
+        ASSERT_TLM_VoteStatus_SIZE(1);
+        ASSERT_TLM_VoteStatus(0, ImuVoteStatus::SINGLE);
+        ASSERT_from_votedOut_SIZE(1);
+        ASSERT_EQ(this->fromPortHistory_votedOut->at(0).data, this->imuData);
+        if (i == 0) {
+            ASSERT_EVENTS_I2cError_SIZE(1);
+            ASSERT_EVENTS_I2cError(0, DEVICE_SECONDARY_ADDRESS, Drv::I2cStatus::I2C_ADDRESS_ERR);
+        }
+        this->verify_state_and_clear(ImuManagerTester::State::RUN);
+    }
+
+    // Once it acknowledges again the secondary is reset, reconfigured, and rejoins the vote
+    this->failedAddress = 0;
+    this->tick();
+    ASSERT_EQ(this->secondaryState, ImuManagerTester::State::WAIT_RESET);
+    this->clearHistory();
+    this->secondaryState = ImuManagerTester::State::WAIT_RESET_FINISH;
+    // Reset check, enable, then configure
+    for (U32 i = 0; i < 3; i++) {
+        this->tick();
+        ASSERT_TLM_VoteStatus(0, ImuVoteStatus::SINGLE);
+        this->verify_state_and_clear(ImuManagerTester::State::RUN);
+    }
+    ASSERT_EQ(this->secondaryState, ImuManagerTester::State::RUN);
+    this->dual_run_sequence(0, ImuVoteStatus::CONSISTENT);
+}
+
+TEST_F(ImuManagerTester, BatchConversionBitExact) {
+    // Every count up to two SIMD blocks past the point where the kernel first runs, then random large batches
+    for (U32 count = 0; count <= 12; count++) {
+        this->batch_conversion(ImuBatchConverter::REGISTER_RECORD, count);
+        this->batch_conversion(ImuBatchConverter::FIFO_RECORD, count);
+    }
+    for (U32 i = 0; i < 100; i++) {
+        const U32 count = STest::Pick::lowerUpper(0, BATCH_MAX_RECORDS);
+        this->batch_conversion(STest::Pick::lowerUpper(0, 1) ? ImuBatchConverter::REGISTER_RECORD
+                                                             : ImuBatchConverter::FIFO_RECORD,
+                               count);
+    }
+}
+
+TEST_F(ImuManagerTester, BatchConversionBenchmark) {
+    this->pick_acceleration_range();
+    this->pick_gyroscope_range();
+    const F64 perSample = this->batch_conversion_rate(PER_SAMPLE, ImuBatchConverter::REGISTER_RECORD);
+    const F64 registerScalar = this->batch_conversion_rate(SCALAR, ImuBatchConverter::REGISTER_RECORD);
+    const F64 registerBatch = this->batch_conversion_rate(BATCH, ImuBatchConverter::REGISTER_RECORD);
+    const F64 fifoScalar = this->batch_conversion_rate(SCALAR, ImuBatchConverter::FIFO_RECORD);
+    const F64 fifoBatch = this->batch_conversion_rate(BATCH, ImuBatchConverter::FIFO_RECORD);
+
+    ::printf("[ BENCHMARK ] Register records, per sample: %.1f Msamples/s\n", perSample / 1.0e6);
+    ::printf("[ BENCHMARK ] Register records, scalar:     %.1f Msamples/s\n", registerScalar / 1.0e6);
+    ::printf("[ BENCHMARK ] Register records, batch:      %.1f Msamples/s (SIMD %s)\n", registerBatch / 1.0e6,
+             ImuBatchConverter::SIMD_AVAILABLE ? "on" : "off");
+    ::printf("[ BENCHMARK ] FIFO records, scalar:         %.1f Msamples/s\n", fifoScalar / 1.0e6);
+    ::printf("[ BENCHMARK ] FIFO records, batch:          %.1f Msamples/s (SIMD %s)\n", fifoBatch / 1.0e6,
+             ImuBatchConverter::SIMD_AVAILABLE ? "on" : "off");
+    ASSERT_GT(perSample, 0.0);
+    ASSERT_GT(registerBatch, 0.0);
+    ASSERT_GT(fifoBatch, 0.0);
+}
+
+TEST_F(ImuManagerTester, BiasEstimatorStability) {
+    this->bias_estimator_stability();
+}
+
+TEST_F(ImuManagerTester, NominalBiasCalibration) {
+    this->nominal_boot_sequence();
+    this->reconfigure_sequence();
+    this->steady_reads(2);
+    this->bias_calibration_sequence(BIAS_DURATION_MS, Fw::CmdResponse::OK);
+    this->clearHistory();
+    // Level readings with no angular rate once the bias is removed
+    U32 randomValue = STest::Pick::lowerUpper(1, 20);
+    for (U32 i = 0; i < randomValue; i++) {
+        this->verify_bias_removed(false);
+    }
+}
+
+TEST_F(ImuManagerTester, BiasCalibrationRejected) {
+    this->nominal_boot_sequence();
+    this->reconfigure_sequence();
+
+    // Windows of no time or over the limit are refused
+    this->sendCmd_CALIBRATE_BIAS(0, 0, 0);
+    this->sendCmd_CALIBRATE_BIAS(0, 1, BIAS_MAX_DURATION_MS + 1);
+    this->tick();
+    ASSERT_CMD_RESPONSE_SIZE(2);
+    ASSERT_CMD_RESPONSE(0, ImuManager::OPCODE_CALIBRATE_BIAS, 0, Fw::CmdResponse::VALIDATION_ERROR);
+    ASSERT_CMD_RESPONSE(1, ImuManager::OPCODE_CALIBRATE_BIAS, 1, Fw::CmdResponse::VALIDATION_ERROR);
+    ASSERT_EVENTS_BiasCalibrationInvalid_SIZE(2);
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+
+    // A second window is refused while one is open, and two samples are too few
+    this->sendCmd_CALIBRATE_BIAS(0, 0, BIAS_TICK_US / 1000);
+    this->sendCmd_CALIBRATE_BIAS(0, 1, BIAS_DURATION_MS);
+    this->tick();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, ImuManager::OPCODE_CALIBRATE_BIAS, 1, Fw::CmdResponse::BUSY);
+    ASSERT_EVENTS_BiasCalibrationBusy_SIZE(1);
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+    this->advance_time(BIAS_TICK_US);
+    this->tick();
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, ImuManager::OPCODE_CALIBRATE_BIAS, 0, Fw::CmdResponse::EXECUTION_ERROR);
+    ASSERT_EVENTS_BiasCalibrationRejected_SIZE(1);
+    ASSERT_EVENTS_BiasCalibrationRejected(0, 0, ImuBiasRejection::TOO_FEW_SAMPLES);
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+
+    // Random readings are a device in motion
+    this->bias_calibration_sequence(BIAS_DURATION_MS, Fw::CmdResponse::EXECUTION_ERROR);
+    ASSERT_EVENTS_BiasCalibrationRejected(0, 0, ImuBiasRejection::MOTION);
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+
+    // A still but tilted device reads gravity on a horizontal axis
+    this->steadyRaw.acceleration[0] = 8000;
+    this->steady_reads(2);
+    this->bias_calibration_sequence(BIAS_DURATION_MS, Fw::CmdResponse::EXECUTION_ERROR);
+    ASSERT_EVENTS_BiasCalibrationRejected(0, 0, ImuBiasRejection::OUT_OF_RANGE);
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+
+    // Rejected windows leave readings unbiased
+    this->steadyReads = false;
+    this->nominal_run_sequence();
+}
+
+TEST_F(ImuManagerTester, BiasHardwareOffsets) {
+    this->nominal_boot_sequence();
+    this->reconfigure_sequence();
+    this->steady_reads(2);
+    this->bias_calibration_sequence(BIAS_DURATION_MS, Fw::CmdResponse::OK);
+    this->clearHistory();
+    this->set_hardware_offsets(true);
+    this->verify_bias_removed(true);
+    // Disabling clears the registers and removes the angular rate bias in software again
+    this->set_hardware_offsets(false);
+    this->verify_bias_removed(false);
+}
+
+TEST_F(ImuManagerTester, BiasFileRestore) {
+    this->test_bias_file_restore();
+}
+
+TEST_F(ImuManagerTester, BiasFileInvalid) {
+    this->test_bias_file_invalid();
+}
+
+TEST_F(ImuManagerTester, DeltaConing) {
+    this->delta_coning();
+}
+
+TEST_F(ImuManagerTester, DeltaSculling) {
+    this->delta_sculling();
+}
+
+TEST_F(ImuManagerTester, NominalDeltaFifo) {
+    this->nominal_boot_sequence();
+    this->set_acquisition_mode(AcquisitionMode::FIFO);
+    this->fifo_configure_sequence();
+    // Default 1 kHz samples integrated into 20 ms output intervals, carried across bursts
+    const U32 period = ImuManager::sample_period_us(this->sampleRateDivider, this->dlpfBandwidth);
+    const U32 samples = 20000 / period;
+    for (U32 overflow = 0; overflow < 2; overflow++) {
+        this->delta_reference(period, 0);
+        const U32 deltasBefore = this->deltasOut;
+        U32 frames = 0;
+        U32 randomValue = STest::Pick::lowerUpper(1, 20);
+        for (U32 i = 0; i < randomValue; i++) {
+            this->fifoCount = static_cast<U16>(STest::Pick::lowerUpper(0, FIFO_SIZE - 1));
+            frames += this->fifoCount / FIFO_FRAME_LENGTH;
+            this->fifo_tick();
+            ASSERT_EQ(this->deltasOut - deltasBefore, frames / samples);
+        }
+        if (this->deltasOut > deltasBefore) {
+            ASSERT_EQ(this->delta.get_samples(), samples);
+            ASSERT_EQ(this->delta.get_duration(), samples * period);
+        }
+        // Samples dropped by an overflow restart the interval
+        this->fifoCount = FIFO_SIZE;
+        this->tick();
+        ASSERT_EVENTS_FifoOverflow_SIZE(1);
+        this->verify_state_and_clear(ImuManagerTester::State::FIFO_COUNT);
+    }
+}
+
+TEST_F(ImuManagerTester, NominalDeltaRegister) {
+    this->nominal_boot_sequence();
+    this->reconfigure_sequence();
+    this->set_delta_period(DELTA_PERIOD_MS);
+    // The first read after the configuration only starts the period of the next
+    this->delta_reference(DELTA_TICK_US, 1);
+    this->delta_register_sequence(STest::Pick::lowerUpper(10, 30));
+    // A gap discards the interval, and the read ending it starts the next
+    this->delta_reference(DELTA_TICK_US, 1);
+    this->advance_time(DELTA_MAX_GAP_US);
+    this->delta_register_sequence(STest::Pick::lowerUpper(10, 30));
+    // A zero period disables the output
+    this->set_delta_period(0);
+    const U32 deltasBefore = this->deltasOut;
+    for (U32 i = 0; i < 10; i++) {
+        this->advance_time(DELTA_TICK_US);
+        this->tick();
+        ASSERT_TLM_DeltaIncrement_SIZE(0);
+        this->verify_state_and_clear(ImuManagerTester::State::RUN);
+    }
+    ASSERT_EQ(this->deltasOut, deltasBefore);
+}
+
+TEST_F(ImuManagerTester, NominalDeltaLateTick) {
+    this->nominal_boot_sequence();
+    this->reconfigure_sequence();
+    this->set_delta_period(500);
+    // Reads a 10 Hz tick apart are checked by count and duration rather than against the reference
+    this->delta_reference(0, 0);
+    this->advance_time(100000);
+    this->tick();
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+    // One tick is delivered late and the next early, neither is a gap
+    const U32 deltasBefore = this->deltasOut;
+    const U32 periods[] = {100000, 100000, 103000, 97000, 100000};
+    for (const U32 period : periods) {
+        this->advance_time(period);
+        this->tick();
+        ASSERT_TLM_Reading_SIZE(1);
+        this->verify_state_and_clear(ImuManagerTester::State::RUN);
+    }
+    ASSERT_EQ(this->deltasOut, deltasBefore + 1);
+    ASSERT_EQ(this->delta.get_samples(), 5);
+    ASSERT_EQ(this->delta.get_duration(), 500000);
+}
+
+TEST_F(ImuManagerTester, WindowStatisticsAccuracy) {
+    this->window_statistics_accuracy();
+}
+
+TEST_F(ImuManagerTester, AllanWhiteNoise) {
+    this->allan_white_noise();
+}
+
+TEST_F(ImuManagerTester, AllanRamp) {
+    this->allan_ramp();
+}
+
+TEST_F(ImuManagerTester, StatisticsBenchmark) {
+    this->statistics_benchmark();
+}
+
+TEST_F(ImuManagerTester, NominalStatistics) {
+    // Parameters are read as each window starts, the first on the first tick
+    this->paramSet_STATISTICS_WINDOW(STATISTICS_WINDOW_MS, Fw::ParamValid::VALID);
+    this->paramSend_STATISTICS_WINDOW(0, 0);
+    this->paramSet_ALLAN_ENABLED(true, Fw::ParamValid::VALID);
+    this->paramSend_ALLAN_ENABLED(0, 0);
+    ASSERT_EVENTS_SIZE(0);
+    this->nominal_boot_sequence();
+    this->reconfigure_sequence();
+    this->statistics_sequence(STest::Pick::lowerUpper(1, 5));
+    // Disabling takes effect once the current window is reported
+    this->paramSet_STATISTICS_WINDOW(0, Fw::ParamValid::VALID);
+    this->paramSend_STATISTICS_WINDOW(0, 0);
+    this->statistics_sequence(1);
+    for (U32 i = 0; i < 20; i++) {
+        this->advance_time(STATISTICS_TICK_US);
+        this->tick();
+        ASSERT_TLM_AccelerationStatistics_SIZE(0);
+        ASSERT_TLM_AllanDeviation_SIZE(0);
+        this->verify_state_and_clear(ImuManagerTester::State::RUN);
+    }
+}
+
+TEST_F(ImuManagerTester, RegisterShadowRuns) {
+    this->register_shadow_runs();
+}
+
+TEST_F(ImuManagerTester, RegisterDirtyWrites) {
+    this->register_dirty_writes();
+}
+
+TEST_F(ImuManagerTester, RegisterVerification) {
+    this->register_verification(AcquisitionMode::REGISTER);
+}
+
+TEST_F(ImuManagerTester, RegisterVerificationFifo) {
+    this->register_verification(AcquisitionMode::FIFO);
+}
+
+TEST_F(ImuManagerTester, SynchronousRead) {
+    this->synchronous_read(true);
+}
+
+TEST_F(ImuManagerTester, QueuedRead) {
+    this->synchronous_read(false);
+}
+
+TEST_F(ImuManagerTester, SynchronousReadBenchmark) {
+    this->synchronous_read_benchmark();
+}
+
 }  // namespace MpuImu
 int main(int argc, char** argv) {
     STest::Random::seed();
@@ -5,6 +5,12 @@
 // ======================================================================
 
 #include "ImuManagerTester.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <utility>
+#include "Os/File.hpp"
+#include "Os/FileSystem.hpp"
 #include "STest/Pick/Pick.hpp"
 
 namespace MpuImu {
@@ -19,6 +25,11 @@ ImuManagerTester ::ImuManagerTester()
       state(ImuManagerTester::State::RESET) {
     this->initComponents();
     this->connectPorts();
+    this->reset_registers();
+    std::swap(this->registers, this->secondaryRegisters);
+    this->reset_registers();
+    // Verification reads are only expected by the register verification tests
+    this->set_verify_period(0);
 }
 
 ImuManagerTester ::~ImuManagerTester() {}
@@ -27,6 +38,11 @@ void ImuManagerTester ::tick() {
     this->invoke_to_run(0, 0);
 }
 
+void ImuManagerTester ::data_ready() {
+    Os::RawTime cycleStart;
+    this->invoke_to_dataReady(0, cycleStart);
+}
+
 void ImuManagerTester ::nominal_boot_sequence() {
     // Initial tick moves into RESET state
     this->tick();
@@ -52,13 +68,14 @@ void ImuManagerTester ::nominal_boot_sequence() {
     this->tick();
     ASSERT_from_busWrite_SIZE(1);
     ASSERT_from_busWriteRead_SIZE(0);
-    this->verify_state_and_clear(ImuManagerTester::State::CONFIGURE_ACCELEROMETER);
+    this->verify_state_and_clear(ImuManagerTester::State::CONFIGURE);
 }
 
 void ImuManagerTester ::reconfigure_sequence() {
-    // Trigger configuration, will end in RUN state
+    // Trigger configuration of the registers the device does not hold, will end in RUN state
     this->tick();
-    ASSERT_from_busWrite_SIZE(2);
+    ASSERT_from_busWriteRead_SIZE(0);
+    this->verify_sample_rate();
     this->verify_state_and_clear(ImuManagerTester::State::RUN);
 }
 
@@ -70,10 +87,212 @@ void ImuManagerTester ::nominal_run_sequence() {
         ASSERT_from_busWriteRead_SIZE(1);
         ASSERT_TLM_Reading_SIZE(1);
         ASSERT_TLM_Reading(0, this->imuData);
+        // A single device is not voted on
+        ASSERT_TLM_VoteStatus_SIZE(0);
+        ASSERT_from_votedOut_SIZE(0);
         this->verify_state_and_clear(ImuManagerTester::State::RUN);
     }
 }
 
+void ImuManagerTester ::dual_boot_sequence() {
+    this->component.configure(DEVICE_DEFAULT_ADDRESS, DEVICE_SECONDARY_ADDRESS);
+
+    // Both devices reset on the first tick, the primary first
+    this->tick();
+    ASSERT_from_busWrite_SIZE(2);
+    ASSERT_EQ(this->fromPortHistory_busWrite->at(0).addr, DEVICE_DEFAULT_ADDRESS);
+    ASSERT_EQ(this->fromPortHistory_busWrite->at(1).addr, DEVICE_SECONDARY_ADDRESS);
+    ASSERT_EVENTS_I2cError_SIZE(0);
+    ASSERT_TLM_VoteStatus_SIZE(1);
+    ASSERT_TLM_VoteStatus(0, ImuVoteStatus::NO_DATA);
+    ASSERT_EQ(this->secondaryState, ImuManagerTester::State::WAIT_RESET);
+    this->verify_state_and_clear(ImuManagerTester::State::WAIT_RESET);
+
+    // Finish both resets, then power on
+    this->state = ImuManagerTester::State::WAIT_RESET_FINISH;
+    this->secondaryState = ImuManagerTester::State::WAIT_RESET_FINISH;
+    this->tick();
+    ASSERT_from_busWriteRead_SIZE(2);
+    ASSERT_EQ(this->secondaryState, ImuManagerTester::State::POWER_ON);
+    this->verify_state_and_clear(ImuManagerTester::State::POWER_ON);
+    this->tick();
+    ASSERT_from_busWrite_SIZE(2);
+    ASSERT_EQ(this->secondaryState, ImuManagerTester::State::CONFIGURE);
+    this->verify_state_and_clear(ImuManagerTester::State::CONFIGURE);
+
+    // Both configure on the same tick, only the filter bandwidth differs from the reset values. The sample rate is
+    // reported for the primary alone.
+    this->tick();
+    ASSERT_from_busWrite_SIZE(2);
+    ASSERT_TLM_SampleRate_SIZE(1);
+    ASSERT_EQ(this->secondaryState, ImuManagerTester::State::RUN);
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+}
+
+void ImuManagerTester ::dual_run_sequence(I16 offset, ImuVoteStatus status) {
+    this->secondaryOffset = offset;
+    this->samplesOut = 0;
+    this->tick();
+    // Reads are interleaved within the tick, primary then secondary
+    ASSERT_from_busWriteRead_SIZE(2);
+    ASSERT_EQ(this->fromPortHistory_busWriteRead->at(0).addr, DEVICE_DEFAULT_ADDRESS);
+    ASSERT_EQ(this->fromPortHistory_busWriteRead->at(1).addr, DEVICE_SECONDARY_ADDRESS);
+    ASSERT_EQ(this->samplesOut, 2);
+    ASSERT_TLM_Reading_SIZE(1);
+    ASSERT_TLM_Reading(0, this->imuData);
+    ASSERT_TLM_SecondaryReading_SIZE(1);
+    ASSERT_TLM_SecondaryReading(0, this->secondaryImuData);
+    ASSERT_TLM_VoteStatus_SIZE(1);
+    ASSERT_TLM_VoteStatus(0, status);
+    ASSERT_TLM_VotedReading_SIZE(1);
+    if (offset == 0) {
+        // Identical readings vote to themselves
+        ASSERT_TLM_VotedReading(0, this->imuData);
+    }
+    if (status == ImuVoteStatus::DISAGREE) {
+        this->voteDisagreements++;
+        ASSERT_from_votedOut_SIZE(0);
+        ASSERT_EVENTS_VoteDisagreement_SIZE(1);
+        ASSERT_TLM_VoteDisagreements_SIZE(1);
+        ASSERT_TLM_VoteDisagreements(0, this->voteDisagreements);
+    } else {
+        ASSERT_from_votedOut_SIZE(1);
+        ASSERT_EQ(this->fromPortHistory_votedOut->at(0).data, this->tlmHistory_VotedReading->at(0).arg);
+        ASSERT_EVENTS_VoteDisagreement_SIZE(0);
+    }
+    ASSERT_EQ(this->secondaryState, ImuManagerTester::State::RUN);
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+}
+
+void ImuManagerTester ::set_acquisition_mode(AcquisitionMode mode) {
+    this->acquisitionMode = mode;
+    this->paramSet_ACQUISITION_MODE(mode, Fw::ParamValid::VALID);
+    this->paramSend_ACQUISITION_MODE(0, 0);
+    ASSERT_EVENTS_AcquisitionModeUpdated_SIZE(1);
+    ASSERT_EVENTS_AcquisitionModeUpdated(0, mode);
+    this->clearHistory();
+}
+
+void ImuManagerTester ::expect_configure() {
+    this->state = this->configured() ? this->configured_state() : ImuManagerTester::State::CONFIGURE;
+}
+
+void ImuManagerTester ::fifo_configure_sequence() {
+    // The FIFO reset, then the changed registers including the FIFO enables
+    this->tick();
+    ASSERT_from_busWriteRead_SIZE(0);
+    ASSERT_TRUE(this->fifo_enabled());
+    this->verify_sample_rate();
+    this->verify_state_and_clear(ImuManagerTester::State::FIFO_COUNT);
+}
+
+void ImuManagerTester ::interrupt_configure_sequence() {
+    // The changed registers, including the interrupt pin configuration and enable
+    this->tick();
+    ASSERT_from_busWriteRead_SIZE(0);
+    ASSERT_TRUE(this->interrupt_enabled());
+    this->verify_sample_rate();
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+}
+
+void ImuManagerTester ::interrupt_run_sequence() {
+    U32 randomValue = STest::Pick::lowerUpper(1, 20);
+    for (FwSizeType i = 0; i < static_cast<FwSizeType>(randomValue); i++) {
+        // Ticks do not read
+        this->advance_time(INTERRUPT_TICK_US);
+        this->tick();
+        ASSERT_TLM_Reading_SIZE(0);
+        ASSERT_EVENTS_SIZE(0);
+        this->verify_state_and_clear(ImuManagerTester::State::RUN);
+        // Each edge reads exactly one sample
+        const U32 edges = STest::Pick::lowerUpper(1, 5);
+        for (U32 edge = 0; edge < edges; edge++) {
+            this->advance_time(STest::Pick::lowerUpper(1, INTERRUPT_TICK_US / 5));
+            this->samplesOut = 0;
+            this->data_ready();
+            ASSERT_from_busWriteRead_SIZE(1);
+            ASSERT_from_busWrite_SIZE(0);
+            ASSERT_EQ(this->samplesOut, 1);
+            ASSERT_TLM_Reading_SIZE(1);
+            ASSERT_TLM_Reading(0, this->imuData);
+            ASSERT_EQ(this->tlmHistory_Reading->at(0).time, this->m_testTime);
+            this->verify_state_and_clear(ImuManagerTester::State::RUN);
+        }
+    }
+}
+
+void ImuManagerTester ::fifo_run_sequence() {
+    U32 randomValue = STest::Pick::lowerUpper(1, 20);
+    for (FwSizeType i = 0; i < static_cast<FwSizeType>(randomValue); i++) {
+        this->fifoCount = static_cast<U16>(STest::Pick::lowerUpper(0, FIFO_SIZE - 1));
+        this->fifo_tick();
+    }
+}
+
+void ImuManagerTester ::fifo_tick() {
+    const U32 frames = this->fifoCount / FIFO_FRAME_LENGTH;
+    const U32 deltasBefore = this->deltasOut;
+    this->samplesOut = 0;
+    this->pick_time();
+    this->tick();
+    // Count read, then the burst and temperature when at least one whole frame is available
+    ASSERT_from_busWriteRead_SIZE((frames > 0) ? 3 : 1);
+    ASSERT_from_busWrite_SIZE(0);
+    ASSERT_EQ(this->samplesOut, frames);
+    ASSERT_TLM_FifoSamples_SIZE(1);
+    ASSERT_TLM_FifoSamples(0, frames);
+    if (frames > 0) {
+        ASSERT_EQ(this->fifoFrames, frames);
+        ASSERT_TLM_Reading_SIZE(1);
+        ASSERT_TLM_Reading(0, this->fifoSamples[frames - 1]);
+    } else {
+        ASSERT_TLM_Reading_SIZE(0);
+    }
+    // Only the newest of the output intervals ending in the burst goes to telemetry
+    if (this->deltasOut > deltasBefore) {
+        ASSERT_TLM_DeltaIncrement_SIZE(1);
+        ASSERT_TLM_DeltaIncrement(0, this->delta);
+    } else {
+        ASSERT_TLM_DeltaIncrement_SIZE(0);
+    }
+    ASSERT_EVENTS_SIZE(0);
+    this->verify_state_and_clear(ImuManagerTester::State::FIFO_COUNT);
+}
+
+void ImuManagerTester ::pick_sample_rate() {
+    this->sampleRateDivider = static_cast<U8>(STest::Pick::lowerUpper(0, 0xFF));
+    this->dlpfBandwidth = static_cast<DlpfBandwidth::T>(STest::Pick::lowerUpper(0, DlpfBandwidth::NUM_CONSTANTS - 1));
+    this->paramSet_SAMPLE_RATE_DIVIDER(this->sampleRateDivider, Fw::ParamValid::VALID);
+    this->paramSend_SAMPLE_RATE_DIVIDER(0, 0);
+    this->paramSet_DLPF_BANDWIDTH(this->dlpfBandwidth, Fw::ParamValid::VALID);
+    this->paramSend_DLPF_BANDWIDTH(0, 0);
+    ASSERT_EVENTS_SampleRateDividerUpdated_SIZE(1);
+    ASSERT_EVENTS_SampleRateDividerUpdated(0, this->sampleRateDivider);
+    ASSERT_EVENTS_DlpfBandwidthUpdated_SIZE(1);
+    ASSERT_EVENTS_DlpfBandwidthUpdated(0, this->dlpfBandwidth);
+    this->clearHistory();
+}
+
+void ImuManagerTester ::pick_time() {
+    this->setTestTime(Fw::Time(TimeBase::TB_PROC_TIME, 0, STest::Pick::lowerUpper(0, 1000),
+                               STest::Pick::lowerUpper(0, 999999)));
+}
+
+void ImuManagerTester ::advance_time(U32 us) {
+    const U64 timeUs =
+        (static_cast<U64>(this->m_testTime.getSeconds()) * 1000000) + this->m_testTime.getUSeconds() + us;
+    this->setTestTime(Fw::Time(TimeBase::TB_PROC_TIME, 0, static_cast<U32>(timeUs / 1000000),
+                               static_cast<U32>(timeUs % 1000000)));
+}
+
+void ImuManagerTester ::verify_sample_rate() {
+    // Output rate of 8 kHz with the filter off, 1 kHz otherwise, over 1 + divider
+    const F32 outputRate = (this->dlpfBandwidth == DlpfBandwidth::BANDWIDTH_260HZ) ? 8000.0f : 1000.0f;
+    const F32 sampleRate = outputRate / (static_cast<F32>(this->sampleRateDivider) + 1.0f);
+    ASSERT_TLM_SampleRate_SIZE(1);
+    ASSERT_NEAR(this->tlmHistory_SampleRate->at(0).arg, sampleRate, sampleRate * 1.0e-6f);
+}
+
 void ImuManagerTester ::verify_register_write(U8 registerAddress, U8 registerValue, Fw::Buffer& writeBuffer) {
     ASSERT_EQ(writeBuffer.getSize(), 2);
     ASSERT_EQ(writeBuffer.getData()[0], registerAddress);
@@ -138,6 +357,846 @@ void ImuManagerTester ::pick_gyroscope_range() {
     this->paramSend_GYROSCOPE_RANGE(0, 0);
 }
 
+void ImuManagerTester ::batch_conversion(ImuBatchConverter::RecordFormat format, U32 count) {
+    FW_ASSERT(count <= BATCH_MAX_RECORDS, static_cast<FwAssertArgType>(count));
+    this->pick_acceleration_range();
+    this->pick_gyroscope_range();
+    this->fill_batch_records(count * static_cast<U32>(format));
+    ImuBatchConverter converter;
+    converter.configure(this->accelerationRange, this->gyroscopeRange);
+
+    // Both paths remove a random bias identically
+    F32 accelerationBias[3];
+    F32 rotationBias[3];
+    for (U32 axis = 0; axis < 3; axis++) {
+        accelerationBias[axis] = static_cast<F32>(STest::Pick::lowerUpper(0, 4000)) * 1.0e-4f - 0.2f;
+        rotationBias[axis] = static_cast<F32>(STest::Pick::lowerUpper(0, 6000)) * 1.0e-2f - 30.0f;
+    }
+    converter.set_bias(accelerationBias, rotationBias);
+    // Both outputs start identical so entries neither path writes also compare equal
+    ::memset(this->batchOutput, 0xA5, sizeof(this->batchOutput));
+    converter.convert(this->batchRecords, count, format, this->batch_arrays(0));
+    converter.convert_scalar(this->batchRecords, count, format, this->batch_arrays(1));
+    ASSERT_EQ(::memcmp(this->batchOutput[0], this->batchOutput[1], sizeof(this->batchOutput[0])), 0);
+
+    // Without a bias the conversion is exactly the per-sample one
+    const F32 noBias[3] = {0.0f, 0.0f, 0.0f};
+    converter.set_bias(noBias, noBias);
+    converter.convert_scalar(this->batchRecords, count, format, this->batch_arrays(1));
+
+    const U32 rotation = (format == ImuBatchConverter::REGISTER_RECORD) ? 4 : 3;
+    for (U32 i = 0; i < count; i++) {
+        Fw::Buffer record(&this->batchRecords[i * static_cast<U32>(format)], static_cast<U32>(format));
+        auto deserializer = record.getDeserializer();
+        I16 words[DATA_LENGTH / sizeof(I16)] = {};
+        for (U32 word = 0; word < static_cast<U32>(format) / sizeof(I16); word++) {
+            deserializer.deserialize(words[word]);
+        }
+        RawImuData raw;
+        for (U32 axis = 0; axis < 3; axis++) {
+            raw.acceleration[axis] = words[axis];
+            raw.gyroscope[axis] = words[rotation + axis];
+        }
+        raw.temperature = words[3];
+        ImuData expected = ImuManager::convert_raw_data(raw, this->accelerationRange, this->gyroscopeRange);
+        const F32 channels[7] = {expected.get_acceleration().get_x(), expected.get_acceleration().get_y(),
+                                 expected.get_acceleration().get_z(), expected.get_rotation().get_x(),
+                                 expected.get_rotation().get_y(),     expected.get_rotation().get_z(),
+                                 expected.get_temperature()};
+        const U32 checked = (format == ImuBatchConverter::REGISTER_RECORD) ? 7 : 6;
+        for (U32 channel = 0; channel < checked; channel++) {
+            ASSERT_EQ(::memcmp(&channels[channel], &this->batchOutput[1][channel][i], sizeof(F32)), 0)
+                << "record " << i << " channel " << channel;
+        }
+    }
+}
+
+F64 ImuManagerTester ::batch_conversion_rate(BatchPath path, ImuBatchConverter::RecordFormat format) {
+    // Per-sample conversion deserializes whole data register blocks
+    FW_ASSERT((path != PER_SAMPLE) || (format == ImuBatchConverter::REGISTER_RECORD));
+    this->fill_batch_records(FIFO_MAX_FRAMES * static_cast<U32>(format));
+    ImuBatchConverter converter;
+    converter.configure(this->accelerationRange, this->gyroscopeRange);
+    const ImuBatchArrays arrays = this->batch_arrays(0);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (U32 pass = 0; pass < BATCH_BENCHMARK_PASSES; pass++) {
+        switch (path) {
+            case PER_SAMPLE:
+                for (U32 i = 0; i < FIFO_MAX_FRAMES; i++) {
+                    Fw::Buffer record(&this->batchRecords[i * DATA_LENGTH], DATA_LENGTH);
+                    RawImuData raw = this->component.deserialize_raw_data(record);
+                    ImuData sample = ImuManager::convert_raw_data(raw, this->accelerationRange, this->gyroscopeRange);
+                    this->batchSink += sample.get_acceleration().get_x();
+                }
+                break;
+            case SCALAR:
+                converter.convert_scalar(this->batchRecords, FIFO_MAX_FRAMES, format, arrays);
+                this->batchSink += arrays.acceleration[0][pass % FIFO_MAX_FRAMES];
+                break;
+            case BATCH:
+                converter.convert(this->batchRecords, FIFO_MAX_FRAMES, format, arrays);
+                this->batchSink += arrays.acceleration[0][pass % FIFO_MAX_FRAMES];
+                break;
+        }
+    }
+    const F64 seconds = std::chrono::duration<F64>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<F64>(BATCH_BENCHMARK_PASSES) * FIFO_MAX_FRAMES / seconds;
+}
+
+void ImuManagerTester ::fill_batch_records(U32 size) {
+    FW_ASSERT(size <= sizeof(this->batchRecords), static_cast<FwAssertArgType>(size));
+    for (U32 i = 0; i < size; i++) {
+        this->batchRecords[i] = static_cast<U8>(STest::Pick::lowerUpper(0, 0xFF));
+    }
+}
+
+ImuBatchArrays ImuManagerTester ::batch_arrays(U32 output) {
+    FW_ASSERT(output < 2, static_cast<FwAssertArgType>(output));
+    F32(&channels)[7][BATCH_MAX_RECORDS] = this->batchOutput[output];
+    return {{channels[0], channels[1], channels[2]}, {channels[3], channels[4], channels[5]}, channels[6]};
+}
+
+void ImuManagerTester ::bias_estimator_stability() {
+    // Summing squares in F64 would cancel away the whole variance at this offset over this many samples
+    const U32 count = 1000000;
+    BiasEstimator estimator;
+    for (U32 i = 0; i < count; i++) {
+        F32 sample[BiasEstimator::CHANNELS];
+        for (U32 channel = 0; channel < BiasEstimator::CHANNELS; channel++) {
+            sample[channel] = 1.0e6f + static_cast<F32>(channel) + (((i % 2) == 0) ? -1.0f : 1.0f);
+        }
+        estimator.add(sample);
+    }
+    ASSERT_EQ(estimator.count(), count);
+    for (U32 channel = 0; channel < BiasEstimator::CHANNELS; channel++) {
+        ASSERT_NEAR(estimator.mean(channel), 1.0e6 + channel, 1.0e-6);
+        ASSERT_NEAR(estimator.variance(channel), static_cast<F64>(count) / (count - 1), 1.0e-9);
+    }
+    estimator.reset();
+    ASSERT_EQ(estimator.count(), 0);
+    ASSERT_EQ(estimator.variance(0), 0.0);
+}
+
+void ImuManagerTester ::delta_coning() {
+    // Body axes coning about z at half angle 0.02 rad and 25 Hz, sampled at 1 kHz into 20 ms intervals. The body rate
+    // is (-W sin(a) sin(Wt), W sin(a) cos(Wt), -W (1 - cos(a))), so each sample increment is integrated exactly.
+    const F64 halfAngle = 0.01;
+    const F64 coneAngle = 2.0 * halfAngle;
+    const F64 frequency = 2.0 * M_PI * 25.0;
+    const F64 dt = 1.0e-3;
+    const U32 samples = 20;
+    DeltaIntegrator integrator;
+    F64 t = 0.0123;
+    for (U32 interval = 0; interval < 10; interval++) {
+        const F64 start = t;
+        F64 sum[3] = {0.0, 0.0, 0.0};
+        for (U32 i = 0; i < samples; i++) {
+            const F64 increment[3] = {
+                std::sin(coneAngle) * (std::cos(frequency * (t + dt)) - std::cos(frequency * t)),
+                std::sin(coneAngle) * (std::sin(frequency * (t + dt)) - std::sin(frequency * t)),
+                -frequency * (1.0 - std::cos(coneAngle)) * dt};
+            F32 rotation[3];
+            const F32 acceleration[3] = {0.0f, 0.0f, 0.0f};
+            for (U32 axis = 0; axis < 3; axis++) {
+                rotation[axis] = static_cast<F32>(increment[axis] / dt / DeltaIntegrator::RADIANS_PER_DEGREE);
+                sum[axis] += static_cast<F64>(rotation[axis]) * DeltaIntegrator::RADIANS_PER_DEGREE * dt;
+            }
+            integrator.add(rotation, acceleration, 1000);
+            t += dt;
+        }
+        ASSERT_EQ(integrator.samples(), samples);
+        ASSERT_EQ(integrator.duration_us(), samples * 1000);
+
+        // Attitude is q(t) = (cos(a), sin(a) cos(Wt), sin(a) sin(Wt), 0), the interval rotation is q(start)* q(t)
+        const F64 s0 = std::sin(halfAngle);
+        const F64 c0 = std::cos(halfAngle);
+        const F64 q0[4] = {c0, -s0 * std::cos(frequency * start), -s0 * std::sin(frequency * start), 0.0};
+        const F64 q1[4] = {c0, s0 * std::cos(frequency * t), s0 * std::sin(frequency * t), 0.0};
+        const F64 relative[4] = {(q0[0] * q1[0]) - (q0[1] * q1[1]) - (q0[2] * q1[2]) - (q0[3] * q1[3]),
+                                 (q0[0] * q1[1]) + (q0[1] * q1[0]) + (q0[2] * q1[3]) - (q0[3] * q1[2]),
+                                 (q0[0] * q1[2]) - (q0[1] * q1[3]) + (q0[2] * q1[0]) + (q0[3] * q1[1]),
+                                 (q0[0] * q1[3]) + (q0[1] * q1[2]) - (q0[2] * q1[1]) + (q0[3] * q1[0])};
+        const F64 angle = 2.0 * std::acos(relative[0]);
+        F32 corrected[3];
+        integrator.delta_angle(corrected);
+        integrator.next_interval();
+        F64 correctedError = 0.0;
+        F64 sumError = 0.0;
+        for (U32 axis = 0; axis < 3; axis++) {
+            const F64 truth = relative[axis + 1] / std::sin(angle / 2.0) * angle;
+            correctedError += (corrected[axis] - truth) * (corrected[axis] - truth);
+            sumError += (sum[axis] - truth) * (sum[axis] - truth);
+        }
+        // The plain sum misses about 0.6 mrad of z rotation each interval, drifting in yaw
+        ASSERT_GT(std::sqrt(sumError), 5.0e-4);
+        ASSERT_LT(std::sqrt(correctedError), std::sqrt(sumError) / 50.0);
+    }
+}
+
+void ImuManagerTester ::delta_sculling() {
+    // Rolling at 0.05 rad and 30 Hz in phase with a 2 G lateral acceleration, sampled at 1 kHz into 20 ms intervals.
+    // The roll turns part of the acceleration onto z, rectifying into a velocity the plain sum misses.
+    const F64 roll = 0.05;
+    const F64 amplitude = 2.0;
+    const F64 frequency = 2.0 * M_PI * 30.0;
+    const F64 dt = 1.0e-3;
+    const U32 samples = 20;
+    const U32 steps = 100;
+    DeltaIntegrator integrator;
+    F64 t = 0.0037;
+    for (U32 interval = 0; interval < 10; interval++) {
+        const F64 startRoll = roll * std::sin(frequency * t);
+        F64 sum[3] = {0.0, 0.0, 0.0};
+        F64 truth[3] = {0.0, 0.0, 0.0};
+        for (U32 i = 0; i < samples; i++) {
+            const F64 angle = roll * (std::sin(frequency * (t + dt)) - std::sin(frequency * t));
+            const F64 velocity =
+                amplitude * DeltaIntegrator::STANDARD_GRAVITY * (std::cos(frequency * t) - std::cos(frequency * (t + dt))) /
+                frequency;
+            const F32 rotation[3] = {static_cast<F32>(angle / dt / DeltaIntegrator::RADIANS_PER_DEGREE), 0.0f, 0.0f};
+            const F32 acceleration[3] = {
+                0.0f, static_cast<F32>(velocity / dt / DeltaIntegrator::STANDARD_GRAVITY), 0.0f};
+            sum[1] += static_cast<F64>(acceleration[1]) * DeltaIntegrator::STANDARD_GRAVITY * dt;
+            integrator.add(rotation, acceleration, 1000);
+            // Specific force rotated into the body frame at the start of the interval, by fine midpoint integration
+            for (U32 step = 0; step < steps; step++) {
+                const F64 time = t + ((step + 0.5) * dt / steps);
+                const F64 force = amplitude * DeltaIntegrator::STANDARD_GRAVITY * std::sin(frequency * time);
+                const F64 turned = (roll * std::sin(frequency * time)) - startRoll;
+                truth[1] += force * std::cos(turned) * dt / steps;
+                truth[2] += force * std::sin(turned) * dt / steps;
+            }
+            t += dt;
+        }
+        F32 corrected[3];
+        integrator.delta_velocity(corrected);
+        integrator.next_interval();
+        F64 correctedError = 0.0;
+        F64 sumError = 0.0;
+        for (U32 axis = 0; axis < 3; axis++) {
+            correctedError += (corrected[axis] - truth[axis]) * (corrected[axis] - truth[axis]);
+            sumError += (sum[axis] - truth[axis]) * (sum[axis] - truth[axis]);
+        }
+        ASSERT_LT(std::sqrt(correctedError), std::sqrt(sumError) / 10.0);
+    }
+}
+
+void ImuManagerTester ::set_delta_period(U16 period) {
+    this->paramSet_DELTA_OUTPUT_PERIOD(period, Fw::ParamValid::VALID);
+    this->paramSend_DELTA_OUTPUT_PERIOD(0, 0);
+    ASSERT_EVENTS_DeltaOutputPeriodUpdated_SIZE(1);
+    ASSERT_EVENTS_DeltaOutputPeriodUpdated(0, period);
+    this->clearHistory();
+    this->expect_configure();
+    this->reconfigure_sequence();
+}
+
+void ImuManagerTester ::delta_reference(U32 periodUs, U32 skip) {
+    this->deltaIntegrator.reset();
+    this->deltaPeriodUs = periodUs;
+    this->deltaSkip = skip;
+}
+
+void ImuManagerTester ::delta_register_sequence(U32 ticks) {
+    const U32 reads = (DELTA_PERIOD_MS * 1000) / DELTA_TICK_US;
+    for (U32 i = 0; i < ticks; i++) {
+        const U32 deltasBefore = this->deltasOut;
+        const U32 integrated = this->deltaIntegrator.samples();
+        const bool skipped = (this->deltaSkip > 0);
+        this->advance_time(DELTA_TICK_US);
+        this->tick();
+        ASSERT_TLM_Reading_SIZE(1);
+        if (!skipped && ((integrated + 1) == reads)) {
+            ASSERT_EQ(this->deltasOut, deltasBefore + 1);
+            ASSERT_EQ(this->delta.get_samples(), reads);
+            ASSERT_EQ(this->delta.get_duration(), DELTA_PERIOD_MS * 1000);
+            ASSERT_TLM_DeltaIncrement_SIZE(1);
+            ASSERT_TLM_DeltaIncrement(0, this->delta);
+            ASSERT_EQ(this->tlmHistory_DeltaIncrement->at(0).time, this->m_testTime);
+        } else {
+            ASSERT_EQ(this->deltasOut, deltasBefore);
+            ASSERT_TLM_DeltaIncrement_SIZE(0);
+        }
+        this->verify_state_and_clear(ImuManagerTester::State::RUN);
+    }
+}
+
+void ImuManagerTester ::window_statistics_accuracy() {
+    const U32 count = 1000;
+    F32 samples[count][WindowStatistics::CHANNELS];
+    WindowStatistics window;
+    for (U32 i = 0; i < count; i++) {
+        for (U32 channel = 0; channel < WindowStatistics::CHANNELS; channel++) {
+            // Small noise around an offset, large on the gravity axis
+            const F32 noise = (static_cast<F32>(STest::Pick::lowerUpper(0, 2000000)) / 1.0e8f) - 0.01f;
+            samples[i][channel] = ((channel == 2) ? 1.0f : (0.1f * channel)) + noise;
+        }
+        window.add(samples[i]);
+    }
+    ASSERT_EQ(window.count(), count);
+    for (U32 channel = 0; channel < WindowStatistics::CHANNELS; channel++) {
+        F32 minimum = samples[0][channel];
+        F32 maximum = samples[0][channel];
+        F64 sum = 0.0;
+        F64 squares = 0.0;
+        for (U32 i = 0; i < count; i++) {
+            minimum = (samples[i][channel] < minimum) ? samples[i][channel] : minimum;
+            maximum = (samples[i][channel] > maximum) ? samples[i][channel] : maximum;
+            sum += samples[i][channel];
+            squares += static_cast<F64>(samples[i][channel]) * samples[i][channel];
+        }
+        const F64 mean = sum / count;
+        F64 squaredError = 0.0;
+        for (U32 i = 0; i < count; i++) {
+            squaredError += (samples[i][channel] - mean) * (samples[i][channel] - mean);
+        }
+        ASSERT_EQ(window.minimum(channel), minimum);
+        ASSERT_EQ(window.maximum(channel), maximum);
+        ASSERT_NEAR(window.mean(channel), mean, 1.0e-12);
+        ASSERT_NEAR(window.rms(channel), std::sqrt(squares / count), 1.0e-12);
+        ASSERT_NEAR(window.variance(channel), squaredError / (count - 1), 1.0e-15);
+    }
+    window.reset();
+    ASSERT_EQ(window.count(), 0);
+    ASSERT_EQ(window.rms(0), 0.0);
+    ASSERT_EQ(window.variance(0), 0.0);
+}
+
+void ImuManagerTester ::allan_white_noise() {
+    // White noise of variance s^2 averages down to s^2 / m over clusters of m samples
+    const U32 count = 400000;
+    AllanVariance allan;
+    for (U32 i = 0; i < count; i++) {
+        F32 sample[AllanVariance::CHANNELS];
+        for (U32 channel = 0; channel < AllanVariance::CHANNELS; channel++) {
+            const F32 noise = (static_cast<F32>(STest::Pick::lowerUpper(0, 2000000)) / 1.0e6f) - 1.0f;
+            sample[channel] = ((channel == 2) ? 1.0f : 0.0f) + (static_cast<F32>(channel + 1) * noise);
+        }
+        allan.add(sample);
+    }
+    for (U32 octave = 0; octave < AllanVariance::OCTAVES; octave++) {
+        const U32 cluster = 1U << octave;
+        ASSERT_EQ(allan.terms(octave), count - (2 * cluster) + 1);
+        // Fewer independent clusters at the longest octaves leave more spread in the estimate
+        const F64 tolerance = (octave < 8) ? 0.1 : 0.25;
+        for (U32 channel = 0; channel < AllanVariance::CHANNELS; channel++) {
+            const F64 expected = ((channel + 1.0) * (channel + 1.0) / 3.0) / cluster;
+            ASSERT_NEAR(allan.variance(octave, channel) / expected, 1.0, tolerance) << octave << " " << channel;
+        }
+    }
+}
+
+void ImuManagerTester ::allan_ramp() {
+    // A ramp of r per sample moves the cluster average r * m between adjacent clusters of m samples
+    const U32 decimation = 4;
+    const U32 count = 8000;
+    AllanVariance allan;
+    allan.set_decimation(decimation);
+    for (U32 segment = 0; segment < 2; segment++) {
+        for (U32 i = 0; i < count; i++) {
+            F32 sample[AllanVariance::CHANNELS];
+            for (U32 channel = 0; channel < AllanVariance::CHANNELS; channel++) {
+                sample[channel] = (100.0f * segment) + (1.0e-4f * (channel + 1) * i);
+            }
+            allan.add(sample);
+        }
+        // The step to the next segment would dominate every octave without the restart
+        allan.restart();
+    }
+    const U32 points = count / decimation;
+    for (U32 octave = 0; octave < AllanVariance::OCTAVES; octave++) {
+        const U32 cluster = 1U << octave;
+        ASSERT_EQ(allan.terms(octave), 2 * (points - (2 * cluster) + 1));
+        for (U32 channel = 0; channel < AllanVariance::CHANNELS; channel++) {
+            const F64 step = 1.0e-4 * (channel + 1) * decimation * cluster;
+            ASSERT_NEAR(allan.variance(octave, channel) / (step * step / 2.0), 1.0, 1.0e-3) << octave << " " << channel;
+        }
+    }
+    // The same decimation keeps the terms, a zero decimation is one sample and discards them
+    allan.set_decimation(decimation);
+    ASSERT_GT(allan.terms(0), 0);
+    allan.set_decimation(0);
+    ASSERT_EQ(allan.decimation(), 1);
+    ASSERT_EQ(allan.terms(0), 0);
+}
+
+void ImuManagerTester ::statistics_benchmark() {
+    WindowStatistics window;
+    AllanVariance allan;
+    F32 sample[WindowStatistics::CHANNELS] = {0.01f, -0.02f, 1.0f, 0.3f, -0.4f, 0.5f};
+    const auto start = std::chrono::steady_clock::now();
+    for (U32 i = 0; i < STATISTICS_BENCHMARK_SAMPLES; i++) {
+        sample[0] = ((i % 2) == 0) ? 0.01f : -0.01f;
+        window.add(sample);
+        allan.add(sample);
+    }
+    const F64 ns = std::chrono::duration<F64, std::nano>(std::chrono::steady_clock::now() - start).count() /
+                   STATISTICS_BENCHMARK_SAMPLES;
+    ASSERT_EQ(window.count(), STATISTICS_BENCHMARK_SAMPLES);
+    ASSERT_GT(allan.variance(0, 0), 0.0);
+    // Under a microsecond leaves the FIFO drain of 85 samples per tick well within its budget
+    ::printf("[ BENCHMARK ] Statistics and Allan variance: %.1f ns per sample, %.4f%% of a 1 kHz sample period\n", ns,
+             ns / 1.0e4);
+}
+
+void ImuManagerTester ::statistics_sequence(U32 windows) {
+    const U32 reads = (STATISTICS_WINDOW_MS * 1000) / STATISTICS_TICK_US;
+    for (U32 window = 0; window < windows; window++) {
+        for (U32 read = 1; read <= reads; read++) {
+            this->advance_time(STATISTICS_TICK_US);
+            this->tick();
+            ASSERT_TLM_Reading_SIZE(1);
+            const F32 sample[WindowStatistics::CHANNELS] = {
+                this->imuData.get_acceleration().get_x(), this->imuData.get_acceleration().get_y(),
+                this->imuData.get_acceleration().get_z(), this->imuData.get_rotation().get_x(),
+                this->imuData.get_rotation().get_y(),     this->imuData.get_rotation().get_z()};
+            this->statistics.add(sample);
+            if (read < reads) {
+                ASSERT_TLM_AccelerationStatistics_SIZE(0);
+                ASSERT_TLM_AllanDeviation_SIZE(0);
+            } else {
+                // The window closes after the read of the tick it elapses on
+                ASSERT_TLM_AccelerationStatistics_SIZE(1);
+                ASSERT_TLM_AccelerationStatistics(0, ImuManager::vector_statistics(this->statistics, 0));
+                ASSERT_TLM_RotationStatistics_SIZE(1);
+                ASSERT_TLM_RotationStatistics(0, ImuManager::vector_statistics(this->statistics, 3));
+                ASSERT_EQ(this->tlmHistory_AccelerationStatistics->at(0).arg.get_samples(), reads);
+                // Register reads are a tick apart, whatever the sample rate of the device
+                ASSERT_TLM_AllanDeviation_SIZE(1);
+                ASSERT_EQ(this->tlmHistory_AllanDeviation->at(0).arg.get_clusterTime(), STATISTICS_TICK_US);
+                this->statistics.reset();
+            }
+            this->verify_state_and_clear(ImuManagerTester::State::RUN);
+        }
+    }
+}
+
+void ImuManagerTester ::register_shadow_runs() {
+    // A shadow of unknown registers writes the whole configuration in one transaction per contiguous group
+    {
+        RegisterShadow shadow;
+        const U8 firsts[] = {0x13, 0x23, 0x37, 0x6A};
+        const U32 counts[] = {10, 1, 2, 2};
+        U32 start = RegisterShadow::FIRST_REGISTER;
+        U8 first = 0;
+        U32 count = 0;
+        for (U32 run = 0; run < 4; run++) {
+            ASSERT_TRUE(shadow.next_run(start, first, count));
+            ASSERT_EQ(first, firsts[run]);
+            ASSERT_EQ(count, counts[run]);
+            shadow.confirm(first, count);
+            start = first + count;
+        }
+        ASSERT_FALSE(shadow.next_run(start, first, count));
+        ASSERT_FALSE(shadow.next_run(RegisterShadow::FIRST_REGISTER, first, count));
+    }
+    for (U32 trial = 0; trial < 1000; trial++) {
+        RegisterShadow shadow;
+        shadow.reset();
+        bool dirty[RegisterShadow::BLOCK_SIZE] = {};
+        for (U32 i = 0; i < RegisterShadow::BLOCK_SIZE; i++) {
+            const U8 registerAddress = static_cast<U8>(RegisterShadow::FIRST_REGISTER + i);
+            if (!RegisterShadow::tracked(registerAddress) || (STest::Pick::lowerUpper(0, 1) == 0)) {
+                continue;
+            }
+            // Some are set to the value they already hold, and some written registers become unknown
+            const U8 value = static_cast<U8>(STest::Pick::lowerUpper(0, 3));
+            shadow.set(registerAddress, value);
+            dirty[i] = (value != RegisterShadow::reset_value(registerAddress));
+            if (STest::Pick::lowerUpper(0, 9) == 0) {
+                shadow.forget(registerAddress, 1);
+                dirty[i] = true;
+            }
+        }
+        // Runs are maximal, disjoint, and cover exactly the dirty registers
+        bool covered[RegisterShadow::BLOCK_SIZE] = {};
+        U8 first = 0;
+        U32 count = 0;
+        for (U32 start = RegisterShadow::FIRST_REGISTER; shadow.next_run(start, first, count); start = first + count) {
+            ASSERT_GE(first, start);
+            ASSERT_LE(count, RegisterShadow::MAX_RUN);
+            const U32 index = first - RegisterShadow::FIRST_REGISTER;
+            for (U32 i = index; i < index + count; i++) {
+                ASSERT_TRUE(dirty[i]) << "register " << (RegisterShadow::FIRST_REGISTER + i);
+                covered[i] = true;
+            }
+            ASSERT_TRUE((index == 0) || !dirty[index - 1]);
+            ASSERT_TRUE(((index + count) == RegisterShadow::BLOCK_SIZE) || !dirty[index + count]);
+            shadow.confirm(first, count);
+        }
+        for (U32 i = 0; i < RegisterShadow::BLOCK_SIZE; i++) {
+            ASSERT_EQ(covered[i], dirty[i]) << "register " << (RegisterShadow::FIRST_REGISTER + i);
+        }
+        ASSERT_FALSE(shadow.next_run(RegisterShadow::FIRST_REGISTER, first, count));
+
+        // A verification takes the values read as held, so the registers read differently become dirty
+        U8 block[RegisterShadow::BLOCK_SIZE];
+        U32 differing = 0;
+        U8 lowest = 0;
+        for (U32 i = 0; i < RegisterShadow::BLOCK_SIZE; i++) {
+            const U8 registerAddress = static_cast<U8>(RegisterShadow::FIRST_REGISTER + i);
+            const bool tracked = RegisterShadow::tracked(registerAddress);
+            const bool changed = !tracked || (STest::Pick::lowerUpper(0, 9) == 0);
+            block[i] = changed ? static_cast<U8>(STest::Pick::lowerUpper(0, 0xFF)) : shadow.desired(registerAddress);
+            if (tracked && (block[i] != shadow.desired(registerAddress))) {
+                lowest = (differing == 0) ? registerAddress : lowest;
+                differing++;
+            }
+        }
+        U8 mismatch = 0;
+        ASSERT_EQ(shadow.verify(block, mismatch), differing);
+        if (differing > 0) {
+            ASSERT_EQ(mismatch, lowest);
+        }
+        for (U32 i = 0; i < RegisterShadow::BLOCK_SIZE; i++) {
+            const U8 registerAddress = static_cast<U8>(RegisterShadow::FIRST_REGISTER + i);
+            if (RegisterShadow::tracked(registerAddress)) {
+                ASSERT_EQ(shadow.dirty(registerAddress), block[i] != shadow.desired(registerAddress));
+            }
+        }
+    }
+}
+
+void ImuManagerTester ::register_dirty_writes() {
+    this->nominal_boot_sequence();
+    // Only the filter bandwidth differs from the reset values
+    this->tick();
+    ASSERT_from_busWrite_SIZE(1);
+    FromPortEntry_busWrite entry = this->fromPortHistory_busWrite->at(0);
+    this->verify_register_write(0x1A, 0x01, entry.serBuffer);
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+
+    // A range change writes its one register
+    this->accelerationRange = AccelerationRange::RANGE_8G;
+    this->paramSet_ACCELEROMETER_RANGE(this->accelerationRange, Fw::ParamValid::VALID);
+    this->paramSend_ACCELEROMETER_RANGE(0, 0);
+    this->clearHistory();
+    this->expect_configure();
+    this->tick();
+    ASSERT_from_busWrite_SIZE(1);
+    entry = this->fromPortHistory_busWrite->at(0);
+    this->verify_register_write(0x1C, 0x10, entry.serBuffer);
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+
+    // Both ranges change, adjacent registers written in one transaction
+    this->accelerationRange = AccelerationRange::RANGE_16G;
+    this->gyroscopeRange = GyroscopeRange::RANGE_2000DEG;
+    this->paramSet_ACCELEROMETER_RANGE(this->accelerationRange, Fw::ParamValid::VALID);
+    this->paramSend_ACCELEROMETER_RANGE(0, 0);
+    this->paramSet_GYROSCOPE_RANGE(this->gyroscopeRange, Fw::ParamValid::VALID);
+    this->paramSend_GYROSCOPE_RANGE(0, 0);
+    this->clearHistory();
+    this->expect_configure();
+    this->tick();
+    ASSERT_from_busWrite_SIZE(1);
+    const Fw::Buffer& ranges = this->fromPortHistory_busWrite->at(0).serBuffer;
+    ASSERT_EQ(ranges.getSize(), 3);
+    ASSERT_EQ(ranges.getData()[0], 0x1B);
+    ASSERT_EQ(ranges.getData()[1], 0x18);
+    ASSERT_EQ(ranges.getData()[2], 0x18);
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+
+    // A parameter set to the value the device holds writes nothing
+    this->paramSend_ACCELEROMETER_RANGE(0, 0);
+    this->clearHistory();
+    this->expect_configure();
+    ASSERT_EQ(this->state, ImuManagerTester::State::RUN);
+    this->tick();
+    ASSERT_from_busWrite_SIZE(0);
+    ASSERT_TLM_SampleRate_SIZE(1);
+    this->clearHistory();
+    this->nominal_run_sequence();
+}
+
+void ImuManagerTester ::register_verification(AcquisitionMode mode) {
+    this->set_verify_period(VERIFY_PERIOD_MS);
+    this->nominal_boot_sequence();
+    if (mode == AcquisitionMode::FIFO) {
+        this->set_acquisition_mode(AcquisitionMode::FIFO);
+        this->fifo_configure_sequence();
+    } else {
+        this->reconfigure_sequence();
+    }
+    const State running = this->configured_state();
+    this->fifoCount = 0;
+    this->verifyReads = 0;
+
+    // The first tick after the configuration starts the interval
+    this->tick();
+    ASSERT_EQ(this->verifyReads, 0);
+    this->verify_state_and_clear(running);
+    // The block is read once per interval, and a device holding the configuration is left alone
+    this->advance_time(VERIFY_PERIOD_MS * 1000);
+    this->tick();
+    ASSERT_EQ(this->verifyReads, 1);
+    ASSERT_from_busWriteRead_SIZE(2);
+    ASSERT_EQ(this->fromPortHistory_busWriteRead->at(0).readBuffer.getSize(), RegisterShadow::BLOCK_SIZE);
+    ASSERT_from_busWrite_SIZE(0);
+    ASSERT_EVENTS_SIZE(0);
+    this->verify_state_and_clear(running);
+    this->advance_time((VERIFY_PERIOD_MS * 1000) - 1);
+    this->tick();
+    ASSERT_EQ(this->verifyReads, 1);
+    this->verify_state_and_clear(running);
+
+    // A brown-out returns every register to its reset value, sleeping the device, and the verification restores the
+    // registers that differ in place rather than through a reset
+    this->reset_registers();
+    this->state = ImuManagerTester::State::CONFIGURE;
+    this->advance_time(1);
+    this->tick();
+    ASSERT_EQ(this->verifyReads, 2);
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_RegisterMismatch_SIZE(1);
+    ASSERT_EVENTS_RegisterMismatch(0, DEVICE_ADDRESS, 0x1A, 0x00, 0x01, (mode == AcquisitionMode::FIFO) ? 4 : 2);
+    ASSERT_TLM_RegisterMismatches_SIZE(1);
+    ASSERT_TLM_RegisterMismatches(0, 1);
+    for (FwSizeType i = 0; i < this->fromPortHistory_busWrite->size(); i++) {
+        const Fw::Buffer& write = this->fromPortHistory_busWrite->at(i).serBuffer;
+        ASSERT_FALSE((write.getData()[0] == 0x6B) && (write.getData()[1] == 0x80));
+    }
+    ASSERT_EQ(this->registers[0x6B], 0x00);
+    this->verify_state_and_clear(running);
+
+    // A single corrupted register is the only one rewritten, around a FIFO reset in FIFO mode
+    this->registers[0x1C] = 0x18;
+    this->state = ImuManagerTester::State::CONFIGURE;
+    this->advance_time(VERIFY_PERIOD_MS * 1000);
+    this->tick();
+    ASSERT_EVENTS_RegisterMismatch_SIZE(1);
+    ASSERT_EVENTS_RegisterMismatch(0, DEVICE_ADDRESS, 0x1C, 0x18, 0x00, 1);
+    ASSERT_TLM_RegisterMismatches(0, 2);
+    ASSERT_from_busWrite_SIZE((mode == AcquisitionMode::FIFO) ? 3 : 1);
+    this->verify_state_and_clear(running);
+    if (mode == AcquisitionMode::FIFO) {
+        this->fifo_run_sequence();
+    } else {
+        this->nominal_run_sequence();
+    }
+}
+
+void ImuManagerTester ::set_verify_period(U16 period) {
+    this->paramSet_REGISTER_VERIFY_PERIOD(period, Fw::ParamValid::VALID);
+    this->paramSend_REGISTER_VERIFY_PERIOD(0, 0);
+    this->clearHistory();
+}
+
+void ImuManagerTester ::synchronous_read(bool synchronous) {
+    this->set_synchronous_read(synchronous);
+    this->nominal_boot_sequence();
+    this->reconfigure_sequence();
+    // The boot queues the ticks and the signals of each state, which set the reported high water mark
+    const FwSizeType highWaterMark = this->component.m_queue.getMessageHighWaterMark();
+    ASSERT_GT(highWaterMark, 0);
+    ASSERT_EQ(this->component.m_queueHighWaterMark, highWaterMark);
+    // Reads leave the queue empty and never raise the mark
+    this->nominal_run_sequence();
+    ASSERT_EQ(this->component.m_queue.getMessagesAvailable(), 0);
+    ASSERT_EQ(this->component.m_queue.getMessageHighWaterMark(), highWaterMark);
+
+    // A command queued ahead of a tick resets the device before the read, or after it when the tick is queued too
+    this->sendCmd_RESET(0, 0);
+    if (!synchronous) {
+        this->tick();
+        ASSERT_CMD_RESPONSE_SIZE(1);
+        ASSERT_CMD_RESPONSE(0, ImuManager::OPCODE_RESET, 0, Fw::CmdResponse::OK);
+        ASSERT_from_busWriteRead_SIZE(1);
+        ASSERT_from_busWrite_SIZE(0);
+        this->verify_state_and_clear(ImuManagerTester::State::RUN);
+    }
+    this->state = ImuManagerTester::State::RESET;
+    this->tick();
+    ASSERT_CMD_RESPONSE_SIZE(synchronous ? 1 : 0);
+    ASSERT_from_busWriteRead_SIZE(0);
+    ASSERT_from_busWrite_SIZE(1);
+    this->verify_state_and_clear(ImuManagerTester::State::WAIT_RESET);
+}
+
+void ImuManagerTester ::synchronous_read_benchmark() {
+    this->nominal_boot_sequence();
+    this->reconfigure_sequence();
+    F64 tickUs[2] = {0.0, 0.0};
+    for (U32 synchronous = 0; synchronous < 2; synchronous++) {
+        this->set_synchronous_read(synchronous == 1);
+        const auto start = std::chrono::steady_clock::now();
+        for (U32 i = 0; i < SYNCHRONOUS_BENCHMARK_TICKS; i++) {
+            this->tick();
+            this->clearHistory();
+        }
+        tickUs[synchronous] = std::chrono::duration<F64, std::micro>(std::chrono::steady_clock::now() - start).count() /
+                              SYNCHRONOUS_BENCHMARK_TICKS;
+        ASSERT_EQ(this->state, ImuManagerTester::State::RUN);
+        ASSERT_EQ(this->component.m_queue.getMessagesAvailable(), 0);
+    }
+    ::printf("[ BENCHMARK ] Queued read:      %.3f us per tick\n", tickUs[0]);
+    ::printf("[ BENCHMARK ] Synchronous read: %.3f us per tick (queue high water mark %u of %u)\n", tickUs[1],
+             static_cast<unsigned int>(this->component.m_queue.getMessageHighWaterMark()),
+             static_cast<unsigned int>(TEST_INSTANCE_QUEUE_DEPTH));
+}
+
+void ImuManagerTester ::set_synchronous_read(bool synchronous) {
+    this->paramSet_SYNCHRONOUS_READ(synchronous, Fw::ParamValid::VALID);
+    this->paramSend_SYNCHRONOUS_READ(0, 0);
+    this->clearHistory();
+}
+
+void ImuManagerTester ::steady_reads(I16 noise) {
+    this->steadyReads = true;
+    this->steadyNoise = noise;
+}
+
+void ImuManagerTester ::bias_calibration_sequence(U32 duration, Fw::CmdResponse response) {
+    this->sendCmd_CALIBRATE_BIAS(0, 0, duration);
+    // The window opens on the first tick and closes on the first tick at least duration later, reading every tick
+    const U32 ticks = (duration * 1000) / BIAS_TICK_US;
+    for (U32 i = 0; i < ticks; i++) {
+        this->tick();
+        ASSERT_from_busWriteRead_SIZE(1);
+        if (i == 0) {
+            ASSERT_EVENTS_BiasCalibrationStarted_SIZE(1);
+            ASSERT_EVENTS_BiasCalibrationStarted(0, duration);
+        }
+        ASSERT_CMD_RESPONSE_SIZE(0);
+        this->verify_state_and_clear(ImuManagerTester::State::RUN);
+        this->advance_time(BIAS_TICK_US);
+    }
+    this->tick();
+    ASSERT_from_busWriteRead_SIZE(1);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, ImuManager::OPCODE_CALIBRATE_BIAS, 0, response);
+    if (response == Fw::CmdResponse::OK) {
+        ASSERT_EVENTS_BiasCalibrated_SIZE(1);
+        ASSERT_EVENTS_BiasCalibrationRejected_SIZE(0);
+        // steadyRaw is level at the reset ranges, 16384 counts per G and 131 counts per deg/s
+        ASSERT_TLM_AccelerationBias_SIZE(1);
+        ASSERT_TLM_RotationBias_SIZE(1);
+        const FprimeSensors::GeometricVector3& acceleration = this->tlmHistory_AccelerationBias->at(0).arg;
+        const FprimeSensors::GeometricVector3& rotation = this->tlmHistory_RotationBias->at(0).arg;
+        ASSERT_NEAR(acceleration.get_x(), this->steadyRaw.acceleration[0] / 16384.0f, 1.0e-3f);
+        ASSERT_NEAR(acceleration.get_y(), this->steadyRaw.acceleration[1] / 16384.0f, 1.0e-3f);
+        ASSERT_NEAR(acceleration.get_z(), (this->steadyRaw.acceleration[2] - 16384) / 16384.0f, 1.0e-3f);
+        ASSERT_NEAR(rotation.get_x(), this->steadyRaw.gyroscope[0] / 131.0f, 0.05f);
+        ASSERT_NEAR(rotation.get_y(), this->steadyRaw.gyroscope[1] / 131.0f, 0.05f);
+        ASSERT_NEAR(rotation.get_z(), this->steadyRaw.gyroscope[2] / 131.0f, 0.05f);
+    } else {
+        ASSERT_EVENTS_BiasCalibrated_SIZE(0);
+        ASSERT_EVENTS_BiasCalibrationRejected_SIZE(1);
+        ASSERT_TLM_AccelerationBias_SIZE(0);
+    }
+}
+
+void ImuManagerTester ::verify_bias_removed(bool hardwareOffsets) {
+    this->tick();
+    ASSERT_from_busWriteRead_SIZE(1);
+    ASSERT_TLM_Reading_SIZE(1);
+    const ImuData& reading = this->tlmHistory_Reading->at(0).arg;
+    ASSERT_NEAR(reading.get_acceleration().get_x(), 0.0f, 1.0e-3f);
+    ASSERT_NEAR(reading.get_acceleration().get_y(), 0.0f, 1.0e-3f);
+    ASSERT_NEAR(reading.get_acceleration().get_z(), 1.0f, 1.0e-3f);
+    // The emulated device does not apply its offset registers, so their bias is still in the reading
+    const F32 rotation[3] = {reading.get_rotation().get_x(), reading.get_rotation().get_y(),
+                             reading.get_rotation().get_z()};
+    for (U32 axis = 0; axis < 3; axis++) {
+        ASSERT_NEAR(rotation[axis], hardwareOffsets ? (this->steadyRaw.gyroscope[axis] / 131.0f) : 0.0f, 0.05f);
+    }
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+}
+
+void ImuManagerTester ::set_hardware_offsets(bool enabled) {
+    // Negated bias of steadyRaw at 32.8 counts per deg/s
+    const I16 offsets[3] = {-66, 33, -16};
+    for (U32 axis = 0; axis < 3; axis++) {
+        this->gyroOffsets[axis] = offsets[axis];
+    }
+    this->gyroOffsetsEnabled = enabled;
+    this->paramSet_BIAS_HARDWARE_OFFSETS(enabled, Fw::ParamValid::VALID);
+    this->paramSend_BIAS_HARDWARE_OFFSETS(0, 0);
+    ASSERT_EVENTS_BiasHardwareOffsetsUpdated_SIZE(1);
+    ASSERT_EVENTS_BiasHardwareOffsetsUpdated(0, enabled);
+    this->clearHistory();
+
+    // Only the offset bytes that change are written, the zero high byte of the y offset splitting them in two
+    this->expect_configure();
+    this->tick();
+    ASSERT_from_busWrite_SIZE(2);
+    for (U32 axis = 0; axis < 3; axis++) {
+        const U16 offset = static_cast<U16>(enabled ? offsets[axis] : 0);
+        ASSERT_EQ(this->registers[0x13 + (2 * axis)], static_cast<U8>(offset >> 8));
+        ASSERT_EQ(this->registers[0x14 + (2 * axis)], static_cast<U8>(offset));
+    }
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+}
+
+void ImuManagerTester ::test_bias_file_restore() {
+    (void)Os::FileSystem::removeFile(BIAS_PATH);
+    this->component.configure(DEVICE_DEFAULT_ADDRESS, BIAS_PATH);
+    this->nominal_boot_sequence();
+    this->reconfigure_sequence();
+    this->steady_reads(2);
+    this->bias_calibration_sequence(BIAS_DURATION_MS, Fw::CmdResponse::OK);
+    this->clearHistory();
+
+    // One record per possible device
+    FwSizeType size = 0;
+    ASSERT_EQ(Os::FileSystem::getFileSize(BIAS_PATH, size), Os::FileSystem::OP_OK);
+    ASSERT_EQ(size, MAX_DEVICES * BIAS_RECORD_SIZE);
+
+    // Drop the bias as a restart would, and load the file again on the next run
+    ImuManager::Device& device = this->component.m_devices[0];
+    const FprimeSensors::GeometricVector3 acceleration(device.accelerationBias[0], device.accelerationBias[1],
+                                                       device.accelerationBias[2]);
+    const FprimeSensors::GeometricVector3 rotation(device.rotationBias[0], device.rotationBias[1],
+                                                   device.rotationBias[2]);
+    for (U32 axis = 0; axis < 3; axis++) {
+        device.accelerationBias[axis] = 0.0f;
+        device.rotationBias[axis] = 0.0f;
+    }
+    device.biasValid = false;
+    this->component.apply_bias(0);
+    this->component.m_biasFileLoaded = false;
+
+    this->tick();
+    ASSERT_EVENTS_BiasFileLoaded_SIZE(1);
+    ASSERT_EVENTS_BiasFileLoaded(0, 1);
+    ASSERT_TLM_AccelerationBias_SIZE(1);
+    ASSERT_TLM_AccelerationBias(0, acceleration);
+    ASSERT_TLM_RotationBias_SIZE(1);
+    ASSERT_TLM_RotationBias(0, rotation);
+    this->verify_state_and_clear(ImuManagerTester::State::RUN);
+    this->verify_bias_removed(false);
+    (void)Os::FileSystem::removeFile(BIAS_PATH);
+}
+
+void ImuManagerTester ::test_bias_file_invalid() {
+    // Record claims a bias but its CRC does not match
+    U8 contents[MAX_DEVICES * BIAS_RECORD_SIZE] = {0};
+    contents[0] = BIAS_RECORD_VALID;
+    contents[1] = 0x3F;
+    Os::File file;
+    ASSERT_EQ(file.open(BIAS_PATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    FwSizeType size = sizeof(contents);
+    ASSERT_EQ(file.write(contents, size), Os::File::OP_OK);
+    file.close();
+
+    this->component.configure(DEVICE_DEFAULT_ADDRESS, BIAS_PATH);
+    this->tick();
+    ASSERT_EVENTS_BiasFileInvalid_SIZE(1);
+    ASSERT_EVENTS_BiasFileInvalid(0, 0);
+    ASSERT_EVENTS_BiasFileLoaded_SIZE(1);
+    ASSERT_EVENTS_BiasFileLoaded(0, 0);
+    this->verify_state_and_clear(ImuManagerTester::State::WAIT_RESET);
+    (void)Os::FileSystem::removeFile(BIAS_PATH);
+
+    // Readings are converted without a bias
+    this->state = ImuManagerTester::State::WAIT_RESET_FINISH;
+    this->tick();
+    this->tick();
+    this->verify_state_and_clear(ImuManagerTester::State::CONFIGURE);
+    this->reconfigure_sequence();
+    this->nominal_run_sequence();
+}
+
 void ImuManagerTester ::fill_read_data(Fw::Buffer& readBuffer) {
     RawImuData raw;
     raw.acceleration[0] = STest::Pick::lowerUpper(0, 0xFFFF);
@@ -147,6 +1206,18 @@ void ImuManagerTester ::fill_read_data(Fw::Buffer& readBuffer) {
     raw.gyroscope[0] = STest::Pick::lowerUpper(0, 0xFFFF);
     raw.gyroscope[1] = STest::Pick::lowerUpper(0, 0xFFFF);
     raw.gyroscope[2] = STest::Pick::lowerUpper(0, 0xFFFF);
+    if (this->steadyReads) {
+        // A still device reads its bias and gravity, with a little noise
+        const U32 span = 2 * static_cast<U32>(this->steadyNoise);
+        for (U32 axis = 0; axis < 3; axis++) {
+            raw.acceleration[axis] = static_cast<I16>(this->steadyRaw.acceleration[axis] +
+                                                      static_cast<I32>(STest::Pick::lowerUpper(0, span)) -
+                                                      this->steadyNoise);
+            raw.gyroscope[axis] = static_cast<I16>(this->steadyRaw.gyroscope[axis] +
+                                                   static_cast<I32>(STest::Pick::lowerUpper(0, span)) -
+                                                   this->steadyNoise);
+        }
+    }
     auto serializer = readBuffer.getSerializer();
     serializer.serialize(raw.acceleration[0]);
     serializer.serialize(raw.acceleration[1]);
@@ -155,9 +1226,113 @@ void ImuManagerTester ::fill_read_data(Fw::Buffer& readBuffer) {
     serializer.serialize(raw.gyroscope[0]);
     serializer.serialize(raw.gyroscope[1]);
     serializer.serialize(raw.gyroscope[2]);
+    this->primaryRaw = raw;
     this->imuData = ImuManager::convert_raw_data(raw, this->accelerationRange, this->gyroscopeRange);
 }
 
+void ImuManagerTester ::fill_secondary_read_data(Fw::Buffer& readBuffer) {
+    RawImuData raw = this->primaryRaw;
+    // Offset away from the end of the range rather than wrapping around it
+    const I32 shifted = static_cast<I32>(raw.acceleration[0]) + this->secondaryOffset;
+    raw.acceleration[0] = ((shifted > 0x7FFF) || (shifted < -0x8000))
+                              ? static_cast<I16>(raw.acceleration[0] - this->secondaryOffset)
+                              : static_cast<I16>(shifted);
+    auto serializer = readBuffer.getSerializer();
+    serializer.serialize(raw.acceleration[0]);
+    serializer.serialize(raw.acceleration[1]);
+    serializer.serialize(raw.acceleration[2]);
+    serializer.serialize(raw.temperature);
+    serializer.serialize(raw.gyroscope[0]);
+    serializer.serialize(raw.gyroscope[1]);
+    serializer.serialize(raw.gyroscope[2]);
+    this->secondaryImuData = ImuManager::convert_raw_data(raw, this->accelerationRange, this->gyroscopeRange);
+}
+
+void ImuManagerTester ::fill_fifo_data(Fw::Buffer& readBuffer) {
+    this->fifoFrames = static_cast<U32>(readBuffer.getSize() / FIFO_FRAME_LENGTH);
+    this->samplesOut = 0;
+    auto serializer = readBuffer.getSerializer();
+    for (U32 i = 0; i < this->fifoFrames; i++) {
+        RawImuData& raw = this->fifoRaw[i];
+        raw.acceleration[0] = STest::Pick::lowerUpper(0, 0xFFFF);
+        raw.acceleration[1] = STest::Pick::lowerUpper(0, 0xFFFF);
+        raw.acceleration[2] = STest::Pick::lowerUpper(0, 0xFFFF);
+        raw.gyroscope[0] = STest::Pick::lowerUpper(0, 0xFFFF);
+        raw.gyroscope[1] = STest::Pick::lowerUpper(0, 0xFFFF);
+        raw.gyroscope[2] = STest::Pick::lowerUpper(0, 0xFFFF);
+        serializer.serialize(raw.acceleration[0]);
+        serializer.serialize(raw.acceleration[1]);
+        serializer.serialize(raw.acceleration[2]);
+        serializer.serialize(raw.gyroscope[0]);
+        serializer.serialize(raw.gyroscope[1]);
+        serializer.serialize(raw.gyroscope[2]);
+    }
+}
+
+void ImuManagerTester ::fill_fifo_temperature(Fw::Buffer& readBuffer) {
+    const I16 temperature = static_cast<I16>(STest::Pick::lowerUpper(0, 0xFFFF));
+    auto serializer = readBuffer.getSerializer();
+    serializer.serialize(temperature);
+    for (U32 i = 0; i < this->fifoFrames; i++) {
+        this->fifoRaw[i].temperature = temperature;
+        this->fifoSamples[i] =
+            ImuManager::convert_raw_data(this->fifoRaw[i], this->accelerationRange, this->gyroscopeRange);
+    }
+}
+
+void ImuManagerTester ::from_dataOut_handler(FwIndexType portNum, const Fw::Time& time, const MpuImu::ImuData& data) {
+    if (portNum == 1) {
+        // The secondary device is only exercised with register reads
+        EXPECT_EQ(data, this->secondaryImuData);
+        EXPECT_EQ(time, this->m_testTime);
+    } else if (this->fifo_enabled()) {
+        ASSERT_LT(this->samplesOut, this->fifoFrames);
+        EXPECT_EQ(data, this->fifoSamples[this->samplesOut]);
+        // The newest sample is stamped with the time of the count read, earlier samples a period apart
+        const U32 period = ImuManager::sample_period_us(this->sampleRateDivider, this->dlpfBandwidth);
+        EXPECT_EQ(time, ImuManager::sample_time(this->m_testTime, (this->fifoFrames - 1 - this->samplesOut) * period));
+    } else {
+        EXPECT_EQ(data, this->imuData);
+        EXPECT_EQ(time, this->m_testTime);
+    }
+    if ((portNum == 0) && (this->deltaPeriodUs != 0)) {
+        if (this->deltaSkip > 0) {
+            this->deltaSkip--;
+        } else {
+            const F32 rotation[3] = {data.get_rotation().get_x(), data.get_rotation().get_y(),
+                                     data.get_rotation().get_z()};
+            const F32 acceleration[3] = {data.get_acceleration().get_x(), data.get_acceleration().get_y(),
+                                         data.get_acceleration().get_z()};
+            this->deltaIntegrator.add(rotation, acceleration, this->deltaPeriodUs);
+        }
+    }
+    if (portNum == 0) {
+        this->sampleTime = time;
+    }
+    this->samplesOut++;
+}
+
+void ImuManagerTester ::from_deltaOut_handler(FwIndexType portNum,
+                                              const Fw::Time& time,
+                                              const MpuImu::ImuDelta& delta) {
+    // The secondary device is only exercised with register reads at one time, which never integrate
+    ASSERT_EQ(portNum, 0);
+    // Emitted with the last sample of the interval, after the sample itself
+    EXPECT_EQ(time, this->sampleTime);
+    if (this->deltaPeriodUs != 0) {
+        F32 angle[3];
+        F32 velocity[3];
+        this->deltaIntegrator.delta_angle(angle);
+        this->deltaIntegrator.delta_velocity(velocity);
+        EXPECT_EQ(delta, ImuDelta(FprimeSensors::GeometricVector3(angle[0], angle[1], angle[2]),
+                                  FprimeSensors::GeometricVector3(velocity[0], velocity[1], velocity[2]),
+                                  this->deltaIntegrator.duration_us(), this->deltaIntegrator.samples()));
+        this->deltaIntegrator.next_interval();
+    }
+    this->delta = delta;
+    this->deltasOut++;
+}
+
 Drv::I2cStatus ImuManagerTester ::from_busWrite_handler(
     FwIndexType portNum,      //!< The port number
     U32 addr,                 //!< I2C slave device address
@@ -165,6 +1340,8 @@ Drv::I2cStatus ImuManagerTester ::from_busWrite_handler(
 ) {
     Fw::Buffer readBuffer;
     this->pushFromPortEntry_busWrite(addr, writeBuffer);
+    this->busTransactions++;
+    this->busBytes += 1 + static_cast<U32>(writeBuffer.getSize());
     return this->bus_handler_helper(addr, writeBuffer, readBuffer);
 }
 
@@ -176,19 +1353,155 @@ Drv::I2cStatus ImuManagerTester ::from_busWriteRead_handler(
     Fw::Buffer& readBuffer  //!< Buffer to read back data from the i2c device, must set size when passing in read buffer
 ) {
     this->pushFromPortEntry_busWriteRead(addr, writeBuffer, readBuffer);
+    this->busTransactions++;
+    this->busBytes += 2 + static_cast<U32>(writeBuffer.getSize() + readBuffer.getSize());
     return this->bus_handler_helper(addr, writeBuffer, readBuffer);
 }
 
+bool ImuManagerTester ::expected_register(U8 registerAddress, U8& value) const {
+    const bool fifo = (this->acquisitionMode == AcquisitionMode::FIFO);
+    const bool interrupt = (this->acquisitionMode == AcquisitionMode::INTERRUPT);
+    if ((registerAddress >= 0x13) && (registerAddress <= 0x18)) {
+        // Offsets are cleared when disabled
+        const U32 axis = (registerAddress - 0x13) / 2;
+        const U16 offset = static_cast<U16>(this->gyroOffsetsEnabled ? this->gyroOffsets[axis] : 0);
+        value = (((registerAddress - 0x13) % 2) == 0) ? static_cast<U8>(offset >> 8) : static_cast<U8>(offset);
+        return true;
+    }
+    switch (registerAddress) {
+        case 0x19:
+            value = this->sampleRateDivider;
+            return true;
+        case 0x1A:
+            value = static_cast<U8>(this->dlpfBandwidth.e);
+            return true;
+        case 0x1B:
+            value = ImuManager::gyroscope_range_to_register(this->gyroscopeRange);
+            return true;
+        case 0x1C:
+            value = ImuManager::accelerometer_range_to_register(this->accelerationRange);
+            return true;
+        case 0x23:
+            value = fifo ? 0x78 : 0x00;
+            return true;
+        case 0x37:
+            value = interrupt ? 0x10 : 0x00;
+            return true;
+        case 0x38:
+            value = interrupt ? 0x01 : 0x00;
+            return true;
+        case 0x6A:
+            value = fifo ? 0x40 : 0x00;
+            return true;
+        case 0x6B:
+            value = 0x00;
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool ImuManagerTester ::configured() const {
+    for (U32 registerAddress = 0; registerAddress < REGISTER_COUNT; registerAddress++) {
+        U8 value = 0;
+        if (this->expected_register(static_cast<U8>(registerAddress), value) &&
+            (this->registers[registerAddress] != value)) {
+            return false;
+        }
+    }
+    return this->fifoReset || (this->acquisitionMode != AcquisitionMode::FIFO);
+}
+
+ImuManagerTester::State ImuManagerTester ::configured_state() const {
+    return (this->acquisitionMode == AcquisitionMode::FIFO) ? ImuManagerTester::State::FIFO_COUNT
+                                                            : ImuManagerTester::State::RUN;
+}
+
+void ImuManagerTester ::apply_register_write(Fw::Buffer& writeBuffer) {
+    EXPECT_GE(writeBuffer.getSize(), 2);
+    const U8 first = writeBuffer.getData()[0];
+    for (FwSizeType i = 1; i < writeBuffer.getSize(); i++) {
+        const U8 registerAddress = static_cast<U8>(first + i - 1);
+        const U8 value = writeBuffer.getData()[i];
+        U8 expected = 0;
+        EXPECT_TRUE(this->expected_register(registerAddress, expected))
+            << "register " << static_cast<U32>(registerAddress);
+        if ((registerAddress == 0x6A) && ((value & 0x04) != 0)) {
+            // The FIFO reset bit clears itself, and the reset only takes effect with the FIFO disabled
+            EXPECT_EQ(value, 0x04);
+            this->fifoReset = true;
+            this->registers[registerAddress] = 0x00;
+        } else {
+            // Registers already holding their value are not written again
+            EXPECT_NE(this->registers[registerAddress], value) << "register " << static_cast<U32>(registerAddress);
+            this->registers[registerAddress] = value;
+        }
+    }
+}
+
+bool ImuManagerTester ::verify_read(Fw::Buffer& writeBuffer, Fw::Buffer& readBuffer) {
+    if ((writeBuffer.getSize() != 1) || (writeBuffer.getData()[0] != 0x13)) {
+        return false;
+    }
+    EXPECT_EQ(readBuffer.getSize(), RegisterShadow::BLOCK_SIZE);
+    ::memcpy(readBuffer.getData(), &this->registers[0x13], RegisterShadow::BLOCK_SIZE);
+    this->verifyReads++;
+    return true;
+}
+
+void ImuManagerTester ::reset_registers() {
+    ::memset(this->registers, 0, sizeof(this->registers));
+    this->registers[0x6B] = 0x40;
+    this->fifoReset = false;
+}
+
+bool ImuManagerTester ::fifo_enabled() const {
+    return (this->registers[0x6A] & 0x40) != 0;
+}
+
+bool ImuManagerTester ::interrupt_enabled() const {
+    return (this->registers[0x38] & 0x01) != 0;
+}
+
 Drv::I2cStatus ImuManagerTester ::bus_handler_helper(
     U32 addr,                 //!< I2C slave device address
     Fw::Buffer& writeBuffer,  //!< Buffer to write data to the i2c device
     Fw::Buffer& readBuffer  //!< Buffer to read back data from the i2c device, must set size when passing in read buffer
 ) {
+    if (addr == this->failedAddress) {
+        // A failed device does not acknowledge, and the manager resets it
+        if (addr == DEVICE_SECONDARY_ADDRESS) {
+            this->secondaryState = ImuManagerTester::State::RESET;
+        } else {
+            this->state = ImuManagerTester::State::RESET;
+        }
+        return Drv::I2cStatus::I2C_ADDRESS_ERR;
+    }
+    if (addr != DEVICE_SECONDARY_ADDRESS) {
+        return this->device_bus_handler(addr, writeBuffer, readBuffer);
+    }
+    // The secondary device is emulated exactly like the primary, with its own state
+    std::swap(this->state, this->secondaryState);
+    std::swap(this->registers, this->secondaryRegisters);
+    this->emulatingSecondary = true;
+    const Drv::I2cStatus status = this->device_bus_handler(addr, writeBuffer, readBuffer);
+    this->emulatingSecondary = false;
+    std::swap(this->registers, this->secondaryRegisters);
+    std::swap(this->state, this->secondaryState);
+    return status;
+}
+
+Drv::I2cStatus ImuManagerTester ::device_bus_handler(U32 addr, Fw::Buffer& writeBuffer, Fw::Buffer& readBuffer) {
     switch (this->state) {
         // Check the output of the IMU when waiting for reset to finish
         case ImuManagerTester::State::RESET:
             EXPECT_EQ(this->state, ImuManagerTester::State::RESET); 
-            this->verify_reset();
+            if (this->emulatingSecondary) {
+                this->verify_register_write(0x6B, 0x80, writeBuffer);
+            } else {
+                this->verify_reset();
+            }
+            this->reset_registers();
             this->state = ImuManagerTester::State::WAIT_RESET;
             break;
         // Check the output of the IMU when waiting for reset to finish
@@ -212,27 +1525,76 @@ Drv::I2cStatus ImuManagerTester ::bus_handler_helper(
             EXPECT_EQ(writeBuffer.getData()[0], 0x6B);
             EXPECT_EQ(writeBuffer.getData()[1], 0x00);
             EXPECT_EQ(readBuffer.getSize(), 0);
-            this->state = ImuManagerTester::State::CONFIGURE_ACCELEROMETER;
+            this->registers[0x6B] = 0x00;
+            this->state = ImuManagerTester::State::CONFIGURE;
             break;
-        case ImuManagerTester::State::CONFIGURE_ACCELEROMETER:
-            EXPECT_EQ(writeBuffer.getSize(), 2);
-            EXPECT_EQ(writeBuffer.getData()[0], 0x1C);
-            EXPECT_EQ(writeBuffer.getData()[1], ImuManager::accelerometer_range_to_register(this->accelerationRange));
+        case ImuManagerTester::State::CONFIGURE:
+            // Writes in any order until the device holds the whole configuration, then run
+            if (this->verify_read(writeBuffer, readBuffer)) {
+                break;
+            }
             EXPECT_EQ(readBuffer.getSize(), 0);
-            this->state = ImuManagerTester::State::CONFIGURE_GYROSCOPE;
-            break;
-        case ImuManagerTester::State::CONFIGURE_GYROSCOPE:
-            EXPECT_EQ(writeBuffer.getSize(), 2);
-            EXPECT_EQ(writeBuffer.getData()[0], 0x1B);
-            EXPECT_EQ(writeBuffer.getData()[1], ImuManager::gyroscope_range_to_register(this->gyroscopeRange));
-            EXPECT_EQ(readBuffer.getSize(), 0);
-            this->state = ImuManagerTester::State::RUN;
+            this->apply_register_write(writeBuffer);
+            if (this->configured()) {
+                this->fifoReset = false;
+                this->state = this->configured_state();
+            }
             break;
         case ImuManagerTester::State::RUN:
+            if (this->verify_read(writeBuffer, readBuffer)) {
+                break;
+            }
             EXPECT_EQ(writeBuffer.getSize(), 1);
             EXPECT_EQ(writeBuffer.getData()[0], 0x3B);
             EXPECT_EQ(readBuffer.getSize(), sizeof(U16) * 7);
-            this->fill_read_data(readBuffer);
+            if (this->emulatingSecondary) {
+                this->fill_secondary_read_data(readBuffer);
+            } else {
+                this->fill_read_data(readBuffer);
+            }
+            break;
+        case ImuManagerTester::State::FIFO_RESET:
+            this->verify_register_write(0x6A, 0x04, writeBuffer);
+            EXPECT_EQ(readBuffer.getSize(), 0);
+            this->apply_register_write(writeBuffer);
+            this->state = ImuManagerTester::State::FIFO_START;
+            break;
+        case ImuManagerTester::State::FIFO_START:
+            this->verify_register_write(0x6A, 0x40, writeBuffer);
+            EXPECT_EQ(readBuffer.getSize(), 0);
+            this->apply_register_write(writeBuffer);
+            this->fifoReset = false;
+            this->state = ImuManagerTester::State::FIFO_COUNT;
+            break;
+        case ImuManagerTester::State::FIFO_COUNT: {
+            if (this->verify_read(writeBuffer, readBuffer)) {
+                break;
+            }
+            EXPECT_EQ(writeBuffer.getSize(), 1);
+            EXPECT_EQ(writeBuffer.getData()[0], 0x72);
+            EXPECT_EQ(readBuffer.getSize(), sizeof(U16));
+            auto serializer = readBuffer.getSerializer();
+            serializer.serialize(this->fifoCount);
+            if (this->fifoCount >= FIFO_SIZE) {
+                this->state = ImuManagerTester::State::FIFO_RESET;
+            } else if (this->fifoCount >= FIFO_FRAME_LENGTH) {
+                this->state = ImuManagerTester::State::FIFO_DATA;
+            }
+            break;
+        }
+        case ImuManagerTester::State::FIFO_DATA:
+            EXPECT_EQ(writeBuffer.getSize(), 1);
+            EXPECT_EQ(writeBuffer.getData()[0], 0x74);
+            EXPECT_EQ(readBuffer.getSize(), (this->fifoCount / FIFO_FRAME_LENGTH) * FIFO_FRAME_LENGTH);
+            this->fill_fifo_data(readBuffer);
+            this->state = ImuManagerTester::State::FIFO_TEMPERATURE;
+            break;
+        case ImuManagerTester::State::FIFO_TEMPERATURE:
+            EXPECT_EQ(writeBuffer.getSize(), 1);
+            EXPECT_EQ(writeBuffer.getData()[0], 0x41);
+            EXPECT_EQ(readBuffer.getSize(), sizeof(U16));
+            this->fill_fifo_temperature(readBuffer);
+            this->state = ImuManagerTester::State::FIFO_COUNT;
             break;
         default:
             break;
@@ -14,7 +14,26 @@ namespace MpuImu {
 
 class ImuManagerTester : public ImuManagerGTestBase, public ::testing::Test {
   public:
-    enum State { RESET, WAIT_RESET, WAIT_RESET_FINISH, POWER_ON, CONFIGURE_ACCELEROMETER, CONFIGURE_GYROSCOPE, RUN };
+    enum State {
+        RESET,
+        WAIT_RESET,
+        WAIT_RESET_FINISH,
+        POWER_ON,
+        CONFIGURE,
+        RUN,
+        FIFO_RESET,
+        FIFO_START,
+        FIFO_COUNT,
+        FIFO_DATA,
+        FIFO_TEMPERATURE
+    };
+
+    //! Conversion paths compared by the batch conversion benchmark
+    enum BatchPath {
+        PER_SAMPLE,  //!< Deserialize and convert one sample at a time, as the register read path does
+        SCALAR,      //!< Batch converter without the SIMD kernel
+        BATCH        //!< Batch converter with the SIMD kernel where available
+    };
 
     // ----------------------------------------------------------------------
     // Constants
@@ -31,6 +50,51 @@ class ImuManagerTester : public ImuManagerGTestBase, public ::testing::Test {
     // Instance Queue Depth
     static const FwSizeType TEST_INSTANCE_QUEUE_DEPTH = 10;
 
+    // Time between ticks of the data-ready tests, well inside the data-ready timeout (µs)
+    static const U32 INTERRUPT_TICK_US = 10000;
+
+    // Ticks run by the FIFO burst benchmark in each mode
+    static const U32 FIFO_BENCHMARK_TICKS = 10000;
+
+    // Largest batch of the batch conversion tests
+    static const U32 BATCH_MAX_RECORDS = 256;
+
+    // FIFO-sized batches converted by the batch conversion benchmark on each path
+    static const U32 BATCH_BENCHMARK_PASSES = 20000;
+
+    // Time between ticks of the bias calibration tests (µs)
+    static const U32 BIAS_TICK_US = 10000;
+
+    // Bias calibration window of the bias calibration tests, 51 register reads (ms)
+    static const U32 BIAS_DURATION_MS = 500;
+
+    // Bias file written by the bias file tests
+    static constexpr const char* BIAS_PATH = "ImuManagerBias.bin";
+
+    // Time between ticks of the register delta output tests (µs)
+    static const U32 DELTA_TICK_US = 10000;
+
+    // Delta output period of the register delta output tests, five register reads (ms)
+    static const U16 DELTA_PERIOD_MS = 50;
+
+    // Time between ticks of the statistics tests (µs)
+    static const U32 STATISTICS_TICK_US = 10000;
+
+    // Statistics window of the statistics tests, ten register reads (ms)
+    static const U16 STATISTICS_WINDOW_MS = 100;
+
+    // Samples accumulated by the statistics benchmark
+    static const U32 STATISTICS_BENCHMARK_SAMPLES = 2000000;
+
+    // Register verification period of the register verification tests (ms)
+    static const U16 VERIFY_PERIOD_MS = 100;
+
+    // Registers of the emulated device
+    static const U32 REGISTER_COUNT = 0x80;
+
+    // Ticks run by the synchronous read benchmark with and without the queue
+    static const U32 SYNCHRONOUS_BENCHMARK_TICKS = 20000;
+
   public:
     // ----------------------------------------------------------------------
     // Construction and destruction
@@ -51,9 +115,39 @@ class ImuManagerTester : public ImuManagerGTestBase, public ::testing::Test {
     //! Nominal run sequence
     void nominal_run_sequence();
 
+    //! Manage a secondary device and boot both devices together
+    void dual_boot_sequence();
+
+    //! Run a tick reading both devices, the secondary offset by a number of raw accelerometer counts, and check the vote
+    void dual_run_sequence(I16 offset, ImuVoteStatus status);
+
+    //! Set the acquisition mode parameter
+    void set_acquisition_mode(AcquisitionMode mode);
+
+    //! Expect a reconfiguration, which writes nothing when the emulated device already holds the configuration
+    void expect_configure();
+
+    //! Reconfiguration into FIFO mode, ending with the FIFO reset and enabled
+    void fifo_configure_sequence();
+
+    //! Run ticks draining a random number of bytes from the FIFO
+    void fifo_run_sequence();
+
+    //! Tick with the FIFO holding fifoCount bytes and verify the samples drained
+    void fifo_tick();
+
     //! Ticks and dispatches the rate group
     void tick();
 
+    //! Raises a data-ready interrupt edge
+    void data_ready();
+
+    //! Reconfiguration into INTERRUPT mode, ending with the data-ready interrupt enabled
+    void interrupt_configure_sequence();
+
+    //! Raise a random number of data-ready edges between ticks, verifying each reads one sample
+    void interrupt_run_sequence();
+
     //! Verifies that the component is in the RESET state
     void verify_reset();
 
@@ -69,9 +163,129 @@ class ImuManagerTester : public ImuManagerGTestBase, public ::testing::Test {
     //! Pick a valid gyroscope range
     void pick_gyroscope_range();
 
+    //! Pick a valid sample rate divider and filter bandwidth
+    void pick_sample_rate();
+
+    //! Pick the time returned to the component
+    void pick_time();
+
+    //! Advance the time returned to the component
+    void advance_time(U32 us);
+
+    //! Verifies the sample rate telemetry of the configured divider and filter bandwidth
+    void verify_sample_rate();
+
+    //! Convert a batch of random records with the SIMD kernel and the scalar path and check they match bit for bit,
+    //! and that the scalar path matches the per-sample conversion
+    void batch_conversion(ImuBatchConverter::RecordFormat format, U32 count);
+
+    //! Samples per second converted on a path, over FIFO-sized batches of random records
+    F64 batch_conversion_rate(BatchPath path, ImuBatchConverter::RecordFormat format);
+
+    //! Fill the batch records with random bytes
+    void fill_batch_records(U32 size);
+
+    //! Destination arrays of one of the two batch outputs
+    ImuBatchArrays batch_arrays(U32 output);
+
+    //! Accumulate a large constant with alternating unit noise and check the variance is exact
+    void bias_estimator_stability();
+
+    //! Read a still device from now on, with the bias of steadyRaw and up to noise counts of noise on each channel
+    void steady_reads(I16 noise);
+
+    //! Run a bias calibration window in register acquisition, checking the command completes with a response
+    void bias_calibration_sequence(U32 duration, Fw::CmdResponse response);
+
+    //! Tick and check the bias calibrated from steadyRaw is removed from the reading, except the angular rate bias
+    //! when it is written to the offset registers
+    void verify_bias_removed(bool hardwareOffsets);
+
+    //! Enable or disable the gyroscope offset registers and check the reconfiguration writes them
+    void set_hardware_offsets(bool enabled);
+
+    //! Calibrate with a bias file, then drop the bias in memory and check it is restored from the file
+    void test_bias_file_restore();
+
+    //! Check a bias file record failing its CRC is ignored
+    void test_bias_file_invalid();
+
+    //! Integrate a coning motion and check the coning correction recovers the rotation the plain sum misses
+    void delta_coning();
+
+    //! Integrate a sculling motion and check the sculling correction recovers the velocity the plain sum misses
+    void delta_sculling();
+
+    //! Set the delta output period parameter and check the reconfiguration
+    void set_delta_period(U16 period);
+
+    //! Check every sample from now on against the reference integrator, samples a period apart after skip samples
+    void delta_reference(U32 periodUs, U32 skip);
+
+    //! Run ticks in register acquisition a tick apart, checking one output interval per DELTA_PERIOD_MS
+    void delta_register_sequence(U32 ticks);
+
+    //! Check the window statistics of random samples against a two-pass computation
+    void window_statistics_accuracy();
+
+    //! Check the Allan variance of white noise falls as the inverse of the cluster time at every octave
+    void allan_white_noise();
+
+    //! Check the Allan variance of a ramp is exact with decimation, and unaffected by a step across a restart
+    void allan_ramp();
+
+    //! Time the statistics and Allan variance accumulation per sample
+    void statistics_benchmark();
+
+    //! Run ticks in register acquisition a tick apart, checking the statistics reported for each window
+    void statistics_sequence(U32 windows);
+
+    //! Check the runs of random shadows cover exactly their dirty registers, and a verification learns a random block
+    void register_shadow_runs();
+
+    //! Check each reconfiguration writes only the registers it changes, adjacent ones in one transaction
+    void register_dirty_writes();
+
+    //! Change the registers of the emulated device behind the component and check the verification restores them
+    //! without a reset
+    void register_verification(AcquisitionMode mode);
+
+    //! Set the register verification period parameter
+    void set_verify_period(U16 period);
+
+    //! Run register reads with or without the queue, checking a command queued ahead of a tick is taken first
+    void synchronous_read(bool synchronous);
+
+    //! Time a register read tick with and without the queue
+    void synchronous_read_benchmark();
+
+    //! Set the synchronous read parameter
+    void set_synchronous_read(bool synchronous);
+
     //! Fill read data buffer
     void fill_read_data(Fw::Buffer& readBuffer);
 
+    //! Fill the read data buffer of the secondary device with the primary sample, offset on the x accelerometer axis
+    void fill_secondary_read_data(Fw::Buffer& readBuffer);
+
+    //! Fill a FIFO burst with random frames
+    void fill_fifo_data(Fw::Buffer& readBuffer);
+
+    //! Fill the temperature read after a FIFO burst and compute the expected samples
+    void fill_fifo_temperature(Fw::Buffer& readBuffer);
+
+    //! Handler implementation for from_dataOut
+    void from_dataOut_handler(FwIndexType portNum,        //!< The port number
+                              const Fw::Time& time,       //!< Time the sample was taken
+                              const MpuImu::ImuData& data  //!< The sample
+                              ) final;
+
+    //! Handler implementation for from_deltaOut
+    void from_deltaOut_handler(FwIndexType portNum,          //!< The port number
+                               const Fw::Time& time,         //!< Time of the last sample of the interval
+                               const MpuImu::ImuDelta& delta  //!< The increments
+                               ) final;
+
     //! Handler implementation for from_bus
     Drv::I2cStatus from_busWriteRead_handler(FwIndexType portNum,      //!< The port number
                                              U32 addr,                 //!< I2C slave device address
@@ -87,6 +301,36 @@ class ImuManagerTester : public ImuManagerGTestBase, public ::testing::Test {
                                         ) final;
 
   private:
+    //! Value the configuration sets a register of the emulated device to, returning false for registers it leaves
+    bool expected_register(U8 registerAddress, U8& value) const;
+
+    //! Whether the emulated device holds the whole configuration, its FIFO reset while configuring in FIFO mode
+    bool configured() const;
+
+    //! State the emulated device runs in once configured
+    State configured_state() const;
+
+    //! Apply an auto-increment register write to the emulated device, checking each register it writes changes
+    void apply_register_write(Fw::Buffer& writeBuffer);
+
+    //! Serve a read of the whole configuration block, returning false for any other transaction
+    bool verify_read(Fw::Buffer& writeBuffer, Fw::Buffer& readBuffer);
+
+    //! Return the registers of the emulated device to their reset values
+    void reset_registers();
+
+    //! Whether the emulated device has its FIFO enabled
+    bool fifo_enabled() const;
+
+    //! Whether the emulated device has its data-ready interrupt enabled
+    bool interrupt_enabled() const;
+
+    //! Emulate the device at an address, swapping in the secondary device state for its address
+    Drv::I2cStatus device_bus_handler(U32 addr,                 //!< I2C slave device address
+                                      Fw::Buffer& writeBuffer,  //!< Buffer to write data to the i2c device
+                                      Fw::Buffer& readBuffer    //!< Buffer to read back data from the i2c device
+                                     );
+
     //! Handler implementation for from_bus
     Drv::I2cStatus bus_handler_helper(U32 addr,                 //!< I2C slave device address
                                       Fw::Buffer& writeBuffer,  //!< Buffer to write data to the i2c device
@@ -129,6 +373,114 @@ class ImuManagerTester : public ImuManagerGTestBase, public ::testing::Test {
 
     //! Counter for I2C failures
     U32 i2cFailure = 0;
+
+    //! Current sample rate divider
+    U8 sampleRateDivider = 0;
+
+    //! Current filter bandwidth
+    DlpfBandwidth dlpfBandwidth = DlpfBandwidth::BANDWIDTH_184HZ;
+
+    //! Acquisition mode set through the parameter
+    AcquisitionMode acquisitionMode = AcquisitionMode::REGISTER;
+
+    //! Registers of the emulated device
+    U8 registers[REGISTER_COUNT] = {};
+
+    //! Whether the emulated FIFO was reset since the device was last configured
+    bool fifoReset = false;
+
+    //! Verification reads of the configuration block since last cleared
+    U32 verifyReads = 0;
+
+    //! Bytes reported by the emulated FIFO count register
+    U16 fifoCount = 0;
+
+    //! Number of frames in the last FIFO burst
+    U32 fifoFrames = 0;
+
+    //! Raw frames of the last FIFO burst
+    RawImuData fifoRaw[FIFO_MAX_FRAMES];
+
+    //! Samples expected from the last FIFO burst
+    ImuData fifoSamples[FIFO_MAX_FRAMES];
+
+    //! Number of samples emitted on dataOut since last cleared
+    U32 samplesOut = 0;
+
+    //! Bus transactions since last cleared
+    U32 busTransactions = 0;
+
+    //! Bytes on the bus since last cleared, counting one address byte per direction
+    U32 busBytes = 0;
+
+    //! Raw records of the batch conversion tests
+    U8 batchRecords[BATCH_MAX_RECORDS * DATA_LENGTH];
+
+    //! Two batch outputs by channel: accelerations, angular rates, then temperature
+    F32 batchOutput[2][7][BATCH_MAX_RECORDS];
+
+    //! Sum of per-sample conversions, keeping the benchmark loop from being optimized away
+    F32 batchSink = 0.0f;
+
+    //! Current state of the emulated secondary device
+    State secondaryState = State::RESET;
+
+    //! Registers of the emulated secondary device
+    U8 secondaryRegisters[REGISTER_COUNT] = {};
+
+    //! Whether the bus handler is emulating the secondary device
+    bool emulatingSecondary = false;
+
+    //! Raw sample last read from the primary device
+    RawImuData primaryRaw = {};
+
+    //! Raw counts added to the x acceleration of the secondary device
+    I16 secondaryOffset = 0;
+
+    //! IMU data of the secondary device recalculated for telemetry tests
+    ImuData secondaryImuData;
+
+    //! Address of a device that has failed and no longer acknowledges, zero for none
+    U32 failedAddress = 0;
+
+    //! Vote disagreements expected since startup
+    U32 voteDisagreements = 0;
+
+    //! Whether reads return steadyRaw with noise rather than random data
+    bool steadyReads = false;
+
+    //! Raw reading of a still, level device with a bias on every channel, at the reset ranges
+    RawImuData steadyRaw = {{120, -250, 16384 + 330}, 0, {264, -132, 64}};
+
+    //! Largest noise added to each channel of steady reads (counts)
+    I16 steadyNoise = 0;
+
+    //! Whether the emulated device is expected to have its gyroscope offsets written when configured
+    bool gyroOffsetsEnabled = false;
+
+    //! Gyroscope offsets expected when they are written
+    I16 gyroOffsets[3] = {0, 0, 0};
+
+    //! Output intervals emitted on deltaOut since startup, kept here rather than in a history as FIFO bursts emit many
+    U32 deltasOut = 0;
+
+    //! Increments of the newest output interval emitted
+    ImuDelta delta;
+
+    //! Integrates the primary samples emitted on dataOut as the component should, when deltaPeriodUs is set
+    DeltaIntegrator deltaIntegrator;
+
+    //! Period of each primary sample fed to the reference integrator (µs), zero to not check the increments
+    U32 deltaPeriodUs = 0;
+
+    //! Primary samples still to pass before the reference integrator takes them
+    U32 deltaSkip = 0;
+
+    //! Time of the newest primary sample emitted on dataOut
+    Fw::Time sampleTime;
+
+    //! Primary samples of the current statistics window, accumulated as the component should
+    WindowStatistics statistics;
 };
 
 }  // namespace MpuImu
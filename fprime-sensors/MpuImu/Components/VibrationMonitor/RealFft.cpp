@@ -0,0 +1,291 @@
+// ======================================================================
+// \title  RealFft.cpp
+// \author mstarch
+// \brief  cpp file for the windowed radix-2 real FFT of accelerometer frames
+// ======================================================================
+
+#include "fprime-sensors/MpuImu/Components/VibrationMonitor/RealFft.hpp"
+#include <cmath>
+#include "Fw/Types/Assert.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define MPU_IMU_FFT_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define MPU_IMU_FFT_NEON 1
+#endif
+
+namespace MpuImu {
+
+namespace {
+constexpr F64 PI = 3.14159265358979323846;
+
+//! Butterflies computed by one pass of the SIMD kernel
+constexpr U32 SIMD_BLOCK = 4;
+
+//! Normalized sinc, sin(pi x) / (pi x)
+F64 sinc(F64 x) {
+    return (x == 0.0) ? 1.0 : std::sin(PI * x) / (PI * x);
+}
+
+#if defined(MPU_IMU_FFT_SSE2) || defined(MPU_IMU_FFT_NEON)
+//! Run the butterflies of a stage of half length at least SIMD_BLOCK four at a time
+void simd_stage(F32* real, F32* imag, const F32* twiddleReal, const F32* twiddleImag, U32 points, U32 half) {
+    for (U32 start = 0; start < points; start += 2 * half) {
+        F32* const aReal = real + start;
+        F32* const aImag = imag + start;
+        F32* const bReal = aReal + half;
+        F32* const bImag = aImag + half;
+        for (U32 j = 0; j < half; j += SIMD_BLOCK) {
+#if defined(MPU_IMU_FFT_SSE2)
+            const __m128 wr = _mm_loadu_ps(twiddleReal + half + j);
+            const __m128 wi = _mm_loadu_ps(twiddleImag + half + j);
+            const __m128 br = _mm_loadu_ps(bReal + j);
+            const __m128 bi = _mm_loadu_ps(bImag + j);
+            const __m128 tr = _mm_sub_ps(_mm_mul_ps(wr, br), _mm_mul_ps(wi, bi));
+            const __m128 ti = _mm_add_ps(_mm_mul_ps(wr, bi), _mm_mul_ps(wi, br));
+            const __m128 ar = _mm_loadu_ps(aReal + j);
+            const __m128 ai = _mm_loadu_ps(aImag + j);
+            _mm_storeu_ps(bReal + j, _mm_sub_ps(ar, tr));
+            _mm_storeu_ps(bImag + j, _mm_sub_ps(ai, ti));
+            _mm_storeu_ps(aReal + j, _mm_add_ps(ar, tr));
+            _mm_storeu_ps(aImag + j, _mm_add_ps(ai, ti));
+#else
+            const float32x4_t wr = vld1q_f32(twiddleReal + half + j);
+            const float32x4_t wi = vld1q_f32(twiddleImag + half + j);
+            const float32x4_t br = vld1q_f32(bReal + j);
+            const float32x4_t bi = vld1q_f32(bImag + j);
+            const float32x4_t tr = vsubq_f32(vmulq_f32(wr, br), vmulq_f32(wi, bi));
+            const float32x4_t ti = vaddq_f32(vmulq_f32(wr, bi), vmulq_f32(wi, br));
+            const float32x4_t ar = vld1q_f32(aReal + j);
+            const float32x4_t ai = vld1q_f32(aImag + j);
+            vst1q_f32(bReal + j, vsubq_f32(ar, tr));
+            vst1q_f32(bImag + j, vsubq_f32(ai, ti));
+            vst1q_f32(aReal + j, vaddq_f32(ar, tr));
+            vst1q_f32(aImag + j, vaddq_f32(ai, ti));
+#endif
+        }
+    }
+}
+#endif
+}  // namespace
+
+#if defined(MPU_IMU_FFT_SSE2) || defined(MPU_IMU_FFT_NEON)
+const bool RealFft::SIMD_AVAILABLE = true;
+#else
+const bool RealFft::SIMD_AVAILABLE = false;
+#endif
+
+RealFft ::RealFft() : m_size(0), m_window(VibrationWindow::HANN), m_powerScale(0.0f), m_amplitudeScale(0.0f) {
+    // Each stage half length h has its h twiddles at h to 2h - 1, the last serving the split of the largest frame
+    this->m_twiddleReal[0] = 1.0f;
+    this->m_twiddleImag[0] = 0.0f;
+    for (U32 half = 1; half < MAX_SIZE; half *= 2) {
+        for (U32 j = 0; j < half; j++) {
+            const F64 angle = -PI * static_cast<F64>(j) / static_cast<F64>(half);
+            this->m_twiddleReal[half + j] = static_cast<F32>(std::cos(angle));
+            this->m_twiddleImag[half + j] = static_cast<F32>(std::sin(angle));
+        }
+    }
+    for (U32 bin = 0; bin < MAX_BINS; bin++) {
+        this->m_real[bin] = 0.0f;
+        this->m_imag[bin] = 0.0f;
+    }
+    this->configure(MAX_SIZE, VibrationWindow::HANN);
+}
+
+bool RealFft ::valid_size(U32 size) {
+    return (size >= MIN_SIZE) && (size <= MAX_SIZE) && ((size & (size - 1)) == 0);
+}
+
+void RealFft ::configure(U32 size, VibrationWindow window) {
+    FW_ASSERT(valid_size(size), static_cast<FwAssertArgType>(size));
+    this->m_size = size;
+    this->m_window = window;
+
+    const U32 points = size / 2;
+    U32 bits = 0;
+    while ((1U << bits) < points) {
+        bits++;
+    }
+    for (U32 n = 0; n < points; n++) {
+        U32 reversed = 0;
+        for (U32 bit = 0; bit < bits; bit++) {
+            reversed |= ((n >> bit) & 1U) << (bits - 1 - bit);
+        }
+        this->m_reverse[n] = static_cast<U16>(reversed);
+    }
+
+    // The periodic Hann window, whose transform is exactly three bins wide
+    F64 sum = 0.0;
+    F64 squares = 0.0;
+    for (U32 n = 0; n < size; n++) {
+        const F64 coefficient = (window == VibrationWindow::HANN)
+                                    ? 0.5 * (1.0 - std::cos(2.0 * PI * static_cast<F64>(n) / static_cast<F64>(size)))
+                                    : 1.0;
+        this->m_coefficients[n] = static_cast<F32>(coefficient);
+        sum += coefficient;
+        squares += coefficient * coefficient;
+    }
+    // By Parseval the squared magnitudes sum to size times the windowed square sum
+    this->m_powerScale = static_cast<F32>(1.0 / (static_cast<F64>(size) * squares));
+    this->m_amplitudeScale = static_cast<F32>(2.0 / sum);
+}
+
+U32 RealFft ::size() const {
+    return this->m_size;
+}
+
+U32 RealFft ::bins() const {
+    return (this->m_size / 2) + 1;
+}
+
+VibrationWindow RealFft ::window() const {
+    return this->m_window;
+}
+
+void RealFft ::transform(const F32* samples, F32 offset) {
+#if defined(MPU_IMU_FFT_SSE2) || defined(MPU_IMU_FFT_NEON)
+    FW_ASSERT(samples != nullptr);
+    this->load(samples, offset);
+    const U32 points = this->m_size / 2;
+    for (U32 half = 1; half < points; half *= 2) {
+        if (half < SIMD_BLOCK) {
+            this->stage(half);
+        } else {
+            simd_stage(this->m_real, this->m_imag, this->m_twiddleReal, this->m_twiddleImag, points, half);
+        }
+    }
+    this->split();
+#else
+    this->transform_scalar(samples, offset);
+#endif
+}
+
+void RealFft ::transform_scalar(const F32* samples, F32 offset) {
+    FW_ASSERT(samples != nullptr);
+    this->load(samples, offset);
+    const U32 points = this->m_size / 2;
+    for (U32 half = 1; half < points; half *= 2) {
+        this->stage(half);
+    }
+    this->split();
+}
+
+const F32* RealFft ::real() const {
+    return this->m_real;
+}
+
+const F32* RealFft ::imaginary() const {
+    return this->m_imag;
+}
+
+F32 RealFft ::power(U32 bin) const {
+    FW_ASSERT(bin < this->bins(), static_cast<FwAssertArgType>(bin));
+    const F32 magnitude = (this->m_real[bin] * this->m_real[bin]) + (this->m_imag[bin] * this->m_imag[bin]);
+    // Bins other than zero and Nyquist also carry their negative frequency
+    const bool edge = (bin == 0) || (bin == (this->m_size / 2));
+    return (edge ? 1.0f : 2.0f) * this->m_powerScale * magnitude;
+}
+
+void RealFft ::peak(F32& bin, F32& amplitude) const {
+    const U32 last = this->m_size / 2;
+    U32 largest = 1;
+    F32 largestMagnitude = 0.0f;
+    for (U32 k = 1; k <= last; k++) {
+        const F32 magnitude = (this->m_real[k] * this->m_real[k]) + (this->m_imag[k] * this->m_imag[k]);
+        if (magnitude > largestMagnitude) {
+            largestMagnitude = magnitude;
+            largest = k;
+        }
+    }
+    const F64 center = std::sqrt(static_cast<F64>(largestMagnitude));
+    if (center == 0.0) {
+        bin = 0.0f;
+        amplitude = 0.0f;
+        return;
+    }
+    const U32 left = largest - 1;
+    const U32 right = (largest < last) ? (largest + 1) : left;
+    const F64 leftMagnitude =
+        std::sqrt(static_cast<F64>((this->m_real[left] * this->m_real[left]) + (this->m_imag[left] * this->m_imag[left])));
+    const F64 rightMagnitude = std::sqrt(
+        static_cast<F64>((this->m_real[right] * this->m_real[right]) + (this->m_imag[right] * this->m_imag[right])));
+    const bool toRight = rightMagnitude > leftMagnitude;
+    const F64 ratio = (toRight ? rightMagnitude : leftMagnitude) / center;
+
+    // A tone d bins from a bin reads sinc(d) with no window and sinc(d) / (1 - d^2) with Hann, so the neighbour ratio
+    // is d / (1 - d) and (1 + d) / (2 - d) respectively
+    F64 offset;
+    F64 response;
+    if (this->m_window == VibrationWindow::HANN) {
+        offset = ((2.0 * ratio) - 1.0) / (ratio + 1.0);
+        offset = (offset < 0.0) ? 0.0 : ((offset > 0.5) ? 0.5 : offset);
+        response = sinc(offset) / (1.0 - (offset * offset));
+    } else {
+        offset = ratio / (1.0 + ratio);
+        offset = (offset > 0.5) ? 0.5 : offset;
+        response = sinc(offset);
+    }
+    bin = static_cast<F32>(static_cast<F64>(largest) + (toRight ? offset : -offset));
+    amplitude = static_cast<F32>(static_cast<F64>(this->m_amplitudeScale) * center / response);
+}
+
+void RealFft ::load(const F32* samples, F32 offset) {
+    const U32 points = this->m_size / 2;
+    for (U32 n = 0; n < points; n++) {
+        const U32 index = this->m_reverse[n];
+        this->m_real[index] = (samples[2 * n] - offset) * this->m_coefficients[2 * n];
+        this->m_imag[index] = (samples[(2 * n) + 1] - offset) * this->m_coefficients[(2 * n) + 1];
+    }
+}
+
+void RealFft ::stage(U32 half) {
+    const U32 points = this->m_size / 2;
+    for (U32 start = 0; start < points; start += 2 * half) {
+        for (U32 j = 0; j < half; j++) {
+            const U32 a = start + j;
+            const U32 b = a + half;
+            const F32 wr = this->m_twiddleReal[half + j];
+            const F32 wi = this->m_twiddleImag[half + j];
+            const F32 tr = (wr * this->m_real[b]) - (wi * this->m_imag[b]);
+            const F32 ti = (wr * this->m_imag[b]) + (wi * this->m_real[b]);
+            this->m_real[b] = this->m_real[a] - tr;
+            this->m_imag[b] = this->m_imag[a] - ti;
+            this->m_real[a] = this->m_real[a] + tr;
+            this->m_imag[a] = this->m_imag[a] + ti;
+        }
+    }
+}
+
+void RealFft ::split() {
+    // With Z the transform of the packed points, the even samples transform to E = (Z[k] + conj(Z[M - k])) / 2 and
+    // the odd to O = (Z[k] - conj(Z[M - k])) / 2i, and X[k] = E + W^k O with W = exp(-2 pi i / N). Bins k and M - k
+    // are computed together from the same two points so the split runs in place.
+    const U32 points = this->m_size / 2;
+    const F32 zeroReal = this->m_real[0];
+    const F32 zeroImag = this->m_imag[0];
+    this->m_real[0] = zeroReal + zeroImag;
+    this->m_imag[0] = 0.0f;
+    this->m_real[points] = zeroReal - zeroImag;
+    this->m_imag[points] = 0.0f;
+    for (U32 k = 1; k <= points / 2; k++) {
+        const U32 mirror = points - k;
+        const F32 evenReal = 0.5f * (this->m_real[k] + this->m_real[mirror]);
+        const F32 evenImag = 0.5f * (this->m_imag[k] - this->m_imag[mirror]);
+        const F32 oddReal = 0.5f * (this->m_imag[k] + this->m_imag[mirror]);
+        const F32 oddImag = -0.5f * (this->m_real[k] - this->m_real[mirror]);
+        const F32 wr = this->m_twiddleReal[points + k];
+        const F32 wi = this->m_twiddleImag[points + k];
+        const F32 pr = (wr * oddReal) - (wi * oddImag);
+        const F32 pi = (wr * oddImag) + (wi * oddReal);
+        // X[M - k] = conj(E - W^k O), as W^(M - k) = -conj(W^k)
+        this->m_real[k] = evenReal + pr;
+        this->m_imag[k] = evenImag + pi;
+        this->m_real[mirror] = evenReal - pr;
+        this->m_imag[mirror] = -(evenImag - pi);
+    }
+}
+
+}  // namespace MpuImu
@@ -0,0 +1,103 @@
+// ======================================================================
+// \title  RealFft.hpp
+// \author mstarch
+// \brief  hpp file for the windowed radix-2 real FFT of accelerometer frames
+// ======================================================================
+
+#ifndef MpuImu_RealFft_HPP
+#define MpuImu_RealFft_HPP
+
+#include "Fw/FPrimeBasicTypes.hpp"
+#include "fprime-sensors/MpuImu/Types/VibrationWindowEnumAc.hpp"
+
+namespace MpuImu {
+
+//! Transforms frames of real samples of a power-of-two size up to 1024 into one-sided spectra
+//!
+//! A frame of N samples is packed as N/2 complex points, even samples real and odd imaginary, which are transformed by
+//! an in-place radix-2 decimation-in-time FFT and split into the N/2 + 1 bins of the real spectrum. The offset removal,
+//! window, and bit-reversal permutation are applied while the frame is loaded. Real and imaginary parts are held in
+//! separate arrays so the butterflies of a stage run four at a time with SSE2 or AArch64 NEON where available, from
+//! twiddle tables laid out contiguously by stage and computed once at construction. The tables, window, and spectrum
+//! take about 17 KiB and a transform allocates nothing.
+class RealFft {
+  public:
+    //! Largest frame transformed
+    static constexpr U32 MAX_SIZE = 1024;
+
+    //! Smallest frame transformed
+    static constexpr U32 MIN_SIZE = 16;
+
+    //! Bins of the largest spectrum, zero frequency to the Nyquist frequency
+    static constexpr U32 MAX_BINS = (MAX_SIZE / 2) + 1;
+
+    //! Whether transform uses a SIMD kernel on this target
+    static const bool SIMD_AVAILABLE;
+
+    //! Construct a transform of the largest size with a Hann window
+    RealFft();
+
+    //! Whether a frame size is a power of two the transform supports
+    static bool valid_size(U32 size);
+
+    //! Set the frame size, which must be valid, and the window, precomputing the permutation and window
+    void configure(U32 size, VibrationWindow window);
+
+    //! Samples in a frame
+    U32 size() const;
+
+    //! Bins in the spectrum, size / 2 + 1
+    U32 bins() const;
+
+    //! Window applied to each frame
+    VibrationWindow window() const;
+
+    //! Transform size samples less an offset, using the SIMD kernel where available
+    void transform(const F32* samples, F32 offset);
+
+    //! Transform size samples less an offset one butterfly at a time
+    void transform_scalar(const F32* samples, F32 offset);
+
+    //! Real part of each bin of the last transform
+    const F32* real() const;
+
+    //! Imaginary part of each bin of the last transform
+    const F32* imaginary() const;
+
+    //! Mean square of the frame in a bin of the last transform, corrected for the window, such that the bins sum to
+    //! the mean square of the frame
+    F32 power(U32 bin) const;
+
+    //! Fractional bin and amplitude of the largest tone above zero frequency in the last transform
+    //!
+    //! The offset of the tone from the largest bin follows from the ratio of the larger neighbour to it, which for
+    //! either window depends on the offset alone, and the amplitude from the window response at that offset.
+    void peak(F32& bin,       //!< Fractional bin of the tone
+              F32& amplitude  //!< Amplitude of the tone, in the units of the samples
+    ) const;
+
+  private:
+    //! Offset, window, and load the samples as bit-reversed complex points
+    void load(const F32* samples, F32 offset);
+
+    //! Run the butterflies of the stage of a half length one at a time
+    void stage(U32 half);
+
+    //! Split the complex transform into the real spectrum
+    void split();
+
+    U32 m_size;                    //!< Samples in a frame
+    VibrationWindow m_window;      //!< Window applied to each frame
+    F32 m_powerScale;              //!< Power of a bin per squared magnitude, before the one-sided doubling
+    F32 m_amplitudeScale;          //!< Amplitude of a tone on a bin per magnitude
+    F32 m_twiddleReal[MAX_SIZE];   //!< Real part of exp(-i pi j / h) at h + j, for each stage half length h
+    F32 m_twiddleImag[MAX_SIZE];   //!< Imaginary part of exp(-i pi j / h) at h + j, for each stage half length h
+    F32 m_coefficients[MAX_SIZE];  //!< Window coefficients
+    U16 m_reverse[MAX_SIZE / 2];   //!< Bit-reversed index of each complex point
+    F32 m_real[MAX_BINS];          //!< Real part of each point, then of each bin
+    F32 m_imag[MAX_BINS];          //!< Imaginary part of each point, then of each bin
+};
+
+}  // namespace MpuImu
+
+#endif
@@ -0,0 +1,210 @@
+// ======================================================================
+// \title  VibrationMonitor.cpp
+// \author mstarch
+// \brief  cpp file for VibrationMonitor component implementation class
+// ======================================================================
+
+#include "fprime-sensors/MpuImu/Components/VibrationMonitor/VibrationMonitor.hpp"
+#include <cmath>
+
+namespace MpuImu {
+
+static_assert(VibrationBands::SIZE == VibrationBandPowers::SIZE, "Every band needs a power");
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+VibrationMonitor ::VibrationMonitor(const char* const compName)
+    : VibrationMonitorComponentBase(compName),
+      m_parametersLoaded(false),
+      m_filling(0),
+      m_count(0),
+      m_framesAnalyzed(0),
+      m_frameOverruns(0),
+      m_sampleGaps(0) {
+    for (U32 frame = 0; frame < FRAMES; frame++) {
+        this->m_frameComplete[frame] = false;
+    }
+}
+
+VibrationMonitor ::~VibrationMonitor() {}
+
+void VibrationMonitor ::parameterUpdated(FwPrmIdType id) {
+    Fw::ParamValid isValid = Fw::ParamValid::INVALID;
+    switch (id) {
+        case PARAMID_FFT_SIZE: {
+            // Read back the parameter value
+            const VibrationFftSize size = this->paramGet_FFT_SIZE(isValid);
+            // NOTE: isValid is always VALID in parameterUpdated as it was just properly set
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_FftSizeUpdated(size);
+            break;
+        }
+        case PARAMID_WINDOW: {
+            // Read back the parameter value
+            const VibrationWindow window = this->paramGet_WINDOW(isValid);
+            // NOTE: isValid is always VALID in parameterUpdated as it was just properly set
+            FW_ASSERT(isValid == Fw::ParamValid::VALID, static_cast<FwAssertArgType>(isValid));
+            this->log_ACTIVITY_HI_WindowUpdated(window);
+            break;
+        }
+        case PARAMID_BANDS:
+            // Loaded on the next run
+            break;
+        default:
+            FW_ASSERT(0, static_cast<FwAssertArgType>(id));
+            break;
+    }
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for typed input ports
+// ----------------------------------------------------------------------
+
+void VibrationMonitor ::imuIn_handler(FwIndexType portNum, const Fw::Time& time, const MpuImu::ImuData& data) {
+    // Samples may arrive before the first run
+    if (!this->m_parametersLoaded) {
+        this->load_parameters();
+    }
+    const U32 frame = this->m_filling;
+    if (this->m_count > 0) {
+        const U32 elapsed = elapsed_us(this->m_frameEnd[frame], time);
+        // Spacing varies with the rate group jitter, so a gap is judged against the mean spacing of the frame so far
+        bool gap = (elapsed == 0) || (elapsed > MAX_SAMPLE_GAP_US);
+        if ((elapsed != 0) && (this->m_count > 1)) {
+            const U64 span = elapsed_us(this->m_frameStart[frame], this->m_frameEnd[frame]);
+            gap = (static_cast<U64>(elapsed) * (this->m_count - 1)) > (MAX_SAMPLE_GAP_SPACINGS * span);
+        }
+        if (gap) {
+            // Start the frame again from this sample
+            this->m_count = 0;
+            this->m_sampleGaps++;
+        }
+    }
+    if (this->m_count == 0) {
+        this->m_frameStart[frame] = time;
+    }
+    this->m_samples[frame][0][this->m_count] = data.get_acceleration().get_x();
+    this->m_samples[frame][1][this->m_count] = data.get_acceleration().get_y();
+    this->m_samples[frame][2][this->m_count] = data.get_acceleration().get_z();
+    this->m_frameEnd[frame] = time;
+    this->m_count++;
+
+    if (this->m_count == this->m_fft.size()) {
+        this->m_frameComplete[frame] = true;
+        this->m_filling = (frame + 1) % FRAMES;
+        this->m_count = 0;
+        // The run tick did not keep up, the older frame gives way to the newer
+        if (this->m_frameComplete[this->m_filling]) {
+            this->m_frameComplete[this->m_filling] = false;
+            this->m_frameOverruns++;
+        }
+    }
+
+    if (this->isConnected_imuOut_OutputPort(0)) {
+        this->imuOut_out(0, time, data);
+    }
+}
+
+void VibrationMonitor ::run_handler(FwIndexType portNum, U32 context) {
+    this->load_parameters();
+    for (U32 frame = 0; frame < FRAMES; frame++) {
+        if (this->m_frameComplete[frame]) {
+            this->analyze(frame);
+            this->m_frameComplete[frame] = false;
+        }
+    }
+    this->tlmWrite_FramesAnalyzed(this->m_framesAnalyzed);
+    this->tlmWrite_FrameOverruns(this->m_frameOverruns);
+    this->tlmWrite_SampleGaps(this->m_sampleGaps);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void VibrationMonitor ::load_parameters() {
+    Fw::ParamValid paramValid;
+    const VibrationFftSize size = this->paramGet_FFT_SIZE(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    const VibrationWindow window = this->paramGet_WINDOW(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+    this->m_bands = this->paramGet_BANDS(paramValid);
+    FW_ASSERT(paramValid != Fw::ParamValid::INVALID, static_cast<FwAssertArgType>(paramValid));
+
+    const U32 frameSize = static_cast<U32>(size.e);
+    if (!this->m_parametersLoaded || (frameSize != this->m_fft.size()) || (window.e != this->m_fft.window().e)) {
+        this->m_fft.configure(frameSize, window);
+        this->restart_frames();
+    }
+    this->m_parametersLoaded = true;
+}
+
+void VibrationMonitor ::restart_frames() {
+    for (U32 frame = 0; frame < FRAMES; frame++) {
+        this->m_frameComplete[frame] = false;
+    }
+    this->m_filling = 0;
+    this->m_count = 0;
+}
+
+void VibrationMonitor ::analyze(U32 frame) {
+    const U32 size = this->m_fft.size();
+    const U32 bins = this->m_fft.bins();
+    // Gaps restart the frame, so the samples are in order and the frame spans time
+    const U32 elapsed = elapsed_us(this->m_frameStart[frame], this->m_frameEnd[frame]);
+    FW_ASSERT(elapsed > 0);
+    const F32 sampleRate = static_cast<F32>((static_cast<F64>(size - 1) * 1.0e6) / static_cast<F64>(elapsed));
+    const F32 binWidth = sampleRate / static_cast<F32>(size);
+
+    F32 bandPower[VibrationBands::SIZE][AXES];
+    F32 peakFrequency[AXES];
+    F32 peakAmplitude[AXES];
+    for (U32 axis = 0; axis < AXES; axis++) {
+        const F32* const samples = this->m_samples[frame][axis];
+        // Gravity and bias would otherwise leak from zero frequency into the low bins
+        F64 sum = 0.0;
+        for (U32 n = 0; n < size; n++) {
+            sum += samples[n];
+        }
+        this->m_fft.transform(samples, static_cast<F32>(sum / static_cast<F64>(size)));
+
+        for (U32 band = 0; band < VibrationBands::SIZE; band++) {
+            const F32 lower = this->m_bands[band].get_lower();
+            const F32 upper = this->m_bands[band].get_upper();
+            // Bins from the first at or above the lower edge to the last below the upper, none beyond Nyquist
+            const F32 first = std::ceil(lower / binWidth);
+            U32 bin = 0;
+            if (first >= static_cast<F32>(bins)) {
+                bin = bins;
+            } else if (first > 0.0f) {
+                bin = static_cast<U32>(first);
+            }
+            F32 power = 0.0f;
+            for (; (bin < bins) && ((static_cast<F32>(bin) * binWidth) < upper); bin++) {
+                power += this->m_fft.power(bin);
+            }
+            bandPower[band][axis] = power;
+        }
+
+        F32 peakBin;
+        this->m_fft.peak(peakBin, peakAmplitude[axis]);
+        peakFrequency[axis] = peakBin * binWidth;
+    }
+    this->m_framesAnalyzed++;
+
+    VibrationBandPowers powers;
+    for (U32 band = 0; band < VibrationBands::SIZE; band++) {
+        powers[band] = FprimeSensors::GeometricVector3(bandPower[band][0], bandPower[band][1], bandPower[band][2]);
+    }
+    const Fw::Time& time = this->m_frameEnd[frame];
+    this->tlmWrite_BandPower(powers, time);
+    this->tlmWrite_PeakFrequency(FprimeSensors::GeometricVector3(peakFrequency[0], peakFrequency[1], peakFrequency[2]),
+                                 time);
+    this->tlmWrite_PeakAmplitude(FprimeSensors::GeometricVector3(peakAmplitude[0], peakAmplitude[1], peakAmplitude[2]),
+                                 time);
+    this->tlmWrite_SampleRate(sampleRate, time);
+}
+
+}  // namespace MpuImu
@@ -0,0 +1,107 @@
+// ======================================================================
+// \title  VibrationMonitor.hpp
+// \author mstarch
+// \brief  hpp file for VibrationMonitor component implementation class
+// ======================================================================
+
+#ifndef MpuImu_VibrationMonitor_HPP
+#define MpuImu_VibrationMonitor_HPP
+
+#include "fprime-sensors/MpuImu/Components/VibrationMonitor/RealFft.hpp"
+#include "fprime-sensors/MpuImu/Components/VibrationMonitor/VibrationMonitorComponentAc.hpp"
+#include "fprime-sensors/MpuImu/Types/ElapsedTime.hpp"
+
+namespace MpuImu {
+
+//! Reports accelerometer vibration from FFTs of frames of ImuManager samples
+//!
+//! Each sample on imuIn is appended to a frame of FFT_SIZE samples per axis and forwarded on imuOut. Frames alternate
+//! between two buffers, so a complete frame waits for the next run tick while the following one fills. The run tick
+//! removes the mean of each axis, windows and transforms it, and writes the band powers and the largest tone to
+//! telemetry, keeping the transform off the sample path.
+class VibrationMonitor final : public VibrationMonitorComponentBase {
+    friend class VibrationMonitorTester;
+
+  public:
+    //! Axes of acceleration analyzed
+    static constexpr U32 AXES = 3;
+
+    //! Frame buffers, one filling while the other waits to be analyzed
+    static constexpr U32 FRAMES = 2;
+
+    //! Longest time between the first two samples of a frame (µs), a longer gap would splice unrelated motion together
+    static constexpr U32 MAX_SAMPLE_GAP_US = 250000;
+
+    //! Later samples more than this many mean sample spacings of their frame after the previous restart the frame
+    static constexpr U32 MAX_SAMPLE_GAP_SPACINGS = 2;
+
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct VibrationMonitor object
+    VibrationMonitor(const char* const compName  //!< The component name
+    );
+
+    //! Destroy VibrationMonitor object
+    ~VibrationMonitor();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Handler implementations for typed input ports
+    // ----------------------------------------------------------------------
+
+    //! Emit parameter updated EVR
+    //!
+    void parameterUpdated(FwPrmIdType id  //!< The parameter ID
+                          ) override;
+
+    //! Handler implementation for imuIn
+    //!
+    //! Port receiving every IMU sample, collected into frames
+    void imuIn_handler(FwIndexType portNum,         //!< The port number
+                       const Fw::Time& time,        //!< Time the sample was taken
+                       const MpuImu::ImuData& data  //!< The sample
+                       ) override;
+
+    //! Handler implementation for run
+    //!
+    //! Scheduling port for loading the parameters and analyzing the newest complete frame
+    void run_handler(FwIndexType portNum,  //!< The port number
+                     U32 context           //!< The call order
+                     ) override;
+
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Load the frame size, window, and bands from the parameters, restarting the frames when the transform changes
+    void load_parameters();
+
+    //! Discard the filling and waiting frames
+    void restart_frames();
+
+    //! Transform each axis of a complete frame and write its band powers and peaks to telemetry
+    void analyze(U32 frame);
+
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    RealFft m_fft;                                   //!< Transform of the configured size and window
+    VibrationBands m_bands;                          //!< Bands the power is reported in (Hz)
+    bool m_parametersLoaded;                         //!< Whether the parameters were loaded since construction
+    F32 m_samples[FRAMES][AXES][RealFft::MAX_SIZE];  //!< Acceleration of each frame by axis (G)
+    Fw::Time m_frameStart[FRAMES];                   //!< Time of the first sample of each frame
+    Fw::Time m_frameEnd[FRAMES];                     //!< Time of the last sample of each frame
+    bool m_frameComplete[FRAMES];                    //!< Whether each frame is complete and waiting
+    U32 m_filling;                                   //!< Frame samples are appended to
+    U32 m_count;                                     //!< Samples in the filling frame
+    U32 m_framesAnalyzed;                            //!< Frames analyzed since startup
+    U32 m_frameOverruns;                             //!< Complete frames dropped before analysis since startup
+    U32 m_sampleGaps;                                //!< Samples restarting the frame for their time
+};
+
+}  // namespace MpuImu
+
+#endif
@@ -0,0 +1,44 @@
+// ======================================================================
+// \title  VibrationMonitorTestMain.cpp
+// \author mstarch
+// \brief  test main for VibrationMonitor component
+// ======================================================================
+
+#include "VibrationMonitorTester.hpp"
+#include "STest/Random/Random.hpp"
+
+TEST(Nominal, TransformAccuracy) {
+    MpuImu::VibrationMonitorTester tester;
+    tester.test_transform_accuracy();
+}
+
+TEST(Nominal, ToneAccuracy) {
+    MpuImu::VibrationMonitorTester tester;
+    tester.test_tone_accuracy();
+}
+
+TEST(Nominal, Spectrum) {
+    MpuImu::VibrationMonitorTester tester;
+    tester.test_nominal_spectrum();
+}
+
+TEST(Error, OverrunsAndGaps) {
+    MpuImu::VibrationMonitorTester tester;
+    tester.test_overruns_and_gaps();
+}
+
+TEST(Nominal, Parameters) {
+    MpuImu::VibrationMonitorTester tester;
+    tester.test_parameters();
+}
+
+TEST(Benchmark, FftSizes) {
+    MpuImu::VibrationMonitorTester tester;
+    tester.test_benchmark();
+}
+
+int main(int argc, char** argv) {
+    STest::Random::seed();
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
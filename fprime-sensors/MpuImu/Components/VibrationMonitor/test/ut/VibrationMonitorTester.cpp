@@ -0,0 +1,373 @@
+// ======================================================================
+// \title  VibrationMonitorTester.cpp
+// \author mstarch
+// \brief  cpp file for VibrationMonitor component test harness implementation class
+// ======================================================================
+
+#include "VibrationMonitorTester.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include "STest/Pick/Pick.hpp"
+
+namespace MpuImu {
+
+static constexpr F64 TWO_PI = 6.283185307179586;
+
+//! Expected band of the tone of each axis of send_tones with the default bands
+static const U32 TONE_BAND[VibrationMonitor::AXES] = {1, 2, 3};
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+VibrationMonitorTester ::VibrationMonitorTester()
+    : VibrationMonitorGTestBase("VibrationMonitorTester", VibrationMonitorTester::MAX_HISTORY_SIZE),
+      component("VibrationMonitor"),
+      sampleTime(TimeBase::TB_PROC_TIME, 0, 100, 0) {
+    this->initComponents();
+    this->connectPorts();
+}
+
+VibrationMonitorTester ::~VibrationMonitorTester() {}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void VibrationMonitorTester ::test_transform_accuracy() {
+    // Kept off the stack
+    static RealFft fft;
+    static F32 samples[RealFft::MAX_SIZE];
+    static F32 simdReal[RealFft::MAX_BINS];
+    static F32 simdImag[RealFft::MAX_BINS];
+
+    for (U32 size = RealFft::MIN_SIZE; size <= RealFft::MAX_SIZE; size *= 2) {
+        fft.configure(size, VibrationWindow::RECTANGULAR);
+        const F32 offset = static_cast<F32>(STest::Pick::lowerUpper(0, 2000)) * 1.0e-3f - 1.0f;
+        F64 squares = 0.0;
+        for (U32 n = 0; n < size; n++) {
+            samples[n] = offset + static_cast<F32>(STest::Pick::lowerUpper(0, 2000000)) * 1.0e-6f - 1.0f;
+            squares += static_cast<F64>(samples[n] - offset) * static_cast<F64>(samples[n] - offset);
+        }
+        fft.transform(samples, offset);
+        for (U32 bin = 0; bin < fft.bins(); bin++) {
+            simdReal[bin] = fft.real()[bin];
+            simdImag[bin] = fft.imaginary()[bin];
+        }
+        fft.transform_scalar(samples, offset);
+
+        // Bins of unit noise are of magnitude sqrt(size), against which F32 rounding is measured
+        const F64 tolerance = 1.0e-5 * std::sqrt(static_cast<F64>(size));
+        F64 power = 0.0;
+        for (U32 bin = 0; bin < fft.bins(); bin++) {
+            F64 real = 0.0;
+            F64 imag = 0.0;
+            for (U32 n = 0; n < size; n++) {
+                const F64 angle = -TWO_PI * static_cast<F64>(bin) * static_cast<F64>(n) / static_cast<F64>(size);
+                const F64 value = static_cast<F64>(samples[n] - offset);
+                real += value * std::cos(angle);
+                imag += value * std::sin(angle);
+            }
+            ASSERT_NEAR(fft.real()[bin], real, tolerance) << "Size " << size << " bin " << bin;
+            ASSERT_NEAR(fft.imaginary()[bin], imag, tolerance) << "Size " << size << " bin " << bin;
+            ASSERT_NEAR(simdReal[bin], fft.real()[bin], tolerance) << "Size " << size << " bin " << bin;
+            ASSERT_NEAR(simdImag[bin], fft.imaginary()[bin], tolerance) << "Size " << size << " bin " << bin;
+            power += fft.power(bin);
+        }
+        // Without a window the bin powers sum to the mean square exactly
+        ASSERT_NEAR(power / (squares / static_cast<F64>(size)), 1.0, 1.0e-5) << "Size " << size;
+    }
+}
+
+void VibrationMonitorTester ::test_tone_accuracy() {
+    static RealFft fft;
+    static F32 samples[RealFft::MAX_SIZE];
+
+    for (U32 size = RealFft::MIN_SIZE; size <= RealFft::MAX_SIZE; size *= 2) {
+        // Off-bin tones clear of the ends of the spectrum, where their negative frequency image leaks in
+        fft.configure(size, VibrationWindow::HANN);
+        for (U32 tone = 0; tone < TONES_PER_SIZE; tone++) {
+            const F64 bin = 3.0 + static_cast<F64>(STest::Pick::lowerUpper(0, 1000000)) * 1.0e-6 * ((size / 2) - 6);
+            const F64 amplitude = 0.01 + static_cast<F64>(STest::Pick::lowerUpper(0, 1000000)) * 1.0e-6;
+            const F64 phase = static_cast<F64>(STest::Pick::lowerUpper(0, 1000000)) * 1.0e-6 * TWO_PI;
+            for (U32 n = 0; n < size; n++) {
+                samples[n] = static_cast<F32>(
+                    1.0 + amplitude * std::cos((TWO_PI * bin * static_cast<F64>(n) / static_cast<F64>(size)) + phase));
+            }
+            fft.transform(samples, 1.0f);
+            F32 peakBin;
+            F32 peakAmplitude;
+            fft.peak(peakBin, peakAmplitude);
+            ASSERT_NEAR(peakBin, bin, 0.01) << "Size " << size;
+            ASSERT_NEAR(peakAmplitude / amplitude, 1.0, 0.005) << "Size " << size << " bin " << bin;
+            F64 power = 0.0;
+            for (U32 k = 0; k < fft.bins(); k++) {
+                power += fft.power(k);
+            }
+            ASSERT_NEAR(power / (amplitude * amplitude / 2.0), 1.0, 0.01) << "Size " << size << " bin " << bin;
+        }
+
+        // Without a window a tone on a bin is that bin alone
+        fft.configure(size, VibrationWindow::RECTANGULAR);
+        const U32 bin = STest::Pick::lowerUpper(1, (size / 2) - 1);
+        const F64 amplitude = 0.01 + static_cast<F64>(STest::Pick::lowerUpper(0, 1000000)) * 1.0e-6;
+        for (U32 n = 0; n < size; n++) {
+            samples[n] = static_cast<F32>(amplitude * std::sin(TWO_PI * bin * static_cast<F64>(n) / size));
+        }
+        fft.transform(samples, 0.0f);
+        F32 peakBin;
+        F32 peakAmplitude;
+        fft.peak(peakBin, peakAmplitude);
+        ASSERT_NEAR(peakBin, static_cast<F32>(bin), 1.0e-3f) << "Size " << size;
+        ASSERT_NEAR(peakAmplitude / amplitude, 1.0, 1.0e-4) << "Size " << size;
+        ASSERT_NEAR(fft.power(bin) / (amplitude * amplitude / 2.0), 1.0, 1.0e-4) << "Size " << size;
+    }
+}
+
+void VibrationMonitorTester ::test_nominal_spectrum() {
+    this->configure(VibrationFftSize::SIZE_256, VibrationWindow::HANN);
+    // A tone in each of the upper three default bands, five bins clear of their edges
+    const F32 frequency[VibrationMonitor::AXES] = {pick(40.0f, 60.0f), pick(100.0f, 180.0f), pick(250.0f, 450.0f)};
+    const F32 amplitude[VibrationMonitor::AXES] = {pick(0.05f, 0.5f), pick(0.05f, 0.5f), pick(0.05f, 0.5f)};
+    this->send_tones(255, frequency, amplitude);
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_BandPower_SIZE(0);
+    ASSERT_TLM_FramesAnalyzed(0, 0);
+    this->clearHistory();
+
+    this->send_tones(1, frequency, amplitude);
+    ASSERT_EQ(this->samplesForwarded, 256);
+    ASSERT_EQ(this->forwardedTime, this->sampleTime);
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_FramesAnalyzed(0, 1);
+    ASSERT_TLM_SampleRate_SIZE(1);
+    ASSERT_NEAR(this->tlmHistory_SampleRate->at(0).arg, 1000.0f, 0.01f);
+    ASSERT_EQ(this->tlmHistory_SampleRate->at(0).time, this->sampleTime);
+
+    ASSERT_TLM_PeakFrequency_SIZE(1);
+    ASSERT_TLM_PeakAmplitude_SIZE(1);
+    ASSERT_TLM_BandPower_SIZE(1);
+    const FprimeSensors::GeometricVector3& peakFrequency = this->tlmHistory_PeakFrequency->at(0).arg;
+    const FprimeSensors::GeometricVector3& peakAmplitude = this->tlmHistory_PeakAmplitude->at(0).arg;
+    const F32 measuredFrequency[VibrationMonitor::AXES] = {peakFrequency.get_x(), peakFrequency.get_y(),
+                                                           peakFrequency.get_z()};
+    const F32 measuredAmplitude[VibrationMonitor::AXES] = {peakAmplitude.get_x(), peakAmplitude.get_y(),
+                                                           peakAmplitude.get_z()};
+    const VibrationBandPowers& powers = this->tlmHistory_BandPower->at(0).arg;
+    for (U32 axis = 0; axis < VibrationMonitor::AXES; axis++) {
+        // Within a hundredth of the 3.9 Hz bin width
+        ASSERT_NEAR(measuredFrequency[axis], frequency[axis], 0.05f) << "Axis " << axis;
+        ASSERT_NEAR(measuredAmplitude[axis] / amplitude[axis], 1.0f, 0.005f) << "Axis " << axis;
+        const F32 expected = amplitude[axis] * amplitude[axis] / 2.0f;
+        for (U32 band = 0; band < VibrationBandPowers::SIZE; band++) {
+            const F32 axisPower[VibrationMonitor::AXES] = {powers[band].get_x(), powers[band].get_y(),
+                                                           powers[band].get_z()};
+            if (band == TONE_BAND[axis]) {
+                ASSERT_NEAR(axisPower[axis] / expected, 1.0f, 0.01f) << "Axis " << axis;
+            } else {
+                ASSERT_LT(axisPower[axis] / expected, 1.0e-3f) << "Axis " << axis << " band " << band;
+            }
+        }
+    }
+    this->clearHistory();
+
+    // No new frame, no new spectrum
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_BandPower_SIZE(0);
+    ASSERT_TLM_PeakFrequency_SIZE(0);
+    ASSERT_TLM_FramesAnalyzed(0, 1);
+}
+
+void VibrationMonitorTester ::test_overruns_and_gaps() {
+    this->configure(VibrationFftSize::SIZE_64, VibrationWindow::HANN);
+    const F32 frequency[VibrationMonitor::AXES] = {50.0f, 150.0f, 300.0f};
+    const F32 amplitude[VibrationMonitor::AXES] = {0.1f, 0.1f, 0.1f};
+
+    // Three frames between ticks, the second and third each push out the one before
+    this->send_tones(3 * 64, frequency, amplitude);
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_FramesAnalyzed(0, 1);
+    ASSERT_TLM_FrameOverruns(0, 2);
+    ASSERT_EQ(this->tlmHistory_BandPower->at(0).time, this->sampleTime);
+    this->clearHistory();
+
+    // A repeated time and a long gap each start the frame again from that sample
+    this->send_tones(32, frequency, amplitude);
+    const F32 level[VibrationMonitor::AXES] = {0.0f, 0.0f, 1.0f};
+    this->send_sample(level, 0);
+    this->send_tones(32, frequency, amplitude);
+    this->send_sample(level, VibrationMonitor::MAX_SAMPLE_GAP_US + 1);
+    this->send_tones(62, frequency, amplitude);
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_FramesAnalyzed(0, 1);
+    ASSERT_TLM_SampleGaps(0, 2);
+    this->clearHistory();
+
+    this->send_tones(1, frequency, amplitude);
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_FramesAnalyzed(0, 2);
+    ASSERT_TLM_FrameOverruns(0, 2);
+    ASSERT_NEAR(this->tlmHistory_SampleRate->at(0).arg, 1000.0f, 0.01f);
+    ASSERT_EQ(this->samplesForwarded, (3 * 64) + 32 + 1 + 32 + 1 + 62 + 1);
+    this->clearHistory();
+
+    // A 10 Hz frame spans seconds and keeps a tick delivered 3 ms late, where a 1 kHz frame restarts on a 3 ms gap
+    for (U32 i = 0; i < 64; i++) {
+        this->send_sample(level, (i == 32) ? 103000 : ((i == 33) ? 97000 : 100000));
+    }
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_FramesAnalyzed(0, 3);
+    ASSERT_TLM_SampleGaps(0, 2);
+    ASSERT_NEAR(this->tlmHistory_SampleRate->at(0).arg, 10.0f, 0.01f);
+    this->clearHistory();
+
+    this->send_tones(32, frequency, amplitude);
+    this->send_sample(level, 3 * SAMPLE_PERIOD_US);
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_SampleGaps(0, 3);
+}
+
+void VibrationMonitorTester ::test_parameters() {
+    this->invoke_to_run(0, 0);
+    this->paramSet_FFT_SIZE(VibrationFftSize::SIZE_1024, Fw::ParamValid::VALID);
+    this->paramSend_FFT_SIZE(0, 0);
+    ASSERT_EVENTS_FftSizeUpdated_SIZE(1);
+    ASSERT_EVENTS_FftSizeUpdated(0, VibrationFftSize::SIZE_1024);
+    this->paramSet_WINDOW(VibrationWindow::RECTANGULAR, Fw::ParamValid::VALID);
+    this->paramSend_WINDOW(0, 0);
+    ASSERT_EVENTS_WindowUpdated_SIZE(1);
+    ASSERT_EVENTS_WindowUpdated(0, VibrationWindow::RECTANGULAR);
+    // All of the spectrum, beyond Nyquist, an inverted band, and below zero frequency
+    VibrationBands bands;
+    bands[0] = VibrationBand(0.0f, 600.0f);
+    bands[1] = VibrationBand(600.0f, 700.0f);
+    bands[2] = VibrationBand(300.0f, 100.0f);
+    bands[3] = VibrationBand(-10.0f, 0.5f);
+    this->paramSet_BANDS(bands, Fw::ParamValid::VALID);
+    this->paramSend_BANDS(0, 0);
+    this->clearHistory();
+
+    // Samples of the default 256 sample frame are discarded when the new size is loaded
+    const U32 bin = 100;
+    const F32 frequency[VibrationMonitor::AXES] = {bin * 1000.0f / 1024.0f, 0.0f, 0.0f};
+    const F32 amplitude[VibrationMonitor::AXES] = {0.25f, 0.0f, 0.0f};
+    this->send_tones(200, frequency, amplitude);
+    this->invoke_to_run(0, 0);
+    this->send_tones(1023, frequency, amplitude);
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_BandPower_SIZE(0);
+    ASSERT_TLM_FramesAnalyzed(1, 0);
+    this->clearHistory();
+
+    // A tone on a bin of the 1024 sample frame with no window
+    this->send_tones(1, frequency, amplitude);
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_FramesAnalyzed(0, 1);
+    ASSERT_NEAR(this->tlmHistory_PeakFrequency->at(0).arg.get_x(), frequency[0], 1.0e-3f);
+    ASSERT_NEAR(this->tlmHistory_PeakAmplitude->at(0).arg.get_x(), amplitude[0], 1.0e-4f);
+    const VibrationBandPowers& powers = this->tlmHistory_BandPower->at(0).arg;
+    ASSERT_NEAR(powers[0].get_x(), amplitude[0] * amplitude[0] / 2.0f, 1.0e-5f);
+    ASSERT_EQ(powers[1].get_x(), 0.0f);
+    ASSERT_EQ(powers[2].get_x(), 0.0f);
+    ASSERT_NEAR(powers[3].get_x(), 0.0f, 1.0e-8f);
+}
+
+void VibrationMonitorTester ::test_benchmark() {
+    static RealFft fft;
+    static F32 samples[RealFft::MAX_SIZE];
+    for (U32 n = 0; n < RealFft::MAX_SIZE; n++) {
+        samples[n] = static_cast<F32>(STest::Pick::lowerUpper(0, 2000000)) * 1.0e-6f - 1.0f;
+    }
+
+    ::printf("[ BENCHMARK ] FFT with Hann window, SIMD %s\n", RealFft::SIMD_AVAILABLE ? "available" : "unavailable");
+    F32 check = 0.0f;
+    for (U32 size = RealFft::MIN_SIZE; size <= RealFft::MAX_SIZE; size *= 2) {
+        fft.configure(size, VibrationWindow::HANN);
+        const U32 passes = BENCHMARK_SAMPLES / size;
+        auto start = std::chrono::steady_clock::now();
+        for (U32 pass = 0; pass < passes; pass++) {
+            fft.transform_scalar(samples, 0.0f);
+            check += fft.real()[1];
+        }
+        const F64 scalar = std::chrono::duration<F64, std::nano>(std::chrono::steady_clock::now() - start).count();
+        start = std::chrono::steady_clock::now();
+        for (U32 pass = 0; pass < passes; pass++) {
+            fft.transform(samples, 0.0f);
+            check += fft.real()[1];
+        }
+        const F64 simd = std::chrono::duration<F64, std::nano>(std::chrono::steady_clock::now() - start).count();
+        ::printf("[ BENCHMARK ] %4u points: %8.0f ns scalar, %8.0f ns SIMD, %.2f ns per sample\n", size,
+                 scalar / passes, simd / passes, simd / (static_cast<F64>(passes) * size));
+    }
+    ASSERT_TRUE(std::isfinite(check));
+
+    // One 1024 sample frame of three axes analyzed per 1.024 s at 1 kHz
+    this->configure(VibrationFftSize::SIZE_1024, VibrationWindow::HANN);
+    const F32 frequency[VibrationMonitor::AXES] = {50.0f, 150.0f, 300.0f};
+    const F32 amplitude[VibrationMonitor::AXES] = {0.1f, 0.1f, 0.1f};
+    this->send_tones(1024, frequency, amplitude);
+    const U32 passes = BENCHMARK_SAMPLES / 1024;
+    const U32 analyzed = this->component.m_framesAnalyzed;
+    const auto start = std::chrono::steady_clock::now();
+    for (U32 pass = 0; pass < passes; pass++) {
+        this->component.analyze(0);
+        this->clearTlm();
+    }
+    const F64 nanoseconds =
+        std::chrono::duration<F64, std::nano>(std::chrono::steady_clock::now() - start).count() / passes;
+    const F64 percent = (nanoseconds / (1024.0 * SAMPLE_PERIOD_US * 1000.0)) * 100.0;
+    ::printf("[ BENCHMARK ] Analysis of a 1024 sample frame: %.0f ns, %.4f%% of a core at 1 kHz (budget %.0f%%)\n",
+             nanoseconds, percent, CORE_BUDGET_PERCENT);
+    ASSERT_EQ(this->component.m_framesAnalyzed - analyzed, passes);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void VibrationMonitorTester ::send_tones(U32 count, const F32 frequency[3], const F32 amplitude[3]) {
+    for (U32 i = 0; i < count; i++) {
+        const F64 t = static_cast<F64>(this->samplesSent) * SAMPLE_PERIOD_US * 1.0e-6;
+        F32 acceleration[3];
+        for (U32 axis = 0; axis < 3; axis++) {
+            acceleration[axis] = ((axis == 2) ? 1.0f : 0.0f) +
+                                 static_cast<F32>(amplitude[axis] * std::sin(TWO_PI * frequency[axis] * t));
+        }
+        this->send_sample(acceleration, SAMPLE_PERIOD_US);
+    }
+}
+
+void VibrationMonitorTester ::send_sample(const F32 acceleration[3], U32 us) {
+    const U64 timeUs =
+        (static_cast<U64>(this->sampleTime.getSeconds()) * 1000000) + this->sampleTime.getUSeconds() + us;
+    this->sampleTime =
+        Fw::Time(TimeBase::TB_PROC_TIME, 0, static_cast<U32>(timeUs / 1000000), static_cast<U32>(timeUs % 1000000));
+    const ImuData data(FprimeSensors::GeometricVector3(acceleration[0], acceleration[1], acceleration[2]),
+                       FprimeSensors::GeometricVector3(0.0f, 0.0f, 0.0f), 25.0f);
+    this->invoke_to_imuIn(0, this->sampleTime, data);
+    this->samplesSent++;
+}
+
+void VibrationMonitorTester ::configure(VibrationFftSize size, VibrationWindow window) {
+    this->paramSet_FFT_SIZE(size, Fw::ParamValid::VALID);
+    this->paramSend_FFT_SIZE(0, 0);
+    this->paramSet_WINDOW(window, Fw::ParamValid::VALID);
+    this->paramSend_WINDOW(0, 0);
+    // Parameters are loaded on the run tick
+    this->invoke_to_run(0, 0);
+    this->clearHistory();
+}
+
+F32 VibrationMonitorTester ::pick(F32 lower, F32 upper) {
+    return lower + (static_cast<F32>(STest::Pick::lowerUpper(0, 1000)) * 1.0e-3f * (upper - lower));
+}
+
+void VibrationMonitorTester ::from_imuOut_handler(FwIndexType portNum,
+                                                  const Fw::Time& time,
+                                                  const MpuImu::ImuData& data) {
+    this->forwardedTime = time;
+    this->samplesForwarded++;
+}
+
+}  // namespace MpuImu
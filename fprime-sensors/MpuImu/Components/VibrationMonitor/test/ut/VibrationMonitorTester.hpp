@@ -0,0 +1,128 @@
+// ======================================================================
+// \title  VibrationMonitorTester.hpp
+// \author mstarch
+// \brief  hpp file for VibrationMonitor component test harness implementation class
+// ======================================================================
+
+#ifndef MpuImu_VibrationMonitorTester_HPP
+#define MpuImu_VibrationMonitorTester_HPP
+
+#include "fprime-sensors/MpuImu/Components/VibrationMonitor/VibrationMonitor.hpp"
+#include "fprime-sensors/MpuImu/Components/VibrationMonitor/VibrationMonitorGTestBase.hpp"
+
+namespace MpuImu {
+
+class VibrationMonitorTester : public VibrationMonitorGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const FwSizeType MAX_HISTORY_SIZE = 10;
+
+    // Instance ID supplied to the component instance under test
+    static const FwEnumStoreType TEST_INSTANCE_ID = 0;
+
+    // Sample period of the 1 kHz IMU rate (µs)
+    static const U32 SAMPLE_PERIOD_US = 1000;
+
+    // Tones of random frequency and phase checked per frame size
+    static const U32 TONES_PER_SIZE = 20;
+
+    // Samples transformed by the benchmark at each frame size
+    static const U32 BENCHMARK_SAMPLES = 4000000;
+
+    // Share of one core the analysis of a 1 kHz stream may take (%)
+    static constexpr F64 CORE_BUDGET_PERCENT = 1.0;
+
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object VibrationMonitorTester
+    VibrationMonitorTester();
+
+    //! Destroy object VibrationMonitorTester
+    ~VibrationMonitorTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! Test the transform of random frames of each size against a direct F64 transform, and the SIMD kernel against
+    //! the scalar path
+    void test_transform_accuracy();
+
+    //! Test the peak frequency, amplitude, and power of known sinusoids at each size and window
+    void test_tone_accuracy();
+
+    //! Test a tone on each axis is reported in its band and as the peak, and every sample is forwarded
+    void test_nominal_spectrum();
+
+    //! Test a frame left waiting gives way to the next, and a gap between samples restarts the frame
+    void test_overruns_and_gaps();
+
+    //! Test the frame size and window parameters restart the frames at the new transform
+    void test_parameters();
+
+    //! Time the transform at each size with and without the SIMD kernel, and the analysis of the largest frame
+    void test_benchmark();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Send count samples of a tone on each axis over 1 G on z, at the 1 kHz sample rate
+    void send_tones(U32 count,               //!< Samples to send
+                    const F32 frequency[3],  //!< Frequency of the tone of each axis (Hz)
+                    const F32 amplitude[3]   //!< Amplitude of the tone of each axis (G)
+    );
+
+    //! Send one sample, advancing the sample time by us first
+    void send_sample(const F32 acceleration[3], U32 us);
+
+    //! Set the frame size and window and load them with a run tick
+    void configure(VibrationFftSize size, VibrationWindow window);
+
+    //! Random value from lower to upper
+    static F32 pick(F32 lower, F32 upper);
+
+    //! Handler implementation for from_imuOut
+    void from_imuOut_handler(FwIndexType portNum,         //!< The port number
+                             const Fw::Time& time,        //!< Time the sample was taken
+                             const MpuImu::ImuData& data  //!< The sample
+                             ) final;
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    VibrationMonitor component;
+
+    //! Time of the last sample sent
+    Fw::Time sampleTime;
+
+    //! Samples sent since construction, the time base of the tones
+    U32 samplesSent = 0;
+
+    //! Samples forwarded on imuOut, counted here rather than in a history such that long runs do not fill it
+    U32 samplesForwarded = 0;
+
+    //! Time of the newest sample forwarded
+    Fw::Time forwardedTime;
+};
+
+}  // namespace MpuImu
+
+#endif
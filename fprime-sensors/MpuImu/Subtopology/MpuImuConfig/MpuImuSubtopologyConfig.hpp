@@ -7,5 +7,6 @@
 #define MpuImu_MpuImuSubtopologyConfig_hpp
 
 using ImuDevice = const char*;
+using ImuInterruptChip = const char*;
 
 #endif // MpuImu_MpuImuSubtopologyConfig_hpp
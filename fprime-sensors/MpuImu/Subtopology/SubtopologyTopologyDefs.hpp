@@ -12,6 +12,8 @@
 namespace MpuImu {
     struct SubtopologyState {
         ImuDevice device;
+        ImuInterruptChip interruptChip;  //!< GPIO chip of the data-ready interrupt, nullptr when not wired
+        U32 interruptLine;               //!< GPIO line of the data-ready interrupt on the chip
     };
 
     struct TopologyState {
@@ -0,0 +1,28 @@
+// ======================================================================
+// \title  ElapsedTime.hpp
+// \author mstarch
+// \brief  hpp file for the elapsed time helper shared by the MpuImu components
+// ======================================================================
+
+#ifndef MpuImu_ElapsedTime_HPP
+#define MpuImu_ElapsedTime_HPP
+
+#include "Fw/FPrimeBasicTypes.hpp"
+#include "Fw/Time/Time.hpp"
+
+namespace MpuImu {
+
+//! Microseconds from since to now, zero when now is not after since and saturating at the U32 range
+inline U32 elapsed_us(const Fw::Time& since, const Fw::Time& now) {
+    const U64 sinceUs = (static_cast<U64>(since.getSeconds()) * 1000000) + since.getUSeconds();
+    const U64 nowUs = (static_cast<U64>(now.getSeconds()) * 1000000) + now.getUSeconds();
+    if (nowUs <= sinceUs) {
+        return 0;
+    }
+    const U64 elapsed = nowUs - sinceUs;
+    return (elapsed > 0xFFFFFFFF) ? 0xFFFFFFFF : static_cast<U32>(elapsed);
+}
+
+}  // namespace MpuImu
+
+#endif